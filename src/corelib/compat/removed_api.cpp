@@ -1219,6 +1219,33 @@ QUuid QUuid::createUuidV5(const QUuid &ns, const QByteArray &baseData) noexcept
 
 #if QT_CORE_REMOVED_SINCE(6, 9)
 
+#include "qarraydata.h"
+
+// Callers compiled against the old headers release the blocks with ::free(),
+// so they must never get one from a QScopedArena
+
+void *QArrayData::allocate(QArrayData **pdata, qsizetype objectSize, qsizetype alignment,
+                           qsizetype capacity, AllocationOption option) noexcept
+{
+    return allocate(pdata, objectSize, alignment, capacity, option, HeapOnly);
+}
+
+void *QArrayData::allocate1(QArrayData **pdata, qsizetype capacity, AllocationOption option) noexcept
+{
+    return allocate1(pdata, capacity, option, HeapOnly);
+}
+
+void *QArrayData::allocate2(QArrayData **pdata, qsizetype capacity, AllocationOption option) noexcept
+{
+    return allocate2(pdata, capacity, option, HeapOnly);
+}
+
+std::pair<QArrayData *, void *>
+QArrayData::reallocateUnaligned(QArrayData *data, void *dataPointer, qsizetype objectSize,
+                                qsizetype newCapacity, AllocationOption option) noexcept
+{
+    return reallocateUnaligned(data, dataPointer, objectSize, newCapacity, option, HeapOnly);
+}
 
 // #include "qotherheader.h"
 // // implement removed functions from qotherheader.h
@@ -0,0 +1,21 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+    QJsonStreamReader reader(&file);
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QJsonStreamReader::Key:
+            if (reader.depth() == 2 && reader.text() == "id"_L1) {
+                reader.readNext();
+                ids.append(reader.toInteger());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    if (reader.hasError()) {
+        // do error handling
+    }
+//! [0]
@@ -0,0 +1,16 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+    QJsonStreamWriter writer(&file);
+    writer.writeStartArray();
+    for (const Record &record : records) {
+        writer.writeStartObject();
+        writer.writeKey("id"_L1);
+        writer.writeInteger(record.id);
+        writer.writeKey("name"_L1);
+        writer.writeString(record.name);
+        writer.writeEndObject();
+    }
+    writer.writeEndArray();
+//! [0]
@@ -0,0 +1,14 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+const QMultiByteArrayMatcher matcher({ "error", "warning", "fatal" }, Qt::CaseInsensitive);
+for (const auto &match : matcher.matches(line))
+    counts[match.patternIndex]++;
+//! [0]
+
+//! [1]
+const QMultiStringMatcher matcher({ u"he"_s, u"she"_s, u"his"_s, u"hers"_s });
+const auto match = matcher.match(u"ushers");
+// match.position == 1, match.length == 3, match.patternIndex == 1 ("she")
+//! [1]
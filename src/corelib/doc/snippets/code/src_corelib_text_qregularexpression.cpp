@@ -339,4 +339,20 @@ if (m.hasMatch()) {
 //! [36]
 }
 
+{
+//! [37]
+QRegularExpression re(R"((\w+)=(\d+))");
+const QStringView lines[] = { u"width=640", u"no digits", u"height=480" };
+const QList<qsizetype> offsets = re.matchOffsets(lines);
+const qsizetype stride = 2 * (re.captureCount() + 1);
+for (qsizetype i = 0; i < std::size(lines); ++i) {
+    const qsizetype *groups = offsets.constData() + i * stride;
+    if (groups[0] < 0)
+        continue; // "no digits" does not match
+    QStringView value = lines[i].sliced(groups[4], groups[5] - groups[4]);
+    // "640", then "480"
+}
+//! [37]
+}
+
 }
@@ -23,6 +23,7 @@
 #include "qthread.h"
 #include "private/qloggingregistry_p.h"
 #include "private/qcoreapplication_p.h"
+#include "private/qstringformat_p.h"
 #include <qtcore_tracepoints_p.h>
 #endif
 #ifdef Q_OS_WIN
@@ -1580,6 +1581,8 @@ QString qFormatLogMessage(QtMsgType type, const QMessageLogContext &context, con
 // symbol tables, so they never show up in backtrace_symbols() or equivalent.
 static QString formatLogMessage(QtMsgType type, const QMessageLogContext &context, const QString &str)
 {
+    static constexpr QFormatString numberFormat(u"%1");
+    static constexpr QFormatString secondsFormat(u"%1.%2");
     QString message;
 
     const auto locker = qt_scoped_lock(QMessagePattern::mutex);
@@ -1633,22 +1636,23 @@ static QString formatLogMessage(QtMsgType type, const QMessageLogContext &contex
             else
                 message.append("unknown"_L1);
         } else if (token == lineTokenC) {
-            message.append(QString::number(context.line));
+            qFormatTo(message, numberFormat, context.line);
         } else if (token == functionTokenC) {
             if (context.function)
                 message.append(QString::fromLatin1(qCleanupFuncinfo(context.function)));
             else
                 message.append("unknown"_L1);
         } else if (token == pidTokenC) {
-            message.append(QString::number(QCoreApplication::applicationPid()));
+            qFormatTo(message, numberFormat, QCoreApplication::applicationPid());
         } else if (token == appnameTokenC) {
             message.append(QCoreApplication::applicationName());
         } else if (token == threadidTokenC) {
             // print the TID as decimal
-            message.append(QString::number(qt_gettid()));
+            qFormatTo(message, numberFormat, qt_gettid());
         } else if (token == qthreadptrTokenC) {
-            message.append("0x"_L1);
-            message.append(QString::number(qlonglong(QThread::currentThread()->currentThread()), 16));
+            static constexpr QFormatString pointerFormat(u"0x%1");
+            qFormatTo(message, pointerFormat,
+                      qFormatNumber(qlonglong(QThread::currentThread()->currentThread()), 0, 16));
 #ifdef QLOGGING_HAVE_BACKTRACE
         } else if (token == backtraceTokenC) {
             QMessagePattern::BacktraceParams backtraceParams = pattern->backtraceArgs.at(backtraceArgsIdx);
@@ -1660,12 +1664,14 @@ static QString formatLogMessage(QtMsgType type, const QMessageLogContext &contex
             timeArgsIdx++;
             if (timeFormat == "process"_L1) {
                 quint64 ms = pattern->timer.elapsed();
-                message.append(QString::asprintf("%6d.%03d", uint(ms / 1000), uint(ms % 1000)));
+                qFormatTo(message, secondsFormat, qFormatNumber(uint(ms / 1000), 6),
+                          qFormatNumber(uint(ms % 1000), 3, 10, '0'));
             } else if (timeFormat == "boot"_L1) {
                 // just print the milliseconds since the elapsed timer reference
                 // like the Linux kernel does
                 qint64 ms = QDeadlineTimer::current().deadline();
-                message.append(QString::asprintf("%6d.%03d", uint(ms / 1000), uint(ms % 1000)));
+                qFormatTo(message, secondsFormat, qFormatNumber(uint(ms / 1000), 6),
+                          qFormatNumber(uint(ms % 1000), 3, 10, '0'));
 #if QT_CONFIG(datestring)
             } else if (timeFormat.isEmpty()) {
                     message.append(QDateTime::currentDateTime().toString(Qt::ISODate));
@@ -344,6 +344,7 @@ void Q_CORE_EXPORT qt_call_post_routines()
 Q_CONSTINIT bool QCoreApplicationPrivate::is_app_running = false;
  // app closing down if true
 Q_CONSTINIT bool QCoreApplicationPrivate::is_app_closing = false;
+Q_CONSTINIT bool QCoreApplicationPrivate::lockFreePostedEvents = false;
 
 qsizetype qGlobalPostedEventsCount()
 {
@@ -497,6 +498,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         const auto locker = qt_scoped_lock(thisThreadData->postEventList.mutex);
+        thisThreadData->postEventList.takeIncomingEvents();
         for (const QPostEvent &pe : std::as_const(thisThreadData->postEventList)) {
             if (pe.event) {
                 --pe.receiver->d_func()->postedEvents;
@@ -854,6 +856,9 @@ void Q_TRACE_INSTRUMENT(qtcore) QCoreApplicationPrivate::init()
     else
         QThreadPrivate::idealThreadCount = hardwareConcurrency.as<int>();
 #endif
+#ifndef QT_NO_QOBJECT
+    lockFreePostedEvents = qEnvironmentVariableIntValue("QT_LOCKFREE_POSTED_EVENTS") > 0;
+#endif
 #endif
 
     // Store app name/version (so they're still available after QCoreApplication is destroyed)
@@ -1619,6 +1624,7 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     if (!object) {
         locker.threadData = QThreadData::current();
         locker.locker = qt_unique_lock(locker.threadData->postEventList.mutex);
+        locker.threadData->postEventList.takeIncomingEvents();
         return locker;
     }
 
@@ -1641,9 +1647,47 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     }
 
     Q_ASSERT(locker.threadData);
+    locker.threadData->postEventList.takeIncomingEvents();
     return locker;
 }
 
+/*
+    Posts a QMetaCallEvent of normal priority without locking the posted
+    event list of the receiver's thread, by pushing it to the list's
+    incoming queue. The event needs no compression and doesn't change the
+    order of the list, so the receiving thread can move it to the list
+    later. Returns \c false if the event must be posted the usual way.
+*/
+bool QCoreApplicationPrivate::postEventLockFree(QObject *receiver, QEvent *event)
+{
+    QObjectPrivate *d = QObjectPrivate::get(receiver);
+    QThreadData *data = d->threadData.loadAcquire();
+    if (!data)
+        return false;
+
+    auto node = std::make_unique<QPostEventList::IncomingEvent>();
+    node->event = QPostEvent(receiver, event, Qt::NormalEventPriority);
+
+    // QObject::moveToThread() waits for the producers after changing the
+    // thread data, and then takes over what they pushed
+    QPostEventList &list = data->postEventList;
+    list.producers.ref();
+    if (d->threadData.loadAcquire() != data) {
+        list.producers.deref();
+        return false;
+    }
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, event->type());
+    event->m_posted = true;
+    ++d->postedEvents;
+    list.pushIncomingEvent(node.release());
+    list.producers.deref();
+
+    QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+    return true;
+}
+
 /*!
     \since 4.3
 
@@ -1682,6 +1726,12 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    if (QCoreApplicationPrivate::lockFreePostedEvents && event->type() == QEvent::MetaCall
+        && priority == Qt::NormalEventPriority
+        && QCoreApplicationPrivate::postEventLockFree(receiver, event)) {
+        return;
+    }
+
     auto locker = QCoreApplicationPrivate::lockThreadPostEventList(receiver);
     if (!locker.threadData) {
         // posting during destruction? just delete the event to prevent a leak
@@ -1801,6 +1851,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     auto locker = qt_unique_lock(data->postEventList.mutex);
+    data->postEventList.takeIncomingEvents();
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -2045,6 +2096,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
     QThreadData *data = QThreadData::current();
 
     const auto locker = qt_scoped_lock(data->postEventList.mutex);
+    data->postEventList.takeIncomingEvents();
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
@@ -125,6 +125,7 @@ public:
         void unlock() { locker.unlock(); }
     };
     static QPostEventListLocker lockThreadPostEventList(QObject *object);
+    static bool postEventLockFree(QObject *receiver, QEvent *event);
 #endif // QT_NO_QOBJECT
 
     int &argc;
@@ -159,6 +160,9 @@ public:
     static QAbstractEventDispatcher *eventDispatcher;
     static bool is_app_running;
     static bool is_app_closing;
+    // post QMetaCallEvents of normal priority without locking the receiving
+    // thread's postEventList, see QPostEventList::IncomingEvent
+    static bool lockFreePostedEvents;
 #endif
 
     static bool setuidAllowed;
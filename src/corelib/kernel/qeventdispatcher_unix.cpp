@@ -25,6 +25,10 @@ static constexpr bool UsingEventfd = true;
 static constexpr bool UsingEventfd = false;
 #endif
 
+#if defined(Q_OS_LINUX) && __has_include(<sys/epoll.h>)
+#  include <sys/epoll.h>
+#endif
+
 #if defined(Q_OS_VXWORKS)
 #  include <pipeDrv.h>
 #endif
@@ -174,14 +178,170 @@ QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
 {
     if (Q_UNLIKELY(threadPipe.init() == false))
         qFatal("QEventDispatcherUNIXPrivate(): Cannot continue without a thread pipe");
+
+#ifdef EPOLL_CLOEXEC
+    if (epollRequested()) {
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        if (epollFd == -1)
+            qErrnoWarning("QEventDispatcherUNIXPrivate: Unable to create epoll instance, using poll()");
+    }
+#endif
 }
 
 QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
 {
+    if (epollFd >= 0)
+        close(epollFd);
+
     // cleanup timers
     timerList.clearTimers();
 }
 
+bool QEventDispatcherUNIXPrivate::epollRequested()
+{
+#ifdef EPOLL_CLOEXEC
+    return qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_EPOLL") > 0;
+#else
+    return false;
+#endif
+}
+
+static void markPendingSocketNotifier(QEventDispatcherUNIXPrivate *d, int fd,
+                                      const QSocketNotifierSetUNIX &sn_set, short revents);
+
+#ifdef EPOLL_CLOEXEC
+// The low half of epoll_event::data is the descriptor, the high half the
+// serial number of its registration: events from a registration we no
+// longer know about (for instance, of a file that is kept open through a
+// dup()ed descriptor after the notifier's descriptor was closed and its
+// number reused) can then be told apart from those for the current one.
+static inline quint64 epollData(int fd, quint32 serial)
+{
+    return (quint64(serial) << 32) | quint32(fd);
+}
+
+// Returns whether \a fd still refers to the file it was registered with
+static bool isSameFile(int fd, const QEventDispatcherUNIXPrivate::EpollRegistration &registration)
+{
+    QT_STATBUF st;
+    return QT_FSTAT(fd, &st) == 0 && quint64(st.st_dev) == registration.device
+            && quint64(st.st_ino) == registration.inode;
+}
+
+static bool addToEpoll(int epollFd, int fd, quint32 serial, short events)
+{
+    epoll_event ev = {};
+    ev.events = quint32(events);
+    ev.data.u64 = epollData(fd, serial);
+    return epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) == 0;
+}
+#endif
+
+void QEventDispatcherUNIXPrivate::updateEpollInterest(int fd, short oldEvents, short newEvents)
+{
+#ifdef EPOLL_CLOEXEC
+    if (epollFd < 0 || oldEvents == newEvents)
+        return;
+
+    if (epollFallbackFds.contains(fd)) {
+        if (newEvents == 0)
+            epollFallbackFds.removeOne(fd);
+        return;
+    }
+
+    auto it = epollRegistrations.find(fd);
+    if (newEvents == 0) {
+        // Forget the registration even if this fails: if the descriptor was
+        // closed before the notifier was disabled, closing it already removed
+        // it from the set, or any remaining event is dropped as stale.
+        epoll_event ev = {};
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, &ev);
+        if (it != epollRegistrations.end())
+            epollRegistrations.erase(it);
+        return;
+    }
+
+    if (it != epollRegistrations.end()) {
+        epoll_event ev = {};
+        ev.events = quint32(newEvents);
+        ev.data.u64 = epollData(fd, it->serial);
+        if (epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &ev) == 0)
+            return;
+        // closed and reopened meanwhile: register the new file
+        epollRegistrations.erase(it);
+    }
+
+    // epoll rejects regular files (EPERM) and invalid descriptors (EBADF);
+    // poll() those instead so they keep reporting readiness or POLLNVAL
+    QT_STATBUF st;
+    const quint32 serial = ++epollSerial;
+    if (QT_FSTAT(fd, &st) == -1 || !addToEpoll(epollFd, fd, serial, newEvents)) {
+        epollFallbackFds.append(fd);
+        return;
+    }
+    epollRegistrations.insert(fd, { serial, st.st_dev, st.st_ino });
+#else
+    Q_UNUSED(fd);
+    Q_UNUSED(oldEvents);
+    Q_UNUSED(newEvents);
+#endif
+}
+
+/*
+    Replaces the epoll instance with a new one holding only the current
+    registrations. That's the only way to get rid of a registration whose
+    file is still open, but not under the descriptor it was registered with.
+*/
+void QEventDispatcherUNIXPrivate::rebuildEpollSet()
+{
+#ifdef EPOLL_CLOEXEC
+    const int newFd = epoll_create1(EPOLL_CLOEXEC);
+    if (newFd == -1) {
+        qErrnoWarning("QEventDispatcherUNIXPrivate: Unable to recreate epoll instance");
+        return;
+    }
+    close(epollFd);
+    epollFd = newFd;
+
+    for (auto it = epollRegistrations.begin(); it != epollRegistrations.end(); ) {
+        const int fd = it.key();
+        if (addToEpoll(epollFd, fd, it->serial, socketNotifiers.value(fd).events())) {
+            ++it;
+        } else {
+            epollFallbackFds.append(fd);
+            it = epollRegistrations.erase(it);
+        }
+    }
+#endif
+}
+
+/*
+    Closing a descriptor silently removes it from the epoll set, where poll()
+    reports POLLNVAL for it. So every second, check that the registered
+    descriptors still refer to the files they were registered with, and
+    disable the notifiers of those that don't, like the poll() path does.
+*/
+void QEventDispatcherUNIXPrivate::checkEpollDescriptors()
+{
+#ifdef EPOLL_CLOEXEC
+    if (!epollCheckDeadline.hasExpired())
+        return;
+    epollCheckDeadline.setRemainingTime(EpollCheckInterval);
+
+    QVarLengthArray<int, 16> invalid;
+    for (auto it = epollRegistrations.cbegin(); it != epollRegistrations.cend(); ++it) {
+        if (!isSameFile(it.key(), *it))
+            invalid.append(it.key());
+    }
+
+    for (int fd : std::as_const(invalid)) {
+        auto it = socketNotifiers.constFind(fd);
+        if (it != socketNotifiers.cend())
+            markPendingSocketNotifier(this, fd, *it, POLLNVAL);
+    }
+#endif
+}
+
 void QEventDispatcherUNIXPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
 {
     Q_ASSERT(notifier);
@@ -197,44 +357,87 @@ int QEventDispatcherUNIXPrivate::activateTimers()
     return timerList.activateTimers();
 }
 
+static void markPendingSocketNotifier(QEventDispatcherUNIXPrivate *d, int fd,
+                                      const QSocketNotifierSetUNIX &sn_set, short revents)
+{
+    static const struct {
+        QSocketNotifier::Type type;
+        short flags;
+    } notifiers[] = {
+        { QSocketNotifier::Read,      POLLIN  | POLLHUP | POLLERR },
+        { QSocketNotifier::Write,     POLLOUT | POLLHUP | POLLERR },
+        { QSocketNotifier::Exception, POLLPRI | POLLHUP | POLLERR }
+    };
+
+    for (const auto &n : notifiers) {
+        QSocketNotifier *notifier = sn_set.notifiers[n.type];
+
+        if (!notifier)
+            continue;
+
+        if (revents & POLLNVAL) {
+            qWarning("QSocketNotifier: Invalid socket %d with type %s, disabling...",
+                     fd, socketType(n.type));
+            notifier->setEnabled(false);
+        }
+
+        if (revents & n.flags)
+            d->setSocketNotifierPending(notifier);
+    }
+}
+
 void QEventDispatcherUNIXPrivate::markPendingSocketNotifiers()
 {
     for (const pollfd &pfd : std::as_const(pollfds)) {
         if (pfd.fd < 0 || pfd.revents == 0)
             continue;
 
+        if (pfd.fd == epollFd) {
+            markPendingEpollNotifiers();
+            continue;
+        }
+
         auto it = socketNotifiers.find(pfd.fd);
         Q_ASSERT(it != socketNotifiers.end());
 
-        const QSocketNotifierSetUNIX &sn_set = it.value();
-
-        static const struct {
-            QSocketNotifier::Type type;
-            short flags;
-        } notifiers[] = {
-            { QSocketNotifier::Read,      POLLIN  | POLLHUP | POLLERR },
-            { QSocketNotifier::Write,     POLLOUT | POLLHUP | POLLERR },
-            { QSocketNotifier::Exception, POLLPRI | POLLHUP | POLLERR }
-        };
-
-        for (const auto &n : notifiers) {
-            QSocketNotifier *notifier = sn_set.notifiers[n.type];
-
-            if (!notifier)
-                continue;
+        markPendingSocketNotifier(this, it.key(), it.value(), pfd.revents);
+    }
 
-            if (pfd.revents & POLLNVAL) {
-                qWarning("QSocketNotifier: Invalid socket %d with type %s, disabling...",
-                         it.key(), socketType(n.type));
-                notifier->setEnabled(false);
-            }
+    pollfds.clear();
+}
 
-            if (pfd.revents & n.flags)
-                setSocketNotifierPending(notifier);
+void QEventDispatcherUNIXPrivate::markPendingEpollNotifiers()
+{
+#ifdef EPOLL_CLOEXEC
+    static_assert(EPOLLIN == POLLIN && EPOLLOUT == POLLOUT && EPOLLPRI == POLLPRI
+                  && EPOLLERR == POLLERR && EPOLLHUP == POLLHUP);
+
+    // The epoll descriptor was reported readable by qt_safe_poll(), so this
+    // does not block. Level-triggered: anything beyond the batch is picked up
+    // on the next pass.
+    epoll_event events[256];
+    const int n = epoll_wait(epollFd, events, int(std::size(events)), 0);
+    bool stale = false;
+    for (int i = 0; i < n; ++i) {
+        const int fd = int(quint32(events[i].data.u64));
+        const quint32 serial = quint32(events[i].data.u64 >> 32);
+        auto reg = epollRegistrations.constFind(fd);
+        if (reg == epollRegistrations.cend() || reg->serial != serial) {
+            // a registration that outlived its descriptor; being
+            // level-triggered, it would keep firing until it's gone
+            stale = true;
+            continue;
         }
+        short revents = short(events[i].events);
+        // A hangup may also mean that the descriptor was closed under us:
+        // warn about and disable the notifiers then, as poll() would
+        if ((revents & POLLHUP) && !isSameFile(fd, *reg))
+            revents = POLLNVAL;
+        markPendingSocketNotifier(this, fd, socketNotifiers.value(fd), revents);
     }
-
-    pollfds.clear();
+    if (stale)
+        rebuildEpollSet();
+#endif
 }
 
 int QEventDispatcherUNIXPrivate::activateSocketNotifiers()
@@ -354,12 +557,14 @@ void QEventDispatcherUNIX::registerSocketNotifier(QSocketNotifier *notifier)
 
     Q_D(QEventDispatcherUNIX);
     QSocketNotifierSetUNIX &sn_set = d->socketNotifiers[sockfd];
+    const short oldEvents = sn_set.events();
 
     if (sn_set.notifiers[type] && sn_set.notifiers[type] != notifier)
         qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
                  Q_FUNC_INFO, sockfd, socketType(type));
 
     sn_set.notifiers[type] = notifier;
+    d->updateEpollInterest(sockfd, oldEvents, sn_set.events());
 }
 
 void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
@@ -398,7 +603,9 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
         return;
     }
 
+    const short oldEvents = sn_set.events();
     sn_set.notifiers[type] = nullptr;
+    d->updateEpollInterest(sockfd, oldEvents, sn_set.events());
 
     if (sn_set.isEmpty())
         d->socketNotifiers.erase(i);
@@ -443,12 +650,29 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
         // ensures the code in the do-while loop in qt_safe_poll runs at least once.
     }
 
+    if (d->epollFd >= 0 && include_notifiers && !d->epollRegistrations.isEmpty()) {
+        d->checkEpollDescriptors();
+        if (d->epollCheckDeadline < deadline)
+            deadline = d->epollCheckDeadline;
+    }
+
     d->pollfds.clear();
-    d->pollfds.reserve(1 + (include_notifiers ? d->socketNotifiers.size() : 0));
+    if (d->epollFd >= 0) {
+        // the epoll set itself is kept up to date by (un)registerSocketNotifier()
+        d->pollfds.reserve(2 + (include_notifiers ? d->epollFallbackFds.size() : 0));
+
+        if (include_notifiers) {
+            d->pollfds.append(qt_make_pollfd(d->epollFd, POLLIN));
+            for (int fd : std::as_const(d->epollFallbackFds))
+                d->pollfds.append(qt_make_pollfd(fd, d->socketNotifiers.value(fd).events()));
+        }
+    } else {
+        d->pollfds.reserve(1 + (include_notifiers ? d->socketNotifiers.size() : 0));
 
-    if (include_notifiers)
-        for (auto it = d->socketNotifiers.cbegin(); it != d->socketNotifiers.cend(); ++it)
-            d->pollfds.append(qt_make_pollfd(it.key(), it.value().events()));
+        if (include_notifiers)
+            for (auto it = d->socketNotifiers.cbegin(); it != d->socketNotifiers.cend(); ++it)
+                d->pollfds.append(qt_make_pollfd(it.key(), it.value().events()));
+    }
 
     // This must be last, as it's popped off the end below
     d->pollfds.append(d->threadPipe.prepare());
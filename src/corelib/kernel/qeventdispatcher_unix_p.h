@@ -100,12 +100,36 @@ public:
     int activateTimers();
 
     void markPendingSocketNotifiers();
+    void markPendingEpollNotifiers();
     int activateSocketNotifiers();
     void setSocketNotifierPending(QSocketNotifier *notifier);
 
+    static bool epollRequested();
+    void updateEpollInterest(int fd, short oldEvents, short newEvents);
+    void rebuildEpollSet();
+    void checkEpollDescriptors();
+
     QThreadPipe threadPipe;
     QList<pollfd> pollfds;
 
+    // Linux only, opt-in via QT_EVENT_DISPATCHER_EPOLL: a persistent interest
+    // set kept in sync by (un)registerSocketNotifier(), so that the per-pass
+    // cost no longer depends on the number of registered notifiers.
+    // Descriptors epoll refuses (e.g. regular files) are poll()ed as before.
+    int epollFd = -1;
+    QList<int> epollFallbackFds;
+
+    // the file each registered descriptor referred to when it was added
+    struct EpollRegistration {
+        quint32 serial;
+        quint64 device;
+        quint64 inode;
+    };
+    QHash<int, EpollRegistration> epollRegistrations;
+    quint32 epollSerial = 0;
+    static constexpr std::chrono::seconds EpollCheckInterval{1};
+    QDeadlineTimer epollCheckDeadline;
+
     QHash<int, QSocketNotifierSetUNIX> socketNotifiers;
     QList<QSocketNotifier *> pendingNotifiers;
 
@@ -58,6 +58,7 @@
 
 #include <new>
 #include <cstring>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -97,12 +98,42 @@ struct QMetaTypeCustomRegistry
     }
 #endif
 
+    ~QMetaTypeCustomRegistry() { delete registry.loadRelaxed(); }
+
+    // The types by id, read without locking. When it's full, the array is
+    // replaced by a larger copy, and the old one is kept until we're
+    // destroyed, as it may still be in use.
+    struct Registry
+    {
+        explicit Registry(qsizetype capacity)
+            : capacity(capacity),
+              types(new QAtomicPointer<const QtPrivate::QMetaTypeInterface>[capacity])
+        {}
+
+        qsizetype capacity;
+        std::unique_ptr<QAtomicPointer<const QtPrivate::QMetaTypeInterface>[]> types;
+        std::unique_ptr<Registry> previous;
+    };
+
     QReadWriteLock lock;
-    QList<const QtPrivate::QMetaTypeInterface *> registry;
+    QAtomicPointer<Registry> registry;
+    // number of types in registry, including unregistered ones
+    int registrySize = 0;
     QHash<QByteArray, const QtPrivate::QMetaTypeInterface *> aliases;
     // index of first empty (unregistered) type in registry, if any.
     int firstEmpty = 0;
 
+    Registry *growRegistry()
+    {
+        Registry *old = registry.loadRelaxed();
+        auto r = std::make_unique<Registry>(old ? old->capacity * 2 : 64);
+        for (int i = 0; i < registrySize; ++i)
+            r->types[i].storeRelaxed(old->types[i].loadRelaxed());
+        r->previous.reset(old);
+        registry.storeRelease(r.get());
+        return r.release();
+    }
+
     int registerCustomType(const QtPrivate::QMetaTypeInterface *cti)
     {
         // we got here because cti->typeId is 0, so this is a custom meta type
@@ -123,17 +154,17 @@ struct QMetaTypeCustomRegistry
                 return id;
             }
             aliases[name] = ti;
-            int size = registry.size();
-            while (firstEmpty < size && registry[firstEmpty])
-                ++firstEmpty;
-            if (firstEmpty < size) {
-                registry[firstEmpty] = ti;
+            Registry *r = registry.loadRelaxed();
+            while (firstEmpty < registrySize && r->types[firstEmpty].loadRelaxed())
                 ++firstEmpty;
-            } else {
-                registry.append(ti);
-                firstEmpty = registry.size();
+            if (firstEmpty == registrySize) {
+                if (!r || registrySize == r->capacity)
+                    r = growRegistry();
+                ++registrySize;
             }
-            ti->typeId.storeRelaxed(firstEmpty + QMetaType::User);
+            ti->typeId.storeRelaxed(firstEmpty + 1 + QMetaType::User);
+            r->types[firstEmpty].storeRelease(ti);
+            ++firstEmpty;
         }
         if (ti->legacyRegisterOp)
             ti->legacyRegisterOp();
@@ -147,20 +178,24 @@ struct QMetaTypeCustomRegistry
         Q_ASSERT(id > QMetaType::User);
         QWriteLocker l(&lock);
         int idx = id - QMetaType::User - 1;
-        auto &ti = registry[idx];
+        auto &entry = registry.loadRelaxed()->types[idx];
+        auto ti = entry.loadRelaxed();
 
         // We must unregister all names.
         aliases.removeIf([ti] (const auto &kv) { return kv.value() == ti; });
 
-        ti = nullptr;
+        entry.storeRelease(nullptr);
 
         firstEmpty = std::min(firstEmpty, idx);
     }
 
     const QtPrivate::QMetaTypeInterface *getCustomType(int id)
     {
-        QReadLocker l(&lock);
-        return registry.value(id - QMetaType::User - 1);
+        const qsizetype idx = qsizetype(id) - QMetaType::User - 1;
+        const Registry *r = registry.loadAcquire();
+        if (!r || idx < 0 || idx >= r->capacity)
+            return nullptr;
+        return r->types[idx].loadAcquire();
     }
 };
 
@@ -956,13 +991,44 @@ bool QMetaTypeModuleHelper::convert(const void *, int, void *, int) const
 
 
 
-static const struct { const char * typeName; int typeNameLength; int type; } types[] = {
+static constexpr struct { const char * typeName; int typeNameLength; int type; } types[] = {
     QT_FOR_EACH_STATIC_TYPE(QT_ADD_STATIC_METATYPE)
     QT_FOR_EACH_STATIC_ALIAS_TYPE(QT_ADD_STATIC_METATYPE_ALIASES_ITER)
     QT_ADD_STATIC_METATYPE(_, QMetaTypeId2<qreal>::MetaType, qreal)
     {nullptr, 0, QMetaType::UnknownType}
 };
 
+// A hash table of the names in types[], built by the compiler
+struct QStaticTypeNameTable
+{
+    static constexpr uint Size = 512;
+    // index in types[] plus one, or zero if unused
+    quint16 entries[Size];
+
+    static constexpr uint hash(const char *name, int length) noexcept
+    {
+        // FNV-1a
+        uint h = 2166136261U;
+        for (int i = 0; i < length; ++i)
+            h = (h ^ uchar(name[i])) * 16777619U;
+        return h;
+    }
+
+    constexpr QStaticTypeNameTable() noexcept
+        : entries{}
+    {
+        // insertion order is lookup order, so the first of equal names wins
+        for (int i = 0; types[i].typeName; ++i) {
+            uint slot = hash(types[i].typeName, types[i].typeNameLength) % Size;
+            while (entries[slot])
+                slot = (slot + 1) % Size;
+            entries[slot] = quint16(i + 1);
+        }
+    }
+};
+static_assert(std::size(types) * 2 <= QStaticTypeNameTable::Size);
+static constexpr QStaticTypeNameTable staticTypeNames;
+
 // NOLINTNEXTLINE(cppcoreguidelines-virtual-class-destructor): this is not a base class
 static constexpr struct : QMetaTypeModuleHelper
 {
@@ -2753,12 +2819,14 @@ bool QtPrivate::hasRegisteredMutableViewFunctionToIterableMetaAssociation(QMetaT
 */
 static inline int qMetaTypeStaticType(const char *typeName, int length)
 {
-    int i = 0;
-    while (types[i].typeName && ((length != types[i].typeNameLength)
-                                 || memcmp(typeName, types[i].typeName, length))) {
-        ++i;
+    using Table = QStaticTypeNameTable;
+    uint slot = Table::hash(typeName, length) % Table::Size;
+    for ( ; staticTypeNames.entries[slot]; slot = (slot + 1) % Table::Size) {
+        const auto &entry = types[staticTypeNames.entries[slot] - 1];
+        if (length == entry.typeNameLength && !memcmp(typeName, entry.typeName, length))
+            return entry.type;
     }
-    return types[i].type;
+    return QMetaType::UnknownType;
 }
 
 /*
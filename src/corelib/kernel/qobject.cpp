@@ -31,6 +31,7 @@
 
 #include <private/qorderedmutexlocker_p.h>
 #include <private/qhooks_p.h>
+#include <private/qstringatom_p.h>
 #include <qtcore_tracepoints_p.h>
 
 #include <new>
@@ -126,7 +127,14 @@ static int *queuedConnectionTypes(const QArgumentType *argumentTypes, int argc)
     return types.release();
 }
 
-Q_CONSTINIT static QBasicMutex _q_ObjectMutexPool[131];
+// The mutexes outlive the objects, so that a thread can wait for the mutex
+// of an object that another one is destroying. Each is on its own cache
+// line, so that threads locking different ones don't slow each other down.
+struct alignas(64) QSignalSlotMutex
+{
+    QBasicMutex mutex;
+};
+Q_CONSTINIT static QSignalSlotMutex _q_ObjectMutexPool[251];
 
 /**
  * \internal
@@ -134,7 +142,7 @@ Q_CONSTINIT static QBasicMutex _q_ObjectMutexPool[131];
  */
 static inline QBasicMutex *signalSlotLock(const QObject *o)
 {
-    return &_q_ObjectMutexPool[uint(quintptr(o)) % sizeof(_q_ObjectMutexPool)/sizeof(QBasicMutex)];
+    return &_q_ObjectMutexPool[uint(quintptr(o)) % std::size(_q_ObjectMutexPool)].mutex;
 }
 
 void (*QAbstractDeclarativeData::destroyed)(QAbstractDeclarativeData *, QObject *) = nullptr;
@@ -1709,6 +1717,23 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
     }
     d_func()->setThreadData_helper(currentData, targetData, bindingStatus);
 
+    // Take over the events posted to the moved objects without the lock by
+    // threads that had not seen the new thread data yet.
+    currentData->postEventList.waitForProducers();
+    currentData->postEventList.takeIncomingEvents();
+    int eventsMoved = 0;
+    for (const QPostEvent &pe : std::as_const(currentData->postEventList)) {
+        if (pe.event && QObjectPrivate::get(pe.receiver)->threadData.loadRelaxed() == targetData) {
+            targetData->postEventList.addEvent(pe);
+            const_cast<QPostEvent &>(pe).event = nullptr;
+            ++eventsMoved;
+        }
+    }
+    if (eventsMoved > 0 && targetData->hasEventDispatcher()) {
+        targetData->canWait = false;
+        targetData->eventDispatcher.loadRelaxed()->wakeUp();
+    }
+
     locker.unlock();
 
     // now currentData can commit suicide if it wants to
@@ -3615,6 +3640,9 @@ QObjectPrivate::Connection *QMetaObjectPrivate::connect(const QObject *sender,
     const bool isSingleShot = type & Qt::SingleShotConnection;
     type &= ~Qt::SingleShotConnection;
 
+    const bool isCoalesced = type & Qt::CoalescedConnection;
+    type &= ~Qt::CoalescedConnection;
+
     Q_ASSERT(type >= 0);
     Q_ASSERT(type <= 3);
 
@@ -3632,6 +3660,7 @@ QObjectPrivate::Connection *QMetaObjectPrivate::connect(const QObject *sender,
     c->argumentTypes.storeRelaxed(types);
     c->callFunction = callFunction;
     c->isSingleShot = isSingleShot;
+    c->isCoalesced = isCoalesced;
 
     QObjectPrivate::get(s)->addConnection(signal_index, c.get());
 
@@ -3926,6 +3955,47 @@ private:
     QtPrivate::SlotObjUniquePtr m_slotObject;
 };
 
+/*!
+    \internal
+    The queued call of a Qt::CoalescedConnection. Until it is made, the
+    emissions of the signal update its arguments instead of posting new
+    events; see queued_activate().
+ */
+class QCoalescedMetaCallEvent : public QMetaCallEvent
+{
+public:
+    template <typename...Args>
+    QCoalescedMetaCallEvent(QObjectPrivate::Connection *c, QBasicMutex *lock, Args &&...args)
+        : QMetaCallEvent(std::forward<Args>(args)...), m_connection(c), m_lock(lock)
+    {
+        m_connection->ref();
+    }
+
+    ~QCoalescedMetaCallEvent() override
+    {
+        detach();
+        m_connection->deref();
+    }
+
+    void placeMetaCall(QObject *object) override
+    {
+        detach();
+        QMetaCallEvent::placeMetaCall(object);
+    }
+
+private:
+    // stops later emissions from changing the arguments
+    void detach()
+    {
+        QMutexLocker locker(m_lock);
+        if (m_connection->coalescedEvent == this)
+            m_connection->coalescedEvent = nullptr;
+    }
+
+    QObjectPrivate::Connection *m_connection;
+    QBasicMutex *m_lock;
+};
+
 /*!
     \internal
 
@@ -3951,19 +4021,55 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
     while (argumentTypes[nargs - 1])
         ++nargs;
 
+    // Copy the arguments before taking the lock. For a coalesced call whose
+    // previous event is still pending, they are swapped into that event, and
+    // the old ones destroyed after unlocking.
+    const bool coalesce = c->isCoalesced && !c->isSingleShot;
+    QVarLengthArray<void *, 8> argCopies;
+    const auto destroyArgCopies = [&] {
+        for (int n = 1; n < nargs; ++n)
+            QMetaType(argumentTypes[n - 1]).destroy(argCopies[n]);
+    };
+    if (coalesce) {
+        argCopies.resize(nargs);
+        argCopies[0] = nullptr;
+        for (int n = 1; n < nargs; ++n)
+            argCopies[n] = QMetaType(argumentTypes[n - 1]).create(argv[n]);
+    }
+
     QMutexLocker locker(signalSlotLock(c->receiver.loadRelaxed()));
     QObject *receiver = c->receiver.loadRelaxed();
     if (!receiver) {
         // the connection has been disconnected before we got the lock
+        locker.unlock();
+        if (coalesce)
+            destroyArgCopies();
+        return;
+    }
+
+    if (coalesce && c->coalescedEvent) {
+        // the previous call hasn't been made yet: make it with these arguments
+        std::swap_ranges(argCopies.begin() + 1, argCopies.end(), c->coalescedEvent->args() + 1);
+        locker.unlock();
+        destroyArgCopies();
         return;
     }
 
     SlotObjectGuard slotObjectGuard { c->isSlotObject ? c->slotObj : nullptr };
     locker.unlock();
 
-    QMetaCallEvent *ev = c->isSlotObject ?
-        new QMetaCallEvent(c->slotObj, sender, signal, nargs) :
-        new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction, sender, signal, nargs);
+    QMetaCallEvent *ev;
+    if (coalesce) {
+        QBasicMutex *lock = signalSlotLock(receiver);
+        ev = c->isSlotObject ?
+            new QCoalescedMetaCallEvent(c, lock, c->slotObj, sender, signal, nargs) :
+            new QCoalescedMetaCallEvent(c, lock, c->method_offset, c->method_relative,
+                                        c->callFunction, sender, signal, nargs);
+    } else {
+        ev = c->isSlotObject ?
+            new QMetaCallEvent(c->slotObj, sender, signal, nargs) :
+            new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction, sender, signal, nargs);
+    }
 
     void **args = ev->args();
     QMetaType *types = ev->types();
@@ -3976,7 +4082,7 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
             types[n] = QMetaType(argumentTypes[n - 1]);
 
         for (int n = 1; n < nargs; ++n)
-            args[n] = types[n].create(argv[n]);
+            args[n] = coalesce ? argCopies[n] : types[n].create(argv[n]);
     }
 
     if (c->isSingleShot && !QObjectPrivate::removeConnection(c)) {
@@ -3992,6 +4098,17 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         return;
     }
 
+    if (coalesce) {
+        if (QMetaCallEvent *pending = c->coalescedEvent) {
+            // another thread posted one while we were unlocked
+            std::swap_ranges(ev->args() + 1, ev->args() + nargs, pending->args() + 1);
+            locker.unlock();
+            delete ev;
+            return;
+        }
+        c->coalescedEvent = ev;
+    }
+
     QCoreApplication::postEvent(receiver, ev);
 }
 
@@ -4044,6 +4161,8 @@ void doActivate(QObject *sender, int signal_index, void **argv)
 
     Qt::HANDLE currentThreadId = QThread::currentThreadId();
     bool inSenderThread = currentThreadId == QObjectPrivate::get(sender)->threadData.loadRelaxed()->threadId.loadRelaxed();
+    // only compared with the receivers' thread data, see below
+    const QThreadData *currentThreadData = inSenderThread ? nullptr : QThreadData::current(false);
 
     // We need to check against the highest connection id to ensure that signals added
     // during the signal emission are not emitted in this emission.
@@ -4066,9 +4185,10 @@ void doActivate(QObject *sender, int signal_index, void **argv)
             if (inSenderThread) {
                 receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
             } else {
-                // need to lock before reading the threadId, because moveToThread() could interfere
-                QMutexLocker lock(signalSlotLock(receiver));
-                receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
+                // moveToThread() could release td at any time, so don't
+                // dereference it: compare it with the current thread's data,
+                // which is the only one with the current thread's id.
+                receiverInSameThread = td == currentThreadData;
             }
 
 
@@ -4288,7 +4408,8 @@ bool QObject::doSetProperty(const char *name, const QVariant *lvalue, QVariant *
             d->extraData->propertyValues.removeAt(idx);
         } else {
             if (idx == -1) {
-                d->extraData->propertyNames.append(name);
+                // Share the name with all other objects having this property
+                d->extraData->propertyNames.append(QByteArrayAtom(name).string());
                 if (rvalue)
                     d->extraData->propertyValues.append(std::move(*rvalue));
                 else
@@ -5287,6 +5408,9 @@ QMetaObject::Connection QObjectPrivate::connectImpl(const QObject *sender, int s
     const bool isSingleShot = type & Qt::SingleShotConnection;
     type &= ~Qt::SingleShotConnection;
 
+    const bool isCoalesced = type & Qt::CoalescedConnection;
+    type &= ~Qt::CoalescedConnection;
+
     Q_ASSERT(type >= 0);
     Q_ASSERT(type <= 3);
 
@@ -5305,6 +5429,7 @@ QMetaObject::Connection QObjectPrivate::connectImpl(const QObject *sender, int s
         c->ownArgumentTypes = false;
     }
     c->isSingleShot = isSingleShot;
+    c->isCoalesced = isCoalesced;
 
     QObjectPrivate::get(s)->addConnection(signal_index, c.get());
     QMetaObject::Connection ret(c.release());
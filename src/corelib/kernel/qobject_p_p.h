@@ -93,6 +93,10 @@ struct QObjectPrivate::Connection : public ConnectionOrSignalVector
     ushort isSlotObject : 1;
     ushort ownArgumentTypes : 1;
     ushort isSingleShot : 1;
+    ushort isCoalesced : 1;
+    // the queued call of a coalesced connection that hasn't been made yet,
+    // protected by the receiver's signal/slot lock
+    QMetaCallEvent *coalescedEvent = nullptr;
     Connection() : ownArgumentTypes(true) { }
     ~Connection();
     int method() const
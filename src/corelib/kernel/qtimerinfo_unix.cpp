@@ -4,6 +4,8 @@
 
 #include <qelapsedtimer.h>
 #include <qcoreapplication.h>
+#include <qhash.h>
+#include <qvarlengtharray.h>
 
 #include "private/qcore_unix_p.h"
 #include "private/qtimerinfo_unix_p.h"
@@ -25,14 +27,320 @@ Q_CORE_EXPORT bool qt_disable_lowpriority_timers=false;
  * timerBitVec array is used for keeping track of timer identifiers.
  */
 
-QTimerInfoList::QTimerInfoList() = default;
-
 steady_clock::time_point QTimerInfoList::updateCurrentTime() const
 {
     currentTime = steady_clock::now();
     return currentTime;
 }
 
+template <typename TimePoint>
+static qint64 wheelTickOf(TimePoint timePoint)
+{
+    return floor<milliseconds>(timePoint.time_since_epoch()).count();
+}
+
+static bool byTimeout(const QTimerInfo *a, const QTimerInfo *b)
+{ return a->timeout < b->timeout; };
+
+/*
+ * The timers are kept in a hierarchical timing wheel, so that starting,
+ * stopping and restarting them doesn't depend on how many there are. Each
+ * level has 64 slots; a slot of level 0 holds the timers that expire in one
+ * millisecond, and a slot of level N spans all the slots of level N - 1. A
+ * timer goes in the lowest level where its timeout and the current tick
+ * (wheelTick) are in the same slot of the level above, so every timer of a
+ * level expires before any timer of the next one. As the current tick
+ * advances, the timers in the slots it reaches move down a level, until they
+ * are in the current slot of level 0 and due. Each timer moves at most once
+ * per level.
+ *
+ * The wheel is only used if the QT_EVENT_DISPATCHER_TIMER_WHEEL environment
+ * variable is set; otherwise the timers are kept in a list sorted by timeout.
+ */
+
+class QTimerWheel
+{
+public:
+    void setCurrentTime(steady_clock::time_point now);
+    void insert(QTimerInfo *t);
+    void remove(QTimerInfo *t);
+    void clear();
+    std::optional<QTimerInfo::TimePoint> firstTimeout(bool skipActive);
+    template <typename Container>
+    void appendExpired(steady_clock::time_point now, Container &expired) const;
+
+    QHash<Qt::TimerId, QTimerInfo *> timers;
+
+private:
+    static constexpr int WheelBits = 6;
+    static constexpr int WheelSlots = 1 << WheelBits;
+    static constexpr int WheelLevels = 6;
+    static constexpr int OverflowLevel = WheelLevels;   // beyond the last level
+    static constexpr int EarlyLevel = WheelLevels + 1;  // in earlyTimers
+
+    void advanceTo(qint64 tick);
+    QTimerInfo *takeSlot(int level, int slot);
+
+    QTimerInfo *slotLists[WheelLevels][WheelSlots] = {};
+    quint64 occupiedSlots[WheelLevels] = {};
+    QTimerInfo *overflow = nullptr;
+    // in milliseconds since the steady_clock epoch; wheelTick may be ahead
+    // of currentTick
+    qint64 currentTick = 0;
+    qint64 wheelTick = 0;
+    // timers that expire before wheelTick while it is ahead of the current
+    // time, sorted by timeout
+    QList<QTimerInfo *> earlyTimers;
+};
+
+// The slots from \a from to \a to, inclusive
+static constexpr quint64 slotRange(int from, int to)
+{
+    const quint64 upTo = to == 63 ? ~Q_UINT64_C(0) : (Q_UINT64_C(2) << to) - 1;
+    return upTo & ~((Q_UINT64_C(1) << from) - 1);
+}
+
+static_assert(slotRange(0, 0) == 1);
+static_assert(slotRange(0, 63) == ~Q_UINT64_C(0));
+static_assert(slotRange(2, 3) == 0xc);
+static_assert(slotRange(63, 63) == Q_UINT64_C(1) << 63);
+
+/*
+  Advances the wheel to \a now. The timers in the slots it goes past or into
+  move down a level, or to the current slot if they are due.
+*/
+void QTimerWheel::setCurrentTime(steady_clock::time_point now)
+{
+    currentTick = wheelTickOf(now);
+    advanceTo(currentTick);
+}
+
+/*
+  insert timer info into the wheel
+*/
+void QTimerWheel::insert(QTimerInfo *t)
+{
+    qint64 tick = wheelTickOf(t->timeout);
+    if (tick < wheelTick) {
+        if (wheelTick > currentTick) {
+            // The current tick was moved ahead by firstTimeout(), so this
+            // timer expires before anything in the wheel.
+            const auto it = std::upper_bound(earlyTimers.cbegin(), earlyTimers.cend(), t,
+                                             byTimeout);
+            earlyTimers.insert(it, t);
+            t->level = EarlyLevel;
+            return;
+        }
+        // already due: the current slot
+        tick = wheelTick;
+    }
+
+    const quint64 difference = quint64(tick ^ wheelTick);
+    int level = difference ? (63 - qCountLeadingZeroBits(difference)) / WheelBits : 0;
+
+    QTimerInfo **head = &overflow;
+    if (level < WheelLevels) {
+        t->slot = quint8((tick >> (level * WheelBits)) & (WheelSlots - 1));
+        head = &slotLists[level][t->slot];
+        occupiedSlots[level] |= Q_UINT64_C(1) << t->slot;
+    } else {
+        level = OverflowLevel;
+    }
+    t->level = quint8(level);
+
+    // append, so that timers with the same timeout fire in the order they were started
+    if (QTimerInfo *first = *head) {
+        t->next = first;
+        t->prev = first->prev;
+        first->prev->next = t;
+        first->prev = t;
+    } else {
+        t->next = t->prev = t;
+        *head = t;
+    }
+}
+
+void QTimerWheel::remove(QTimerInfo *t)
+{
+    if (t->level == EarlyLevel) {
+        auto it = std::lower_bound(earlyTimers.begin(), earlyTimers.end(), t, byTimeout);
+        while (*it != t)
+            ++it;
+        earlyTimers.erase(it);
+        return;
+    }
+
+    QTimerInfo **head = t->level == OverflowLevel ? &overflow : &slotLists[t->level][t->slot];
+    if (t->next == t) {
+        *head = nullptr;
+        if (t->level != OverflowLevel)
+            occupiedSlots[t->level] &= ~(Q_UINT64_C(1) << t->slot);
+    } else {
+        t->prev->next = t->next;
+        t->next->prev = t->prev;
+        if (*head == t)
+            *head = t->next;
+    }
+    t->next = t->prev = nullptr;
+}
+
+QTimerInfo *QTimerWheel::takeSlot(int level, int slot)
+{
+    occupiedSlots[level] &= ~(Q_UINT64_C(1) << slot);
+    return std::exchange(slotLists[level][slot], nullptr);
+}
+
+void QTimerWheel::advanceTo(qint64 tick)
+{
+    if (tick <= wheelTick)
+        return;
+    const qint64 oldTick = std::exchange(wheelTick, tick);
+
+    // Take out the timers in the slots the current tick went past or into;
+    // those may have to move down a level, or are due.
+    QVarLengthArray<QTimerInfo *, 64> moved;
+    auto take = [&moved](QTimerInfo *first) {
+        QTimerInfo *t = first;
+        do {
+            moved.append(t);
+            t = t->next;
+        } while (t != first);
+    };
+
+    for (int level = 0; level < WheelLevels; ++level) {
+        const int shift = level * WheelBits;
+        if ((oldTick >> shift) == (tick >> shift))
+            break; // nothing changes at this level or above it
+        quint64 occupied = ~Q_UINT64_C(0);
+        if ((oldTick >> (shift + WheelBits)) == (tick >> (shift + WheelBits))) {
+            occupied = slotRange(int((oldTick >> shift) & (WheelSlots - 1)),
+                              int((tick >> shift) & (WheelSlots - 1)));
+        }
+        occupied &= occupiedSlots[level];
+        while (occupied) {
+            take(takeSlot(level, qCountTrailingZeroBits(occupied)));
+            occupied &= occupied - 1;
+        }
+    }
+    if (overflow && (oldTick >> (WheelLevels * WheelBits)) != (tick >> (WheelLevels * WheelBits)))
+        take(std::exchange(overflow, nullptr));
+
+    for (QTimerInfo *t : std::as_const(moved))
+        insert(t);
+}
+
+void QTimerWheel::clear()
+{
+    for (auto &level : slotLists)
+        std::fill(std::begin(level), std::end(level), nullptr);
+    std::fill(std::begin(occupiedSlots), std::end(occupiedSlots), 0);
+    overflow = nullptr;
+    earlyTimers.clear();
+}
+
+/*
+    Returns the earliest timeout, skipping the timers being activated if
+    \a skipActive is true. The wheel must have been advanced to the current
+    time.
+*/
+std::optional<QTimerInfo::TimePoint> QTimerWheel::firstTimeout(bool skipActive)
+{
+    auto earliestIn = [skipActive](const QTimerInfo *first) {
+        std::optional<QTimerInfo::TimePoint> earliest;
+        const QTimerInfo *t = first;
+        do {
+            if (!(skipActive && t->activateRef) && (!earliest || t->timeout < *earliest))
+                earliest = t->timeout;
+            t = t->next;
+        } while (t != first);
+        return earliest;
+    };
+
+    for (const QTimerInfo *t : std::as_const(earlyTimers)) {
+        if (!(skipActive && t->activateRef))
+            return t->timeout;
+    }
+
+    forever {
+        for (quint64 occupied = occupiedSlots[0]; occupied; occupied &= occupied - 1) {
+            if (auto earliest = earliestIn(slotLists[0][qCountTrailingZeroBits(occupied)]))
+                return earliest;
+        }
+
+        int level = 1;
+        while (level < WheelLevels && !occupiedSlots[level])
+            ++level;
+        if (level == WheelLevels)
+            return overflow ? earliestIn(overflow) : std::nullopt;
+
+        // Nothing expires before the first occupied slot of this level
+        // starts, so move the current tick there, ahead of the current time:
+        // its timers move down a level, and eventually into a slot of level 0
+        // that gives the exact timeout. Each timer moves at most once per
+        // level anyway; and timers started until the current time catches up
+        // go in earlyTimers.
+        const int shift = level * WheelBits;
+        const qint64 blockStart = (wheelTick >> (shift + WheelBits)) << (shift + WheelBits);
+        advanceTo(blockStart + (qint64(qCountTrailingZeroBits(occupiedSlots[level])) << shift));
+    }
+}
+
+/*
+    Appends the timers that have expired at \a now to \a expired: those at
+    the front of earlyTimers, and those in the current slot of the first
+    level, unless the current tick is still ahead of the current time. The
+    wheel must have been advanced to \a now.
+*/
+template <typename Container>
+void QTimerWheel::appendExpired(steady_clock::time_point now, Container &expired) const
+{
+    for (QTimerInfo *t : std::as_const(earlyTimers)) {
+        if (t->timeout > now)
+            break;
+        expired.append(t);
+    }
+    QTimerInfo *first = slotLists[0][wheelTick & (WheelSlots - 1)];
+    if (first && wheelTick == currentTick) {
+        QTimerInfo *t = first;
+        do {
+            if (t->timeout <= now)
+                expired.append(t);
+            t = t->next;
+        } while (t != first);
+    }
+}
+
+QTimerInfoList::QTimerInfoList()
+    : QTimerInfoList(qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_TIMER_WHEEL") > 0)
+{
+}
+
+QTimerInfoList::QTimerInfoList(bool useTimingWheel)
+{
+    if (useTimingWheel)
+        wheel = std::make_unique<QTimerWheel>();
+}
+
+QTimerInfoList::~QTimerInfoList() = default;
+
+qsizetype QTimerInfoList::size() const
+{
+    return wheel ? wheel->timers.size() : timers.size();
+}
+
+void QTimerInfoList::clearTimers()
+{
+    if (wheel) {
+        qDeleteAll(wheel->timers);
+        wheel->timers.clear();
+        wheel->clear();
+        return;
+    }
+    qDeleteAll(timers);
+    timers.clear();
+}
+
+
 /*! \internal
     Updates the currentTime member to the current time, and returns \c true if
     the first timer's timeout is in the future (after currentTime).
@@ -41,19 +349,25 @@ steady_clock::time_point QTimerInfoList::updateCurrentTime() const
 */
 bool QTimerInfoList::hasPendingTimers()
 {
-    if (timers.isEmpty())
+    if (isEmpty())
         return false;
-    return updateCurrentTime() < timers.at(0)->timeout;
+    const steady_clock::time_point now = updateCurrentTime();
+    if (wheel) {
+        wheel->setCurrentTime(now);
+        return now < *wheel->firstTimeout(false);
+    }
+    return now < timers.at(0)->timeout;
 }
 
-static bool byTimeout(const QTimerInfo *a, const QTimerInfo *b)
-{ return a->timeout < b->timeout; };
-
 /*
   insert timer info into list
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
+    if (wheel) {
+        wheel->insert(ti);
+        return;
+    }
     timers.insert(std::upper_bound(timers.cbegin(), timers.cend(), ti, byTimeout),
                   ti);
 }
@@ -239,13 +553,21 @@ std::optional<QTimerInfoList::Duration> QTimerInfoList::timerWait()
 {
     steady_clock::time_point now = updateCurrentTime();
 
-    auto isWaiting = [](QTimerInfo *tinfo) { return !tinfo->activateRef; };
-    // Find first waiting timer not already active
-    auto it = std::find_if(timers.cbegin(), timers.cend(), isWaiting);
-    if (it == timers.cend())
+    std::optional<QTimerInfo::TimePoint> timeout;
+    if (wheel) {
+        wheel->setCurrentTime(now);
+        timeout = wheel->firstTimeout(true);
+    } else {
+        auto isWaiting = [](QTimerInfo *tinfo) { return !tinfo->activateRef; };
+        // Find first waiting timer not already active
+        auto it = std::find_if(timers.cbegin(), timers.cend(), isWaiting);
+        if (it != timers.cend())
+            timeout = (*it)->timeout;
+    }
+    if (!timeout)
         return std::nullopt;
 
-    Duration timeToWait = (*it)->timeout - now;
+    Duration timeToWait = *timeout - now;
     if (timeToWait > 0ns)
         return roundToMillisecond(timeToWait);
     return 0ms;
@@ -260,15 +582,19 @@ QTimerInfoList::Duration QTimerInfoList::remainingDuration(Qt::TimerId timerId)
 {
     const steady_clock::time_point now = updateCurrentTime();
 
-    auto it = findTimerById(timerId);
-    if (it == timers.cend()) {
+    const QTimerInfo *t = nullptr;
+    if (wheel) {
+        t = wheel->timers.value(timerId);
+    } else if (auto it = findTimerById(timerId); it != timers.cend()) {
+        t = *it;
+    }
+    if (!t) {
 #ifndef QT_NO_DEBUG
         qWarning("QTimerInfoList::timerRemainingTime: timer id %i not found", int(timerId));
 #endif
         return Duration::min();
     }
 
-    const QTimerInfo *t = *it;
     if (now < t->timeout) // time to wait
         return t->timeout - now;
     return 0ms;
@@ -314,11 +640,35 @@ void QTimerInfoList::registerTimer(Qt::TimerId timerId, QTimerInfoList::Duration
             t->timeout += 1s;
     }
 
+    if (wheel) {
+        wheel->setCurrentTime(currentTime);
+        wheel->timers.insert(timerId, t);
+    }
     timerInsert(t);
 }
 
+static void deactivate(QTimerInfo *t)
+{
+    if (t->activateRef)
+        *(t->activateRef) = nullptr;
+    if (t->pendingRef)
+        *(t->pendingRef) = nullptr;
+}
+
 bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 {
+    if (wheel) {
+        QTimerInfo *t = wheel->timers.take(timerId);
+        if (!t)
+            return false; // id not found
+
+        // set timer inactive
+        wheel->remove(t);
+        deactivate(t);
+        delete t;
+        return true;
+    }
+
     auto it = findTimerById(timerId);
     if (it == timers.cend())
         return false; // id not found
@@ -336,6 +686,23 @@ bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
+    if (wheel) {
+        bool removed = false;
+        for (auto it = wheel->timers.begin(); it != wheel->timers.end(); ) {
+            QTimerInfo *t = *it;
+            if (t->obj != object) {
+                ++it;
+                continue;
+            }
+            wheel->remove(t);
+            deactivate(t);
+            delete t;
+            it = wheel->timers.erase(it);
+            removed = true;
+        }
+        return removed;
+    }
+
     if (timers.isEmpty())
         return false;
 
@@ -359,6 +726,21 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
 
 auto QTimerInfoList::registeredTimers(QObject *object) const -> QList<TimerInfo>
 {
+    if (wheel) {
+        QVarLengthArray<const QTimerInfo *, 16> associated;
+        for (const QTimerInfo *t : std::as_const(wheel->timers)) {
+            if (t->obj == object)
+                associated.append(t);
+        }
+        std::sort(associated.begin(), associated.end(), byTimeout);
+
+        QList<TimerInfo> list;
+        list.reserve(associated.size());
+        for (const QTimerInfo *t : std::as_const(associated))
+            list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
+        return list;
+    }
+
     QList<TimerInfo> list;
     for (const auto &t : timers) {
         if (t->obj == object)
@@ -372,8 +754,10 @@ auto QTimerInfoList::registeredTimers(QObject *object) const -> QList<TimerInfo>
 */
 int QTimerInfoList::activateTimers()
 {
-    if (qt_disable_lowpriority_timers || timers.isEmpty())
+    if (qt_disable_lowpriority_timers || isEmpty())
         return 0; // nothing to do
+    if (wheel)
+        return activateWheelTimers();
 
     firstTimerInfo = nullptr;
 
@@ -438,4 +822,58 @@ int QTimerInfoList::activateTimers()
     return n_act;
 }
 
+int QTimerInfoList::activateWheelTimers()
+{
+    const steady_clock::time_point now = updateCurrentTime();
+    // qDebug() << "Thread" << QThread::currentThreadId() << "woken up at" << now;
+    wheel->setCurrentTime(now);
+
+    // Find out which timers have expired. Timers started from the events we
+    // send wait for the next pass.
+    QVarLengthArray<QTimerInfo *, 32> expired;
+    wheel->appendExpired(now, expired);
+    std::stable_sort(expired.begin(), expired.end(), byTimeout);
+    for (QTimerInfo *&t : expired) {
+        // a nested pass takes over the timers an outer one hasn't got to yet
+        if (t->pendingRef)
+            *(t->pendingRef) = nullptr;
+        t->pendingRef = &t;
+    }
+
+    int n_act = 0;
+    //fire the timers.
+    for (QTimerInfo *&pending : expired) {
+        // unregistered, or activated by a nested pass in the meantime
+        QTimerInfo *currentTimerInfo = std::exchange(pending, nullptr);
+        if (!currentTimerInfo)
+            continue;
+        currentTimerInfo->pendingRef = nullptr;
+
+        // determine next timeout time
+        wheel->remove(currentTimerInfo);
+        calculateNextTimeout(currentTimerInfo, now);
+        wheel->insert(currentTimerInfo);
+
+        if (currentTimerInfo->interval > 0ms)
+            n_act++;
+
+        // Send event, but don't allow it to recurse:
+        if (!currentTimerInfo->activateRef) {
+            currentTimerInfo->activateRef = &currentTimerInfo;
+
+            QTimerEvent e(qToUnderlying(currentTimerInfo->id));
+            QCoreApplication::sendEvent(currentTimerInfo->obj, &e);
+
+            // Storing currentTimerInfo's address in its activateRef allows the
+            // handling of that event to clear this local variable on deletion
+            // of the object it points to - if it didn't, clear activateRef:
+            if (currentTimerInfo)
+                currentTimerInfo->activateRef = nullptr;
+        }
+    }
+
+    // qDebug() << "Thread" << QThread::currentThreadId() << "activated" << n_act << "timers";
+    return n_act;
+}
+
 QT_END_NAMESPACE
@@ -21,6 +21,7 @@
 
 #include <sys/time.h> // struct timespec
 #include <chrono>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -40,14 +41,26 @@ struct QTimerInfo
     Qt::TimerType timerType; // - timer type
     QObject *obj = nullptr; // - object to receive event
     QTimerInfo **activateRef = nullptr; // - ref from activateTimers
+
+    // position in the timing wheel, if used: a circular list per slot
+    QTimerInfo *next = nullptr;
+    QTimerInfo *prev = nullptr;
+    quint8 level = 0;
+    quint8 slot = 0;
+    // entry in an activateTimers() pass that is about to send its event
+    QTimerInfo **pendingRef = nullptr;
 };
 
+class QTimerWheel;
+
 class Q_CORE_EXPORT QTimerInfoList
 {
 public:
     using Duration = QAbstractEventDispatcher::Duration;
     using TimerInfo = QAbstractEventDispatcher::TimerInfoV2;
     QTimerInfoList();
+    explicit QTimerInfoList(bool useTimingWheel);
+    ~QTimerInfoList();
 
     mutable std::chrono::steady_clock::time_point currentTime;
 
@@ -65,15 +78,11 @@ public:
     int activateTimers();
     bool hasPendingTimers();
 
-    void clearTimers()
-    {
-        qDeleteAll(timers);
-        timers.clear();
-    }
+    void clearTimers();
 
-    bool isEmpty() const { return timers.empty(); }
+    bool isEmpty() const { return size() == 0; }
 
-    qsizetype size() const { return timers.size(); }
+    qsizetype size() const;
 
     auto findTimerById(Qt::TimerId timerId) const
     {
@@ -83,10 +92,14 @@ public:
 
 private:
     std::chrono::steady_clock::time_point updateCurrentTime() const;
+    int activateWheelTimers();
 
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo = nullptr;
-    QList<QTimerInfo *> timers;
+    QList<QTimerInfo *> timers;     // sorted by timeout, unless wheel is used
+    // set if QT_EVENT_DISPATCHER_TIMER_WHEEL is set: keeps the timers instead
+    // of the sorted list
+    std::unique_ptr<QTimerWheel> wheel;
 };
 
 QT_END_NAMESPACE
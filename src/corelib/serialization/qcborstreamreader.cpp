@@ -532,6 +532,7 @@ public:
 
     QByteArray::size_type bufferStart = 0;
     bool corrupt = false;
+    bool referenceStrings = false;  // set by QCborValue::fromRawCbor()
 
     QCborStreamReaderPrivate(const QByteArray &data)
         : device(nullptr), buffer(data)
@@ -617,20 +618,31 @@ public:
             char *ptr;
             QByteArray *array;
             QString *string;
+            qsizetype *offset;
         };
-        enum Type { ByteArray = -1, String = -3, Utf8String = -5 };
+        enum Type { ByteArray = -1, String = -3, Utf8String = -5, Offset = -7 };
         qsizetype maxlen_or_type;
 
         ReadStringChunk(char *ptr, qsizetype maxlen) : ptr(ptr), maxlen_or_type(maxlen) {}
         ReadStringChunk(QByteArray *array, Type type = ByteArray) : array(array), maxlen_or_type(type) {}
         ReadStringChunk(QString *str) : string(str), maxlen_or_type(String) {}
+        ReadStringChunk(qsizetype *offset) : offset(offset), maxlen_or_type(Offset) {}
         bool isString() const { return maxlen_or_type == String; }
         bool isUtf8String() const { return maxlen_or_type == Utf8String; }
         bool isByteArray() const { return maxlen_or_type == ByteArray; }
+        bool isOffset() const { return maxlen_or_type == Offset; }
         bool isPlainPointer() const { return maxlen_or_type >= 0; }
     };
 
     static QCborStreamReader::StringResultCode appendStringChunk(QCborStreamReader &reader, QByteArray *data);
+    static QCborStreamReader::StringResultCode skipStringChunk(QCborStreamReader &reader, qsizetype *offset);
+    static const QByteArray *referencedBuffer(QCborStreamReader &reader)
+    {
+        const QCborStreamReaderPrivate *d = reader.d.data();
+        return d->referenceStrings && !d->device ? &d->buffer : nullptr;
+    }
+    static void setReferenceStrings(QCborStreamReader &reader)
+    { reader.d->referenceStrings = true; }
     bool readFullString(ReadStringChunk params);
     QCborStreamReader::StringResult<qsizetype> readStringChunk(ReadStringChunk params);
     qsizetype readStringChunk_byte(ReadStringChunk params, qsizetype len);
@@ -1609,6 +1621,30 @@ QCborStreamReader::StringResultCode qt_cbor_append_string_chunk(QCborStreamReade
     return QCborStreamReaderPrivate::appendStringChunk(reader, data);
 }
 
+void qt_cbor_stream_set_reference_strings(QCborStreamReader &reader)
+{
+    QCborStreamReaderPrivate::setReferenceStrings(reader);
+}
+
+const QByteArray *qt_cbor_stream_referenced_buffer(QCborStreamReader &reader)
+{
+    return QCborStreamReaderPrivate::referencedBuffer(reader);
+}
+
+QCborStreamReader::StringResultCode qt_cbor_skip_string_chunk(QCborStreamReader &reader, qsizetype *offset)
+{
+    return QCborStreamReaderPrivate::skipStringChunk(reader, offset);
+}
+
+inline QCborStreamReader::StringResultCode
+QCborStreamReaderPrivate::skipStringChunk(QCborStreamReader &reader, qsizetype *offset)
+{
+    auto status = reader.d->readStringChunk(offset).status;
+    if (status == QCborStreamReader::EndOfString && reader.lastError() == QCborError::NoError)
+        reader.preparse();
+    return status;
+}
+
 inline QCborStreamReader::StringResultCode
 QCborStreamReaderPrivate::appendStringChunk(QCborStreamReader &reader, QByteArray *data)
 {
@@ -1688,6 +1724,12 @@ QCborStreamReaderPrivate::readStringChunk(ReadStringChunk params)
         result.data = readStringChunk_unicode(params, qsizetype(len));
     } else if (params.isUtf8String()) {
         result.data = readStringChunk_utf8(params, qsizetype(len));
+    } else if (params.isOffset()) {
+        // QCborValue::fromRawCbor(): the caller references the chunk in
+        // place, so only report where it is
+        Q_ASSERT(!device);
+        *params.offset = bufferStart;
+        result.data = qsizetype(len);
     } else {
         // readByteArray() or readStringChunk()
         result.data = readStringChunk_byte(params, qsizetype(len));
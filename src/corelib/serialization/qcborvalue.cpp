@@ -765,7 +765,7 @@ static QCborValue::Type convertToExtendedType(QCborContainerPrivate *d)
 {
     qint64 tag = d->elements.at(0).value;
     auto &e = d->elements[1];
-    const ByteData *b = d->byteData(e);
+    const ByteDataView b = d->byteData(e);
 
     auto replaceByteData = [&](const char *buf, qsizetype len, Element::ValueFlags f) {
         d->data.clear();
@@ -935,8 +935,14 @@ void QCborContainerPrivate::compact()
     // Nested containers will be compacted when their data changes.
     for (auto &e : elements) {
         if (e.flags & Element::HasByteData) {
-            if (const ByteData *b = byteData(e))
+            const ByteDataView b = byteData(e);
+            if (b.isExternal) {
+                // only the reference to the external data needs to be kept
+                e.value = addExternalByteDataImpl(newData, newUsedData,
+                                                  b.ptr - external.constData(), b.len);
+            } else {
                 e.value = addByteDataImpl(newData, newUsedData, b->byte(), b->len);
+            }
         }
     }
     data = newData;
@@ -1023,21 +1029,29 @@ void QCborContainerPrivate::replaceAt_complex(Element &e, const QCborValue &valu
         e = value.container->elements.at(value.n);
 
         // Copy string data, if any
-        if (const ByteData *b = value.container->byteData(value.n)) {
-            const auto flags = e.flags;
+        if (const ByteDataView b = value.container->byteData(value.n)) {
+            auto flags = e.flags;
             // The element e has an invalid e.value, because it is copied from
             // value. It means that calling compact() will trigger an assertion
             // or just silently corrupt the data.
             // Temporarily unset the Element::HasByteData flag in order to skip
             // the element e in the call to compact().
             e.flags = e.flags & ~Element::HasByteData;
-            if (this == value.container) {
+            const QByteArray &source = value.container->external;
+            if (b.isExternal && (external.isNull() || external.constData() == source.constData())) {
+                // keep referring to the same external buffer
+                compact();
+                external = source;
+                e.value = addExternalByteDataImpl(data, usedData, b.ptr - source.constData(), b.len);
+            } else if (this == value.container) {
                 const QByteArray valueData = b->toByteArray();
                 compact();
                 e.value = addByteData(valueData, valueData.size());
+                flags &= ~Element::ByteDataIsExternal;
             } else {
                 compact();
                 e.value = addByteData(b->byte(), b->len);
+                flags &= ~Element::ByteDataIsExternal;
             }
             // restore the flags
             e.flags = flags;
@@ -1079,14 +1093,15 @@ QCborValue QCborContainerPrivate::extractAt_complex(Element e)
     auto b = byteData(e);
     auto container = new QCborContainerPrivate;
 
-    if (b->len + qsizetype(sizeof(*b)) < data.size() / 4) {
+    if (b->storageSize() < data.size() / 4) {
         // make a shallow copy of the byte data
-        container->appendByteData(b->byte(), b->len, e.type, e.flags);
-        usedData -= b->len + qsizetype(sizeof(*b));
+        container->appendByteData(b->byte(), b->len, e.type, e.flags & ~Element::ByteDataIsExternal);
+        usedData -= b->storageSize();
         compact();
     } else {
         // just share with the original byte data
         container->data = data;
+        container->external = external;
         container->elements.reserve(1);
         container->elements.append(e);
     }
@@ -1270,8 +1285,8 @@ static int compareElementRecursive(const QCborContainerPrivate *c1, const Elemen
                                 e2.flags & Element::IsContainer ? e2.container : nullptr, mode);
 
     // string data?
-    const ByteData *b1 = c1 ? c1->byteData(e1) : nullptr;
-    const ByteData *b2 = c2 ? c2->byteData(e2) : nullptr;
+    const ByteDataView b1 = c1 ? c1->byteData(e1) : ByteDataView();
+    const ByteDataView b2 = c2 ? c2->byteData(e2) : ByteDataView();
     if (b1 || b2) {
         auto len1 = b1 ? b1->len : 0;
         auto len2 = b2 ? b2->len : 0;
@@ -1582,7 +1597,7 @@ static void encodeToCbor(QCborStreamWriter &writer, const QCborContainerPrivate
         Q_ASSERT_X(d != nullptr, "QCborValue", "Unexpected null container");
         // just one element
         auto e = d->elements.at(idx);
-        const ByteData *b = d->byteData(idx);
+        const ByteDataView b = d->byteData(idx);
         switch (e.type) {
         case QCborValue::Integer:
             return writer.append(qint64(e.value));
@@ -1780,6 +1795,9 @@ inline void QCborContainerPrivate::setErrorInReader(QCborStreamReader &reader, Q
 }
 
 extern QCborStreamReader::StringResultCode qt_cbor_append_string_chunk(QCborStreamReader &reader, QByteArray *data);
+extern QCborStreamReader::StringResultCode qt_cbor_skip_string_chunk(QCborStreamReader &reader, qsizetype *offset);
+extern void qt_cbor_stream_set_reference_strings(QCborStreamReader &reader);
+extern const QByteArray *qt_cbor_stream_referenced_buffer(QCborStreamReader &reader);
 
 void QCborContainerPrivate::decodeStringFromCbor(QCborStreamReader &reader)
 {
@@ -1798,6 +1816,41 @@ void QCborContainerPrivate::decodeStringFromCbor(QCborStreamReader &reader)
 
     Element e = {};
     e.type = (reader.isByteArray() ? QCborValue::ByteArray : QCborValue::String);
+
+    // fromRawCbor(): reference non-chunked strings in the source buffer
+    // instead of copying them (a container can only reference one buffer)
+    const QByteArray *source = qt_cbor_stream_referenced_buffer(reader);
+    if (source && len && reader.isLengthKnown()
+            && (external.isNull() || external.constData() == source->constData())) {
+        qsizetype offset;
+        if (qt_cbor_skip_string_chunk(reader, &offset) != QCborStreamReader::Ok)
+            return;                 // error
+
+        if (e.type == QCborValue::String) {
+            auto utf8result = QUtf8::isValidUtf8(QByteArrayView(source->constData() + offset, len));
+            if (!utf8result.isValidUtf8) {
+                setErrorInReader(reader, { QCborError::InvalidUtf8String });
+                return;
+            }
+            if (Q_UNLIKELY(len > QString::max_size())) {
+                setErrorInReader(reader, { QCborError::DataTooLarge });
+                return;
+            }
+            if (utf8result.isValidAscii)
+                e.flags = Element::StringIsAscii;
+        }
+
+        if (qt_cbor_skip_string_chunk(reader, &offset) != QCborStreamReader::EndOfString)
+            return;                 // error
+
+        if (external.isNull())
+            external = *source;
+        e.value = addExternalByteDataImpl(data, usedData, offset, len);
+        e.flags |= Element::HasByteData | Element::ByteDataIsExternal;
+        elements.append(e);
+        return;
+    }
+
     if (len || !reader.isLengthKnown()) {
         // The use of size_t means none of the operations here can overflow because
         // all inputs are less than half SIZE_MAX.
@@ -2209,7 +2262,7 @@ QDateTime QCborValue::toDateTime(const QDateTime &defaultValue) const
         return defaultValue;
 
     Q_ASSERT(n == -1);
-    const ByteData *byteData = container->byteData(1);
+    const ByteDataView byteData = container->byteData(1);
     if (!byteData)
         return defaultValue; // date/times are never empty, so this must be invalid
 
@@ -2233,7 +2286,7 @@ QUrl QCborValue::toUrl(const QUrl &defaultValue) const
         return defaultValue;
 
     Q_ASSERT(n == -1);
-    const ByteData *byteData = container->byteData(1);
+    const ByteDataView byteData = container->byteData(1);
     if (!byteData)
         return QUrl();  // valid, empty URL
 
@@ -2275,7 +2328,7 @@ QUuid QCborValue::toUuid(const QUuid &defaultValue) const
         return defaultValue;
 
     Q_ASSERT(n == -1);
-    const ByteData *byteData = container->byteData(1);
+    const ByteDataView byteData = container->byteData(1);
     if (!byteData)
         return defaultValue; // UUIDs must always be 16 bytes, so this must be invalid
 
@@ -2687,6 +2740,42 @@ QCborValue QCborValue::fromCbor(const QByteArray &ba, QCborParserError *error)
     return result;
 }
 
+/*!
+    \since 6.9
+
+    Decodes one item from the CBOR stream found in the byte array \a ba, like
+    fromCbor(), but without copying the contents of byte arrays and text
+    strings out of \a ba. Instead, the returned value and the arrays and maps
+    it contains reference those strings where they are in \a ba, which
+    considerably reduces the time and memory needed to decode documents made
+    mostly of strings, such as memory-mapped files.
+
+    The values keep a reference to \a ba. If \a ba owns its data, implicit
+    sharing keeps it alive for as long as any of the values needs it. If it
+    was created with QByteArray::fromRawData(), for example to wrap the memory
+    returned by QFileDevice::map(), the caller must ensure that the memory
+    stays valid and unmodified until all values referencing it have been
+    destroyed.
+
+    Strings that are split in chunks in the CBOR stream are always copied, as
+    are strings that get modified or are inserted into other arrays or maps.
+
+    \a error is set as in fromCbor().
+
+    \sa fromCbor(), QByteArray::fromRawData()
+ */
+QCborValue QCborValue::fromRawCbor(const QByteArray &ba, QCborParserError *error)
+{
+    QCborStreamReader reader(ba);
+    qt_cbor_stream_set_reference_strings(reader);
+    QCborValue result = fromCbor(reader);
+    if (error) {
+        error->error = reader.lastError();
+        error->offset = reader.currentOffset();
+    }
+    return result;
+}
+
 /*!
     \fn QCborValue QCborValue::fromCbor(const char *data, qsizetype len, QCborParserError *error)
     \fn QCborValue QCborValue::fromCbor(const quint8 *data, qsizetype len, QCborParserError *error)
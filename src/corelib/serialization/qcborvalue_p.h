@@ -41,7 +41,8 @@ struct Element
         IsContainer                 = 0x0001,
         HasByteData                 = 0x0002,
         StringIsUtf16               = 0x0004,
-        StringIsAscii               = 0x0008
+        StringIsAscii               = 0x0008,
+        ByteDataIsExternal          = 0x0010
     };
     Q_DECLARE_FLAGS(ValueFlags, ValueFlag)
 
@@ -91,6 +92,44 @@ struct ByteData
 };
 static_assert(std::is_trivial<ByteData>::value);
 static_assert(std::is_standard_layout<ByteData>::value);
+
+// Stored in place of ByteData for elements with the ByteDataIsExternal flag:
+// the bytes are in QCborContainerPrivate::external, starting at offset.
+struct ExternalByteData
+{
+    QByteArray::size_type len;
+    QByteArray::size_type offset;
+};
+static_assert(std::is_trivial<ExternalByteData>::value);
+static_assert(alignof(ExternalByteData) == alignof(ByteData));
+
+// The bytes of a string or byte array element, wherever they are stored.
+struct ByteDataView
+{
+    const char *ptr = nullptr;
+    QByteArray::size_type len = 0;
+    bool isExternal = false;
+
+    explicit operator bool() const  { return ptr; }
+    const ByteDataView *operator->() const { return this; }
+
+    // how much of QCborContainerPrivate::data this element uses
+    qsizetype storageSize() const
+    { return isExternal ? qsizetype(sizeof(ExternalByteData)) : qsizetype(sizeof(ByteData)) + len; }
+
+    const char *byte() const        { return ptr; }
+    const QChar *utf16() const      { Q_ASSERT(!isExternal); return reinterpret_cast<const QChar *>(ptr); }
+
+    QByteArray toByteArray() const  { return QByteArray(byte(), len); }
+    QString toString() const        { return QString(utf16(), len / 2); }
+    QString toUtf8String() const    { return QString::fromUtf8(byte(), len); }
+
+    QByteArray asByteArrayView() const { return QByteArray::fromRawData(byte(), len); }
+    QLatin1StringView asLatin1() const  { return {byte(), len}; }
+    QUtf8StringView asUtf8StringView() const { return QUtf8StringView(byte(), len); }
+    QStringView asStringView() const{ return QStringView(utf16(), len / 2); }
+    QString asQStringRaw() const    { return QString::fromRawData(utf16(), len / 2); }
+};
 } // namespace QtCbor
 
 Q_DECLARE_TYPEINFO(QtCbor::Element, Q_PRIMITIVE_TYPE);
@@ -106,6 +145,8 @@ public:
     QByteArray::size_type usedData = 0;
     QByteArray data;
     QList<QtCbor::Element> elements;
+    // the buffer ByteDataIsExternal elements refer to (see QCborValue::fromRawCbor())
+    QByteArray external;
 
     void deref() { if (!ref.deref()) delete this; }
     void compact();
@@ -140,25 +181,46 @@ public:
         return offset;
     }
 
+    static qptrdiff addExternalByteDataImpl(QByteArray &target, QByteArray::size_type &targetUsed,
+                                            qsizetype externalOffset, qsizetype len)
+    {
+        qptrdiff offset = target.size();
+
+        // align offset
+        offset += alignof(QtCbor::ExternalByteData) - 1;
+        offset &= ~(alignof(QtCbor::ExternalByteData) - 1);
+
+        targetUsed += sizeof(QtCbor::ExternalByteData);
+        target.resize(offset + sizeof(QtCbor::ExternalByteData));
+        new (target.begin() + offset) QtCbor::ExternalByteData{ len, externalOffset };
+        return offset;
+    }
+
     qptrdiff addByteData(const char *block, qsizetype len)
     {
         return addByteDataImpl(data, usedData, block, len);
     }
 
-    const QtCbor::ByteData *byteData(QtCbor::Element e) const
+    QtCbor::ByteDataView byteData(QtCbor::Element e) const
     {
         if ((e.flags & QtCbor::Element::HasByteData) == 0)
-            return nullptr;
+            return {};
 
         size_t offset = size_t(e.value);
         Q_ASSERT((offset % alignof(QtCbor::ByteData)) == 0);
         Q_ASSERT(offset + sizeof(QtCbor::ByteData) <= size_t(data.size()));
 
+        if (e.flags & QtCbor::Element::ByteDataIsExternal) {
+            auto x = reinterpret_cast<const QtCbor::ExternalByteData *>(data.constData() + offset);
+            Q_ASSERT(size_t(x->offset) + size_t(x->len) <= size_t(external.size()));
+            return { external.constData() + x->offset, x->len, true };
+        }
+
         auto b = reinterpret_cast<const QtCbor::ByteData *>(data.constData() + offset);
         Q_ASSERT(offset + sizeof(*b) + size_t(b->len) <= size_t(data.size()));
-        return b;
+        return { b->byte(), b->len };
     }
-    const QtCbor::ByteData *byteData(qsizetype idx) const
+    QtCbor::ByteDataView byteData(qsizetype idx) const
     {
         return byteData(elements.at(idx));
     }
@@ -189,7 +251,7 @@ public:
             e.container = nullptr;
             e.flags = {};
         } else if (auto b = byteData(e)) {
-            usedData -= b->len + sizeof(QtCbor::ByteData);
+            usedData -= b->storageSize();
         }
         replaceAt_internal(e, value, disp);
     }
@@ -340,12 +402,12 @@ public:
         return e;
     }
 
-    static int compareUtf8(const QtCbor::ByteData *b, QLatin1StringView s)
+    static int compareUtf8(QtCbor::ByteDataView b, QLatin1StringView s)
     {
         return QUtf8::compareUtf8(QByteArrayView(b->byte(), b->len), s);
     }
 
-    static int compareUtf8(const QtCbor::ByteData *b, QStringView s)
+    static int compareUtf8(QtCbor::ByteDataView b, QStringView s)
     {
         return QUtf8::compareUtf8(QByteArrayView(b->byte(), b->len), s);
     }
@@ -356,7 +418,7 @@ public:
         if (e.type != QCborValue::String)
             return int(e.type) - int(QCborValue::String);
 
-        const QtCbor::ByteData *b = byteData(e);
+        const QtCbor::ByteDataView b = byteData(e);
         if (!b)
             return s.isEmpty() ? 0 : -1;
 
@@ -43,7 +43,7 @@ static QString simpleTypeString(QCborValue::Type t)
 
 static QString encodeByteArray(const QCborContainerPrivate *d, qsizetype idx, QCborTag encoding)
 {
-    const ByteData *b = d->byteData(idx);
+    const ByteDataView b = d->byteData(idx);
     if (!b)
         return QString();
 
@@ -82,7 +82,7 @@ static QString maybeEncodeTag(const QCborContainerPrivate *d)
 
     case qint64(QCborKnownTags::Uuid):
 #ifndef QT_BOOTSTRAPPED
-        if (const ByteData *b = d->byteData(e); e.type == QCborValue::ByteArray && b
+        if (const ByteDataView b = d->byteData(e); e.type == QCborValue::ByteArray && b
                 && b->len == sizeof(QUuid))
             return QUuid::fromRfc4122(b->asByteArrayView()).toString(QUuid::WithoutBraces);
 #endif
@@ -11,6 +11,7 @@
 #include "private/qstringconverter_p.h"
 #include "private/qcborvalue_p.h"
 #include "private/qnumeric_p.h"
+#include "private/qsimd_p.h"
 #include <private/qtools_p.h>
 
 //#define PARSER_DEBUG
@@ -244,6 +245,98 @@ enum {
     Quote = 0x22
 };
 
+/*
+    The scanners below skip over runs of bytes that need no further attention:
+    plain ASCII inside strings (anything but a quote, a backslash or a byte
+    with the high bit set) and insignificant whitespace between tokens. They
+    return a pointer to the first byte that the scalar code has to look at, or
+    \a end. They are shared with QJsonStreamReader.
+*/
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(AVX2)
+QT_FUNCTION_TARGET(AVX2)
+static const char *skipPlainStringCharsAvx2(const char *json, const char *end)
+{
+    const __m256i quote = _mm256_set1_epi8(Quote);
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    for ( ; end - json >= 32; json += 32) {
+        __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(json));
+        __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(data, quote),
+                                          _mm256_cmpeq_epi8(data, backslash));
+        // the high bit of data itself flags non-ASCII bytes
+        if (uint mask = _mm256_movemask_epi8(_mm256_or_si256(special, data)))
+            return json + qCountTrailingZeroBits(mask);
+    }
+    return json;
+}
+#endif
+
+const char *QJsonPrivate::skipPlainStringChars(const char *json, const char *end)
+{
+#if defined(__SSE2__)
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (qCpuHasFeature(AVX2))
+        json = skipPlainStringCharsAvx2(json, end);
+#  endif
+    const __m128i quote = _mm_set1_epi8(Quote);
+    const __m128i backslash = _mm_set1_epi8('\\');
+    for ( ; end - json >= 16; json += 16) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(data, quote),
+                                       _mm_cmpeq_epi8(data, backslash));
+        if (uint mask = _mm_movemask_epi8(_mm_or_si128(special, data)))
+            return json + qCountTrailingZeroBits(mask);
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    const uint8x16_t quote = vdupq_n_u8(Quote);
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t highBit = vdupq_n_u8(0x80);
+    for ( ; end - json >= 16; json += 16) {
+        uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(json));
+        uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(data, quote), vceqq_u8(data, backslash)),
+                                      vcgeq_u8(data, highBit));
+        if (vmaxvq_u8(special))
+            break;      // the scalar loop below finds the exact position
+    }
+#endif
+    while (json < end && uchar(*json) < 0x80 && *json != Quote && *json != '\\')
+        ++json;
+    return json;
+}
+
+const char *QJsonPrivate::skipSpaces(const char *json, const char *end)
+{
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(Space);
+    const __m128i tab = _mm_set1_epi8(Tab);
+    const __m128i lineFeed = _mm_set1_epi8(LineFeed);
+    const __m128i cr = _mm_set1_epi8(Return);
+    for ( ; end - json >= 16; json += 16) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, space),
+                                               _mm_cmpeq_epi8(data, tab)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(data, lineFeed),
+                                               _mm_cmpeq_epi8(data, cr)));
+        if (uint mask = ~_mm_movemask_epi8(ws) & 0xffff)
+            return json + qCountTrailingZeroBits(mask);
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    const uint8x16_t space = vdupq_n_u8(Space);
+    const uint8x16_t tab = vdupq_n_u8(Tab);
+    const uint8x16_t lineFeed = vdupq_n_u8(LineFeed);
+    const uint8x16_t cr = vdupq_n_u8(Return);
+    for ( ; end - json >= 16; json += 16) {
+        uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(json));
+        uint8x16_t ws = vorrq_u8(vorrq_u8(vceqq_u8(data, space), vceqq_u8(data, tab)),
+                                 vorrq_u8(vceqq_u8(data, lineFeed), vceqq_u8(data, cr)));
+        if (vminvq_u8(ws) == 0)
+            break;      // the scalar loop below finds the exact position
+    }
+#endif
+    while (json < end && (*json == Space || *json == Tab || *json == LineFeed || *json == Return))
+        ++json;
+    return json;
+}
+
 void Parser::eatBOM()
 {
     // eat UTF-8 byte order mark
@@ -257,6 +350,10 @@ void Parser::eatBOM()
 
 bool Parser::eatSpace()
 {
+    // indentation in pretty-printed documents comes in long runs
+    if (end - json > 1 && json[0] <= Space && json[1] <= Space)
+        json = skipSpaces(json, end);
+
     while (json < end) {
         if (*json > Space)
             break;
@@ -397,8 +494,8 @@ static void sortContainer(QCborContainerPrivate *container)
         Q_ASSERT(aKey.flags & QtCbor::Element::HasByteData);
         Q_ASSERT(bKey.flags & QtCbor::Element::HasByteData);
 
-        const QtCbor::ByteData *aData = container->byteData(aKey);
-        const QtCbor::ByteData *bData = container->byteData(bKey);
+        const QtCbor::ByteDataView aData = container->byteData(aKey);
+        const QtCbor::ByteDataView bData = container->byteData(bKey);
 
         if (!aData)
             return bData ? -1 : 0;
@@ -685,12 +782,9 @@ bool Parser::parseValue()
 
 */
 
-bool Parser::parseNumber()
+const char *QJsonPrivate::scanNumber(const char *json, const char *end, bool *isInt)
 {
-    QT_PARSER_TRACING_BEGIN << "parseNumber" << json;
-
-    const char *start = json;
-    bool isInt = true;
+    *isInt = true;
 
     // minus
     if (json < end && *json == '-')
@@ -708,14 +802,14 @@ bool Parser::parseNumber()
     if (json < end && *json == '.') {
         ++json;
         while (json < end && isAsciiDigit(*json)) {
-            isInt = isInt && *json == '0';
+            *isInt = *isInt && *json == '0';
             ++json;
         }
     }
 
     // exp = e [ minus / plus ] 1*DIGIT
     if (json < end && (*json == 'e' || *json == 'E')) {
-        isInt = false;
+        *isInt = false;
         ++json;
         if (json < end && (*json == '-' || *json == '+'))
             ++json;
@@ -723,38 +817,57 @@ bool Parser::parseNumber()
             ++json;
     }
 
-    if (json >= end) {
-        lastError = QJsonParseError::TerminationByNumber;
-        return false;
-    }
-
-    const QByteArray number = QByteArray::fromRawData(start, json - start);
-    QT_PARSER_TRACING_DEBUG << "numberstring" << number;
+    return json;
+}
 
+/*
+    Converts the text of a number scanned by scanNumber() into an integer or
+    double QCborValue. Returns an invalid QCborValue if it is not a number.
+*/
+QCborValue QJsonPrivate::numberValue(QByteArrayView number, bool isInt)
+{
     if (isInt) {
         bool ok;
         qlonglong n = number.toLongLong(&ok);
-        if (ok) {
-            container->append(QCborValue(n));
-            QT_PARSER_TRACING_END;
-            return true;
-        }
+        if (ok)
+            return QCborValue(n);
     }
 
     bool ok;
     double d = number.toDouble(&ok);
 
-    if (!ok) {
-        lastError = QJsonParseError::IllegalNumber;
-        return false;
-    }
+    if (!ok)
+        return QCborValue(QCborValue::Invalid);
 
     qint64 n;
     if (convertDoubleTo(d, &n))
-        container->append(QCborValue(n));
-    else
-        container->append(QCborValue(d));
+        return QCborValue(n);
+    return QCborValue(d);
+}
+
+bool Parser::parseNumber()
+{
+    QT_PARSER_TRACING_BEGIN << "parseNumber" << json;
+
+    const char *start = json;
+    bool isInt;
+    json = scanNumber(json, end, &isInt);
+
+    if (json >= end) {
+        lastError = QJsonParseError::TerminationByNumber;
+        return false;
+    }
+
+    const QByteArrayView number(start, json - start);
+    QT_PARSER_TRACING_DEBUG << "numberstring" << number;
 
+    const QCborValue value = numberValue(number, isInt);
+    if (value.isInvalid()) {
+        lastError = QJsonParseError::IllegalNumber;
+        return false;
+    }
+
+    container->append(value);
     QT_PARSER_TRACING_END;
     return true;
 }
@@ -793,7 +906,7 @@ static inline bool addHexDigit(char digit, char32_t *result)
     return false;
 }
 
-static inline bool scanEscapeSequence(const char *&json, const char *end, char32_t *ch)
+bool QJsonPrivate::scanEscapeSequence(const char *&json, const char *end, char32_t *ch)
 {
     ++json;
     if (json >= end)
@@ -838,7 +951,7 @@ static inline bool scanEscapeSequence(const char *&json, const char *end, char32
     return true;
 }
 
-static inline bool scanUtf8Char(const char *&json, const char *end, char32_t *result)
+bool QJsonPrivate::scanUtf8Char(const char *&json, const char *end, char32_t *result)
 {
     const auto *usrc = reinterpret_cast<const uchar *>(json);
     const auto *uend = reinterpret_cast<const uchar *>(end);
@@ -861,6 +974,10 @@ bool Parser::parseString()
     bool isUtf8 = true;
     bool isAscii = true;
     while (json < end) {
+        json = skipPlainStringChars(json, end);
+        if (json >= end)
+            break;
+
         char32_t ch = 0;
         if (*json == '"')
             break;
@@ -903,6 +1020,12 @@ bool Parser::parseString()
 
     QString ucs4;
     while (json < end) {
+        const char *plain = json;
+        json = skipPlainStringChars(json, end);
+        ucs4.append(QLatin1StringView(plain, json - plain));
+        if (json >= end)
+            break;
+
         char32_t ch = 0;
         if (*json == '"')
             break;
@@ -23,6 +23,14 @@ QT_BEGIN_NAMESPACE
 
 namespace QJsonPrivate {
 
+// tokenizer helpers, shared between Parser and QJsonStreamReader
+const char *skipPlainStringChars(const char *json, const char *end);
+const char *skipSpaces(const char *json, const char *end);
+bool scanEscapeSequence(const char *&json, const char *end, char32_t *ch);
+bool scanUtf8Char(const char *&json, const char *end, char32_t *result);
+const char *scanNumber(const char *json, const char *end, bool *isInt);
+QCborValue numberValue(QByteArrayView number, bool isInt);
+
 class Parser
 {
 public:
@@ -0,0 +1,753 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamreader.h"
+
+#include <qiodevice.h>
+#include <qjsondocument.h>
+#include <qvarlengtharray.h>
+
+#include "qjsonparser_p.h"
+#include "private/qstringconverter_p.h"
+
+QT_BEGIN_NAMESPACE
+
+using namespace QJsonPrivate;
+
+// same limit as QJsonDocument::fromJson()
+static const int nestingLimit = 1024;
+// how much we try to read from the device at a time
+static const qint64 ReadChunkSize = 64 * 1024;
+// don't bother compacting the buffer for less than this
+static const qsizetype CompactThreshold = 16 * 1024;
+
+class QJsonStreamReaderPrivate
+{
+public:
+    enum Expect : quint8 {
+        ExpectDocument,         // the top-level object or array
+        ExpectValueOrEnd,       // after the start of an array
+        ExpectKeyOrEnd,         // after the start of an object
+        ExpectNameSeparator,    // after a key
+        ExpectSeparatorOrEnd,   // after a value inside a container
+        ExpectNothing           // after the top-level value
+    };
+
+    enum Result {
+        GotToken,
+        NeedMoreData,
+        Failed
+    };
+
+    void clearToken();
+    void compactBuffer();
+    bool readFromDevice();
+
+    Result scanToken();
+    Result scanValue(const char *json, const char *end);
+    Result scanString(const char *json, const char *end, QJsonStreamReader::TokenType token);
+    Result scanLiteral(const char *json, const char *end, QByteArrayView literal,
+                       const QCborValue &value);
+    Result scanNumber(const char *json, const char *end);
+
+    Result setToken(QJsonStreamReader::TokenType token, const char *json, Expect next);
+    Result startContainer(QJsonStreamReader::TokenType token, const char *json);
+    Result endContainer(const char *json);
+    Result needMoreData(QJsonParseError::ParseError reason);
+    Result fail(const char *json, QJsonParseError::ParseError reason);
+
+    Expect afterValue() const
+    { return containers.isEmpty() ? ExpectNothing : ExpectSeparatorOrEnd; }
+
+    QIODevice *device = nullptr;
+    QByteArray buffer;
+    qsizetype pos = 0;              // first byte in buffer not consumed yet
+    qint64 bufferOffset = 0;        // offset of buffer[0] in the stream
+    QVarLengthArray<char, 32> containers;
+    Expect expect = ExpectDocument;
+
+    QJsonStreamReader::TokenType type = QJsonStreamReader::NoToken;
+    QJsonStreamReader::Error error = QJsonStreamReader::NoError;
+    QJsonParseError::ParseError parseError = QJsonParseError::NoError;
+    qint64 errorOffset = 0;
+
+    // the current Key or String token: either a range in buffer or decoded
+    qsizetype textBegin = 0;
+    qsizetype textSize = 0;
+    bool textIsAscii = false;
+    bool textIsDecoded = false;
+    QString decoded;
+    // the current Number, Bool or Null token
+    QCborValue scalar;
+};
+
+void QJsonStreamReaderPrivate::clearToken()
+{
+    textSize = 0;
+    textIsDecoded = false;
+    decoded.clear();
+    scalar = QCborValue();
+}
+
+/*
+    Drops the consumed part of the buffer once it makes up at least half of it,
+    so that memory use is bounded by the largest token instead of the size of
+    the document. The text of the current token is kept, but views returned
+    by text() become invalid.
+*/
+void QJsonStreamReaderPrivate::compactBuffer()
+{
+    qsizetype consumed = pos;
+    if ((type == QJsonStreamReader::Key || type == QJsonStreamReader::String) && !textIsDecoded)
+        consumed = qMin(consumed, textBegin);
+    if (consumed < CompactThreshold || consumed < buffer.size() / 2)
+        return;
+    buffer.remove(0, consumed);
+    bufferOffset += consumed;
+    textBegin -= consumed;
+    pos -= consumed;
+}
+
+bool QJsonStreamReaderPrivate::readFromDevice()
+{
+    if (!device)
+        return false;
+    const qsizetype oldSize = buffer.size();
+    const qint64 available = device->bytesAvailable();
+    const qint64 toRead = available > 0 ? qMin(available, qint64(ReadChunkSize) * 16)
+                                        : ReadChunkSize;
+    buffer.resize(oldSize + toRead);
+    const qint64 n = device->read(buffer.data() + oldSize, toRead);
+    buffer.resize(oldSize + qMax(n, qint64(0)));
+    return n > 0;
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::setToken(QJsonStreamReader::TokenType token, const char *json,
+                                   Expect next)
+{
+    type = token;
+    pos = json - buffer.constData();
+    expect = next;
+    return GotToken;
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::startContainer(QJsonStreamReader::TokenType token, const char *json)
+{
+    if (containers.size() >= nestingLimit)
+        return fail(json, QJsonParseError::DeepNesting);
+    const bool isObject = token == QJsonStreamReader::StartObject;
+    containers.append(isObject ? '{' : '[');
+    return setToken(token, json + 1, isObject ? ExpectKeyOrEnd : ExpectValueOrEnd);
+}
+
+QJsonStreamReaderPrivate::Result QJsonStreamReaderPrivate::endContainer(const char *json)
+{
+    const bool isObject = containers.back() == '{';
+    containers.removeLast();
+    return setToken(isObject ? QJsonStreamReader::EndObject : QJsonStreamReader::EndArray,
+                    json + 1, afterValue());
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::needMoreData(QJsonParseError::ParseError reason)
+{
+    // remembered in case the data never arrives
+    parseError = reason;
+    errorOffset = bufferOffset + buffer.size();
+    return NeedMoreData;
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::fail(const char *json, QJsonParseError::ParseError reason)
+{
+    type = QJsonStreamReader::Invalid;
+    error = QJsonStreamReader::NotWellFormedError;
+    parseError = reason;
+    errorOffset = bufferOffset + (json - buffer.constData());
+    return Failed;
+}
+
+/*
+    Tries to read the next token starting at pos. On success, pos is moved
+    past it. If the buffer ends in the middle of the token, nothing is consumed
+    so that the token can be scanned again once more data has arrived.
+*/
+QJsonStreamReaderPrivate::Result QJsonStreamReaderPrivate::scanToken()
+{
+    const char *json = buffer.constData() + pos;
+    const char *end = buffer.constData() + buffer.size();
+
+    if (expect == ExpectDocument && bufferOffset + pos == 0) {
+        // skip the UTF-8 byte order mark
+        static const char utf8bom[] = "\xef\xbb\xbf";
+        const qsizetype n = qMin(end - json, qsizetype(3));
+        if (memcmp(json, utf8bom, n) == 0) {
+            if (n < 3)
+                return needMoreData(QJsonParseError::IllegalValue);
+            json += 3;
+        }
+    }
+
+    const QJsonParseError::ParseError unterminated = containers.isEmpty()
+            ? QJsonParseError::IllegalValue
+            : containers.back() == '{' ? QJsonParseError::UnterminatedObject
+                                       : QJsonParseError::UnterminatedArray;
+    auto nextChar = [&]() {
+        json = skipSpaces(json, end);
+        return json < end;
+    };
+    if (!nextChar())
+        return needMoreData(unterminated);
+
+    switch (expect) {
+    case ExpectDocument:
+        if (*json == '{')
+            return startContainer(QJsonStreamReader::StartObject, json);
+        if (*json == '[')
+            return startContainer(QJsonStreamReader::StartArray, json);
+        return fail(json, QJsonParseError::IllegalValue);
+
+    case ExpectNothing:
+        return fail(json, QJsonParseError::GarbageAtEnd);
+
+    case ExpectSeparatorOrEnd:
+        if (*json == (containers.back() == '{' ? '}' : ']'))
+            return endContainer(json);
+        if (*json != ',') {
+            if (containers.back() == '{')
+                return fail(json, QJsonParseError::UnterminatedObject);
+            // like QJsonDocument, which only reports the missing separator
+            // when something follows the unexpected character
+            return fail(json, skipSpaces(json + 1, end) < end
+                                      ? QJsonParseError::MissingValueSeparator
+                                      : QJsonParseError::UnterminatedArray);
+        }
+        ++json;
+        if (!nextChar())
+            return needMoreData(unterminated);
+        if (containers.back() == '[')
+            return scanValue(json, end);
+        if (*json == '}')
+            return fail(json, QJsonParseError::MissingObject);
+        if (*json != '"')
+            return fail(json, QJsonParseError::UnterminatedObject);
+        return scanString(json, end, QJsonStreamReader::Key);
+
+    case ExpectKeyOrEnd:
+        if (*json == '}')
+            return endContainer(json);
+        if (*json != '"')
+            return fail(json, QJsonParseError::UnterminatedObject);
+        return scanString(json, end, QJsonStreamReader::Key);
+
+    case ExpectNameSeparator:
+        if (*json != ':')
+            return fail(json, QJsonParseError::MissingNameSeparator);
+        ++json;
+        if (!nextChar())
+            return needMoreData(unterminated);
+        return scanValue(json, end);
+
+    case ExpectValueOrEnd:
+        if (*json == ']')
+            return endContainer(json);
+        return scanValue(json, end);
+    }
+    Q_UNREACHABLE_RETURN(Failed);
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::scanValue(const char *json, const char *end)
+{
+    switch (*json) {
+    case '{':
+        return startContainer(QJsonStreamReader::StartObject, json);
+    case '[':
+        return startContainer(QJsonStreamReader::StartArray, json);
+    case '"':
+        return scanString(json, end, QJsonStreamReader::String);
+    case 't':
+        return scanLiteral(json, end, "true", QCborValue(true));
+    case 'f':
+        return scanLiteral(json, end, "false", QCborValue(false));
+    case 'n':
+        return scanLiteral(json, end, "null", QCborValue(nullptr));
+    case ',':
+        return fail(json, QJsonParseError::IllegalValue);
+    case '}':
+    case ']':
+        return fail(json, QJsonParseError::MissingObject);
+    default:
+        return scanNumber(json, end);
+    }
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::scanString(const char *json, const char *end,
+                                     QJsonStreamReader::TokenType token)
+{
+    const char *start = json + 1;
+    bool isAscii = true;
+    bool hasEscapes = false;
+
+    // find the closing quote, validating UTF-8 if there are no escape sequences
+    const char *p = start;
+    while (true) {
+        p = skipPlainStringChars(p, end);
+        if (p >= end)
+            return needMoreData(QJsonParseError::UnterminatedString);
+        if (*p == '"')
+            break;
+        if (*p == '\\') {
+            hasEscapes = true;
+            // skip the escaped character, so that \" doesn't end the string
+            p += 2;
+            continue;
+        }
+        if (hasEscapes) {
+            // validated while decoding below
+            ++p;
+            continue;
+        }
+
+        isAscii = false;
+        const auto *usrc = reinterpret_cast<const uchar *>(p);
+        const auto *uend = reinterpret_cast<const uchar *>(end);
+        const uchar b = *usrc++;
+        char32_t ch;
+        char32_t *dst = &ch;
+        const qsizetype res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, dst, usrc, uend);
+        if (res == QUtf8BaseTraits::EndOfString)
+            return needMoreData(QJsonParseError::UnterminatedString);
+        if (res < 0)
+            return fail(p, QJsonParseError::IllegalUTF8String);
+        p = reinterpret_cast<const char *>(usrc);
+    }
+
+    clearToken();
+    if (!hasEscapes) {
+        textBegin = start - buffer.constData();
+        textSize = p - start;
+        textIsAscii = isAscii;
+        return setToken(token, p + 1, token == QJsonStreamReader::Key ? ExpectNameSeparator
+                                                                      : afterValue());
+    }
+
+    // decode into UTF-16, like QJsonDocument does for strings with escape sequences
+    const char *closingQuote = p;
+    for (p = start; p < closingQuote; ) {
+        const char *plain = p;
+        p = skipPlainStringChars(p, closingQuote);
+        decoded.append(QLatin1StringView(plain, p - plain));
+        if (p >= closingQuote)
+            break;
+
+        char32_t ch = 0;
+        if (*p == '\\') {
+            if (!scanEscapeSequence(p, closingQuote, &ch))
+                return fail(p, QJsonParseError::IllegalEscapeSequence);
+        } else if (!scanUtf8Char(p, closingQuote, &ch)) {
+            return fail(p, QJsonParseError::IllegalUTF8String);
+        }
+        decoded.append(QChar::fromUcs4(ch));
+    }
+    textIsDecoded = true;
+    return setToken(token, closingQuote + 1, token == QJsonStreamReader::Key ? ExpectNameSeparator
+                                                                             : afterValue());
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::scanLiteral(const char *json, const char *end, QByteArrayView literal,
+                                      const QCborValue &value)
+{
+    const qsizetype available = qMin(end - json, literal.size());
+    if (QByteArrayView(json, available) != literal.first(available))
+        return fail(json, QJsonParseError::IllegalValue);
+    if (available < literal.size())
+        return needMoreData(QJsonParseError::IllegalValue);
+
+    clearToken();
+    scalar = value;
+    const QJsonStreamReader::TokenType token = value.isBool() ? QJsonStreamReader::Bool
+                                                              : QJsonStreamReader::Null;
+    return setToken(token, json + literal.size(), afterValue());
+}
+
+QJsonStreamReaderPrivate::Result
+QJsonStreamReaderPrivate::scanNumber(const char *json, const char *end)
+{
+    bool isInt;
+    const char *numberEnd = QJsonPrivate::scanNumber(json, end, &isInt);
+    // numbers are never the top-level value, so something must follow them
+    if (numberEnd >= end)
+        return needMoreData(QJsonParseError::TerminationByNumber);
+
+    const QCborValue value = numberValue(QByteArrayView(json, numberEnd), isInt);
+    if (value.isInvalid())
+        return fail(numberEnd, QJsonParseError::IllegalNumber);
+
+    clearToken();
+    scalar = value;
+    return setToken(QJsonStreamReader::Number, numberEnd, afterValue());
+}
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \since 6.9
+    \ingroup json
+    \reentrant
+
+    \brief The QJsonStreamReader class is a fast pull parser for reading JSON
+    documents incrementally.
+
+    QJsonStreamReader reads a JSON document one token at a time, in the style
+    of QXmlStreamReader. Unlike QJsonDocument::fromJson(), it does not need the
+    whole document in memory and does not build a tree of values: memory use
+    is bounded by the size of the largest token, which makes it suitable for
+    very large documents and for documents that arrive in pieces over the
+    network.
+
+    Data is read either from a QIODevice set with setDevice() or from chunks
+    passed to addData(). Calling readNext() returns the next token:
+
+    \snippet code/src_corelib_serialization_qjsonstreamreader.cpp 0
+
+    If the data read so far ends in the middle of a token, readNext() returns
+    \l Invalid and error() is \l PrematureEndOfDocumentError. Nothing is lost:
+    once more data is available, either because it was passed to addData() or
+    because the device emitted readyRead(), calling readNext() again resumes
+    parsing at the same position.
+
+    The text of keys and string values is returned by text() as a view that
+    points directly into the reader's input buffer whenever the string contains
+    no escape sequences, avoiding a copy. Such views are only valid until the
+    next call to readNext(), addData(), setDevice() or clear().
+
+    QJsonStreamReader accepts the same documents as QJsonDocument::fromJson()
+    and reports the same QJsonParseError::ParseError conditions, available
+    through errorString(). Duplicate keys are reported as they occur.
+
+    \sa QJsonStreamWriter, QJsonDocument, QXmlStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of token the reader just read.
+
+    \value NoToken      The reader has not read anything yet, or has read the
+                        whole document.
+    \value Invalid      An error has occurred, reported in error() and
+                        errorString().
+    \value StartObject  The reader reports the start of an object.
+    \value EndObject    The reader reports the end of an object.
+    \value StartArray   The reader reports the start of an array.
+    \value EndArray     The reader reports the end of an array.
+    \value Key          The reader reports the key of an object member, in
+                        text(). The member's value is the next token.
+    \value String       The reader reports a string value, in text().
+    \value Number       The reader reports a number, in toDouble() and
+                        toInteger().
+    \value Bool         The reader reports \c true or \c false, in toBool().
+    \value Null         The reader reports \c null.
+*/
+
+/*!
+    \enum QJsonStreamReader::Error
+
+    This enum specifies different error cases.
+
+    \value NoError      No error has occurred.
+    \value NotWellFormedError
+                        The input is not valid JSON. errorString() describes
+                        the problem.
+    \value PrematureEndOfDocumentError
+                        The input ended before the document was complete. The
+                        reader can continue once more data has been added.
+*/
+
+/*!
+    Constructs a stream reader without any data.
+
+    \sa setDevice(), addData()
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d(new QJsonStreamReaderPrivate)
+{
+}
+
+/*!
+    Constructs a stream reader that reads from \a device.
+
+    \sa setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : QJsonStreamReader()
+{
+    setDevice(device);
+}
+
+/*!
+    Constructs a stream reader that reads from a copy of \a data.
+
+    \sa addData()
+*/
+QJsonStreamReader::QJsonStreamReader(QByteArrayView data)
+    : QJsonStreamReader()
+{
+    addData(data);
+}
+
+/*!
+    Destroys the reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+}
+
+/*!
+    Sets the current device to \a device and restarts parsing from the
+    beginning. Any data previously passed to addData() is discarded.
+
+    \sa device(), clear()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    clear();
+    d->device = device;
+}
+
+/*!
+    Returns the current device, or \nullptr if there is none.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    return d->device;
+}
+
+/*!
+    Appends \a data to the reader's input. If the reader is waiting for more
+    data after a \l PrematureEndOfDocumentError, the next call to readNext()
+    continues parsing.
+
+    This function does nothing if the reader reads from a device.
+
+    \sa readNext(), clear()
+*/
+void QJsonStreamReader::addData(QByteArrayView data)
+{
+    if (d->device) {
+        qWarning("QJsonStreamReader: addData() with device()");
+        return;
+    }
+    d->compactBuffer();
+    d->buffer.append(data);
+}
+
+/*!
+    Removes any device() or data from the reader and resets its state.
+
+    \sa setDevice(), addData()
+*/
+void QJsonStreamReader::clear()
+{
+    *d = QJsonStreamReaderPrivate();
+}
+
+/*!
+    Returns \c true if the reader has read until the end of the JSON document,
+    or if an error() has occurred. Otherwise returns \c false.
+
+    If atEnd() and hasError() return \c true and error() is
+    \l PrematureEndOfDocumentError, more data can be added and parsing
+    continues with the next call to readNext().
+
+    \sa readNext()
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    return d->expect == QJsonStreamReaderPrivate::ExpectNothing
+            || d->error != NoError;
+}
+
+/*!
+    Reads the next token and returns its type.
+
+    If the reader runs out of data in the middle of a token, it returns
+    \l Invalid and sets error() to \l PrematureEndOfDocumentError; calling
+    readNext() again after more data has arrived resumes parsing. Once the
+    document has been read completely, it returns \l NoToken, and \l Invalid
+    with NotWellFormedError if anything but whitespace follows it.
+
+    \sa tokenType()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    if (d->error == NotWellFormedError)
+        return d->type;
+
+    d->error = NoError;
+    d->compactBuffer();
+    while (true) {
+        switch (d->scanToken()) {
+        case QJsonStreamReaderPrivate::GotToken:
+        case QJsonStreamReaderPrivate::Failed:
+            return d->type;
+        case QJsonStreamReaderPrivate::NeedMoreData:
+            if (d->readFromDevice())
+                continue;
+            d->clearToken();
+            if (d->expect == QJsonStreamReaderPrivate::ExpectNothing) {
+                d->parseError = QJsonParseError::NoError;
+                d->type = NoToken;
+            } else {
+                d->type = Invalid;
+                d->error = PrematureEndOfDocumentError;
+            }
+            return d->type;
+        }
+    }
+}
+
+/*!
+    Returns the type of the current token.
+
+    \sa readNext()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    return d->type;
+}
+
+/*!
+    Returns the number of objects and arrays the current token is nested in.
+    StartObject and StartArray tokens count themselves, EndObject and EndArray
+    tokens don't.
+*/
+int QJsonStreamReader::depth() const
+{
+    return int(d->containers.size());
+}
+
+/*!
+    Returns the offset in bytes from the start of the input to the end of the
+    current token.
+*/
+qint64 QJsonStreamReader::offset() const
+{
+    return d->bufferOffset + d->pos;
+}
+
+/*!
+    Returns the text of the current \l Key or \l String token, or a null view
+    for other tokens.
+
+    If the string contains no escape sequences, the view points into the
+    reader's input buffer. It remains valid until the next call to readNext(),
+    addData(), setDevice() or clear(). Use QAnyStringView::toString() to keep
+    the text around for longer.
+*/
+QAnyStringView QJsonStreamReader::text() const
+{
+    if (d->type != Key && d->type != String)
+        return {};
+    if (d->textIsDecoded)
+        return d->decoded;
+    const char *data = d->buffer.constData() + d->textBegin;
+    if (d->textIsAscii)
+        return QLatin1StringView(data, d->textSize);
+    return QUtf8StringView(data, d->textSize);
+}
+
+/*!
+    Returns the value of the current \l Number token as a double, or 0 for
+    other tokens.
+
+    \sa toInteger()
+*/
+double QJsonStreamReader::toDouble() const
+{
+    return d->type == Number ? d->scalar.toDouble() : 0;
+}
+
+/*!
+    Returns the value of the current \l Number token as an integer, or 0 for
+    other tokens. Numbers with a fractional part are truncated.
+
+    \sa toDouble()
+*/
+qint64 QJsonStreamReader::toInteger() const
+{
+    return d->type == Number ? d->scalar.toInteger() : 0;
+}
+
+/*!
+    Returns the value of the current \l Bool token, or \c false for other
+    tokens.
+*/
+bool QJsonStreamReader::toBool() const
+{
+    return d->type == Bool && d->scalar.isTrue();
+}
+
+/*!
+    Returns the current \l String, \l Number, \l Bool or \l Null token as a
+    QJsonValue. Returns an undefined QJsonValue for other tokens.
+*/
+QJsonValue QJsonStreamReader::value() const
+{
+    switch (d->type) {
+    case String:
+        return text().toString();
+    case Number:
+    case Bool:
+    case Null:
+        return d->scalar.toJsonValue();
+    default:
+        return QJsonValue::Undefined;
+    }
+}
+
+/*!
+    Returns \c true if an error has occurred.
+
+    \sa error(), errorString()
+*/
+bool QJsonStreamReader::hasError() const
+{
+    return d->error != NoError;
+}
+
+/*!
+    Returns the type of the current error, or \l NoError.
+
+    \sa errorString()
+*/
+QJsonStreamReader::Error QJsonStreamReader::error() const
+{
+    return d->error;
+}
+
+/*!
+    Returns a human-readable description of the current error, in the same
+    words as QJsonParseError::errorString(), or an empty string if there is no
+    error.
+*/
+QString QJsonStreamReader::errorString() const
+{
+    if (d->error == NoError)
+        return QString();
+    QJsonParseError parseError;
+    parseError.offset = int(d->errorOffset);
+    parseError.error = d->parseError;
+    return parseError.errorString();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qjsonstreamreader.cpp"
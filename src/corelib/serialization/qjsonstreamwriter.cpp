@@ -0,0 +1,386 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamwriter.h"
+
+#include <qcborvalue.h>
+#include <qiodevice.h>
+#include <qvarlengtharray.h>
+
+#include "qjsonwriter_p.h"
+
+QT_BEGIN_NAMESPACE
+
+using namespace QJsonPrivate;
+
+// how much output we collect before writing it to the device
+static const qsizetype FlushThreshold = 16 * 1024;
+
+class QJsonStreamWriterPrivate
+{
+public:
+    struct Container {
+        bool isObject;
+        bool hasElements = false;
+    };
+
+    QByteArray &output() { return data ? *data : buffer; }
+    bool compact() const { return format == QJsonDocument::Compact; }
+
+    void separate();
+    void beginValue();
+    void endValue();
+    void flush();
+    void appendIndent(qsizetype depth);
+    void appendString(QAnyStringView s);
+    void startContainer(bool isObject);
+    void endContainer(bool isObject);
+
+    QIODevice *device = nullptr;
+    QByteArray *data = nullptr;
+    QByteArray buffer;
+    QVarLengthArray<Container, 32> containers;
+    QJsonDocument::JsonFormat format = QJsonDocument::Indented;
+    bool afterKey = false;
+    bool error = false;
+};
+
+void QJsonStreamWriterPrivate::appendIndent(qsizetype depth)
+{
+    if (!compact())
+        output().append(4 * depth, ' ');
+}
+
+// emits the separator and indentation that go in front of an element
+void QJsonStreamWriterPrivate::separate()
+{
+    if (containers.isEmpty())
+        return;
+
+    Container &c = containers.last();
+    if (c.hasElements)
+        output() += compact() ? "," : ",\n";
+    c.hasElements = true;
+    appendIndent(containers.size());
+}
+
+void QJsonStreamWriterPrivate::beginValue()
+{
+    if (afterKey) {
+        afterKey = false;
+        return;
+    }
+    Q_ASSERT_X(containers.isEmpty() || !containers.last().isObject,
+               "QJsonStreamWriter", "Missing key for object member");
+    separate();
+}
+
+void QJsonStreamWriterPrivate::endValue()
+{
+    if (!containers.isEmpty()) {
+        if (device && buffer.size() >= FlushThreshold)
+            flush();
+        return;
+    }
+
+    // the document is complete
+    if (!compact())
+        output() += '\n';
+    flush();
+}
+
+void QJsonStreamWriterPrivate::flush()
+{
+    if (!device || buffer.isEmpty())
+        return;
+    if (device->write(buffer) != buffer.size())
+        error = true;
+    buffer.clear();
+}
+
+void QJsonStreamWriterPrivate::appendString(QAnyStringView s)
+{
+    QByteArray &json = output();
+    json += '"';
+    s.visit([&json](auto str) {
+        if constexpr (std::is_same_v<decltype(str), QStringView>) {
+            json += Writer::escapedString(str);
+        } else {
+            // plain 7-bit text in a Latin-1 or UTF-8 view can be copied as is
+            const char *begin = reinterpret_cast<const char *>(str.data());
+            const char *end = begin + str.size();
+            const char *p = begin;
+            while (p < end && uchar(*p) >= 0x20 && uchar(*p) < 0x80 && *p != '"' && *p != '\\')
+                ++p;
+            if (p == end)
+                json.append(begin, end - begin);
+            else
+                json += Writer::escapedString(str.toString());
+        }
+    });
+    json += '"';
+}
+
+void QJsonStreamWriterPrivate::startContainer(bool isObject)
+{
+    beginValue();
+    output() += isObject ? '{' : '[';
+    if (!compact())
+        output() += '\n';
+    containers.append({ isObject });
+}
+
+void QJsonStreamWriterPrivate::endContainer(bool isObject)
+{
+    Q_ASSERT_X(!containers.isEmpty() && containers.last().isObject == isObject && !afterKey,
+               "QJsonStreamWriter", "Mismatched end of object or array");
+    if (containers.isEmpty())
+        return;
+
+    const bool hasElements = containers.last().hasElements;
+    containers.removeLast();
+    if (!compact()) {
+        if (hasElements)
+            output() += '\n';
+        appendIndent(containers.size());
+    }
+    output() += isObject ? '}' : ']';
+    endValue();
+}
+
+/*!
+    \class QJsonStreamWriter
+    \inmodule QtCore
+    \since 6.9
+    \ingroup json
+    \reentrant
+
+    \brief The QJsonStreamWriter class writes a JSON document incrementally.
+
+    QJsonStreamWriter is the counterpart of QJsonStreamReader: it writes a
+    JSON document piece by piece to a QIODevice or a QByteArray, without first
+    building a QJsonDocument. This keeps memory use low when generating large
+    documents:
+
+    \snippet code/src_corelib_serialization_qjsonstreamwriter.cpp 0
+
+    The output is identical to what QJsonDocument::toJson() produces for the
+    same document in the same format(). Members of an object are written in
+    the order they are given, though, whereas QJsonObject sorts them by key.
+
+    When writing to a device, the output is collected in a small buffer that
+    is written to the device whenever it grows beyond a few kilobytes, once
+    the document is complete, on flush() and when the writer is destroyed.
+
+    The writer does not validate the structure of the document: calls to
+    writeStartObject() and writeEndObject() and to writeStartArray() and
+    writeEndArray() must be balanced, and each member of an object must start
+    with writeKey().
+
+    \sa QJsonStreamReader, QJsonDocument::toJson()
+*/
+
+/*!
+    Constructs a writer without a device. Call setDevice() before writing.
+*/
+QJsonStreamWriter::QJsonStreamWriter()
+    : d(new QJsonStreamWriterPrivate)
+{
+}
+
+/*!
+    Constructs a writer that writes to \a device.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device)
+    : QJsonStreamWriter()
+{
+    d->device = device;
+}
+
+/*!
+    Constructs a writer that appends to the byte array \a data.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QByteArray *data)
+    : QJsonStreamWriter()
+{
+    d->data = data;
+}
+
+/*!
+    Flushes any pending output to the device and destroys the writer.
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+    flush();
+}
+
+/*!
+    Flushes any pending output and makes the writer write to \a device from
+    now on.
+
+    \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    flush();
+    d->data = nullptr;
+    d->device = device;
+}
+
+/*!
+    Returns the device the writer writes to, or \nullptr if it writes to a
+    QByteArray or nowhere.
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    return d->device;
+}
+
+/*!
+    Sets the output format to \a format. The default is
+    QJsonDocument::Indented. The format should not be changed while writing a
+    document.
+*/
+void QJsonStreamWriter::setFormat(QJsonDocument::JsonFormat format)
+{
+    d->format = format;
+}
+
+/*!
+    Returns the output format.
+*/
+QJsonDocument::JsonFormat QJsonStreamWriter::format() const
+{
+    return d->format;
+}
+
+/*!
+    Starts an object. The members are written with pairs of writeKey() and a
+    value, and the object is closed with writeEndObject().
+*/
+void QJsonStreamWriter::writeStartObject()
+{
+    d->startContainer(true);
+}
+
+/*!
+    Ends the current object.
+*/
+void QJsonStreamWriter::writeEndObject()
+{
+    d->endContainer(true);
+}
+
+/*!
+    Starts an array, which is closed with writeEndArray().
+*/
+void QJsonStreamWriter::writeStartArray()
+{
+    d->startContainer(false);
+}
+
+/*!
+    Ends the current array.
+*/
+void QJsonStreamWriter::writeEndArray()
+{
+    d->endContainer(false);
+}
+
+/*!
+    Writes \a key as the key of the next member of the current object. It
+    must be followed by exactly one value.
+*/
+void QJsonStreamWriter::writeKey(QAnyStringView key)
+{
+    Q_ASSERT_X(!d->containers.isEmpty() && d->containers.last().isObject && !d->afterKey,
+               "QJsonStreamWriter", "Keys can only be written inside objects");
+    d->separate();
+    d->appendString(key);
+    d->output() += d->compact() ? ":" : ": ";
+    d->afterKey = true;
+}
+
+/*!
+    Writes the string \a value.
+*/
+void QJsonStreamWriter::writeString(QAnyStringView value)
+{
+    d->beginValue();
+    d->appendString(value);
+    d->endValue();
+}
+
+/*!
+    Writes the integer \a value.
+*/
+void QJsonStreamWriter::writeInteger(qint64 value)
+{
+    d->beginValue();
+    d->output() += QByteArray::number(value);
+    d->endValue();
+}
+
+/*!
+    Writes the number \a value. Infinities and NaN are written as \c null, as
+    JSON cannot represent them.
+*/
+void QJsonStreamWriter::writeDouble(double value)
+{
+    d->beginValue();
+    Writer::valueToJson(QCborValue(value), d->output(), 0, d->compact());
+    d->endValue();
+}
+
+/*!
+    Writes \c true or \c false, depending on \a value.
+*/
+void QJsonStreamWriter::writeBool(bool value)
+{
+    d->beginValue();
+    d->output() += value ? "true" : "false";
+    d->endValue();
+}
+
+/*!
+    Writes \c null.
+*/
+void QJsonStreamWriter::writeNull()
+{
+    d->beginValue();
+    d->output() += "null";
+    d->endValue();
+}
+
+/*!
+    Writes \a value, which may be a complete object or array. An undefined
+    \a value is written as \c null.
+*/
+void QJsonStreamWriter::writeValue(const QJsonValue &value)
+{
+    d->beginValue();
+    // the compact format has no indentation, at any depth
+    const int indent = d->compact() ? 0 : int(d->containers.size());
+    Writer::valueToJson(QCborValue::fromJsonValue(value), d->output(), indent, d->compact());
+    d->endValue();
+}
+
+/*!
+    Writes any buffered output to the device.
+
+    \sa hasError()
+*/
+void QJsonStreamWriter::flush()
+{
+    d->flush();
+}
+
+/*!
+    Returns \c true if writing to the device failed.
+*/
+bool QJsonStreamWriter::hasError() const
+{
+    return d->error;
+}
+
+QT_END_NAMESPACE
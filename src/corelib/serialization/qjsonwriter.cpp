@@ -206,4 +206,14 @@ void Writer::arrayToJson(const QCborContainerPrivate *a, QByteArray &json, int i
     json += compact ? "]" : "]\n";
 }
 
+void Writer::valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
+{
+    QT_PREPEND_NAMESPACE(valueToJson)(v, json, indent, compact);
+}
+
+QByteArray Writer::escapedString(QStringView s)
+{
+    return QT_PREPEND_NAMESPACE(escapedString)(s);
+}
+
 QT_END_NAMESPACE
@@ -9,6 +9,15 @@
 #include "qdebug.h"
 #include "qlocale_p.h"
 #include "qthreadstorage.h"
+#if QT_CONFIG(thread)
+#include "qsemaphore.h"
+#include "qthread.h"
+#include "qthreadpool.h"
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QCollatorSortKeyPrivate)
@@ -388,7 +397,114 @@ QCollatorSortKey QCollator::defaultSortKey(QStringView key)
     keys for each string and then sort using the keys.
 
     \note Not supported with the C (a.k.a. POSIX) locale on Darwin.
+
+    \sa sortKeys()
+*/
+
+/*!
+    \since 6.9
+
+    Returns the sort keys for all the \a strings, in the same order.
+
+    This is equivalent to calling sortKey() for each string, but large inputs
+    are split over the threads of QThreadPool::globalInstance(). The keys can
+    be compared with each other as if this collator had created them one by
+    one.
+
+    \note Not supported with the C (a.k.a. POSIX) locale on Darwin.
+
+    \sa sortKey(), sort()
+*/
+QList<QCollatorSortKey> QCollator::sortKeys(QSpan<const QString> strings) const
+{
+    const qsizetype count = qsizetype(strings.size());
+
+    // QCollatorSortKey can't be default-constructed, so collect the private
+    // parts first, at their final positions
+    std::vector<QExplicitlySharedDataPointer<QCollatorSortKeyPrivate>> keys(count);
+    auto computeKeys = [&](const QCollator &collator, qsizetype begin, qsizetype end) {
+        for (qsizetype i = begin; i < end; ++i)
+            keys[i] = std::move(collator.sortKey(strings[i]).d);
+    };
+
+    d->ensureInitialized();
+#if QT_CONFIG(thread) && !defined(Q_OS_WASM)
+    // Creating a back-end collator costs about as much as a thousand sort
+    // keys, and the back-ends aren't required to be thread-safe, so only
+    // split work that is large enough for each thread to have its own.
+    constexpr qsizetype MinimumSegmentSize = 1024;
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    qsizetype segments = count / MinimumSegmentSize;
+    if (threadPool)
+        segments = std::min<qsizetype>(segments, threadPool->maxThreadCount());
+    if (segments > 1 && threadPool && !threadPool->contains(QThread::currentThread())) {
+        QSemaphore semaphore;
+        qsizetype begin = 0;
+        for (qsizetype i = 0; i < segments; ++i) {
+            const qsizetype n = (count - begin) / (segments - i);
+            threadPool->start([&, begin, n]() {
+                QCollator collator(d->locale);
+                collator.setCaseSensitivity(d->caseSensitivity);
+                collator.setNumericMode(d->numericMode);
+                collator.setIgnorePunctuation(d->ignorePunctuation);
+                computeKeys(collator, begin, begin + n);
+                semaphore.release(1);
+            });
+            begin += n;
+        }
+        semaphore.acquire(int(segments));
+    } else
+#endif
+        computeKeys(*this, 0, count);
+
+    QList<QCollatorSortKey> result;
+    result.reserve(count);
+    for (const auto &key : keys)
+        result.append(QCollatorSortKey(key.data()));
+    return result;
+}
+
+/*!
+    \since 6.9
+
+    Sorts \a list in ascending order, according to this collator. Strings
+    that compare equal keep their relative order.
+
+    Unless this collator uses the C locale, this function computes the sort
+    key of each string once, with sortKeys(), and then only compares the keys.
+    That is much faster for long lists than sorting with compare(), which
+    repeats the collation work for every comparison.
+
+    \sa sortKeys(), compare()
 */
+void QCollator::sort(QStringList &list) const
+{
+    const qsizetype count = list.size();
+    if (count < 2)
+        return;
+
+    d->ensureInitialized();
+    if (d->isC()) {
+        // Darwin has no sort keys for the C locale, and comparing is cheap anyway
+        std::stable_sort(list.begin(), list.end(), [this](const QString &s1, const QString &s2) {
+            return compare(s1, s2) < 0;
+        });
+        return;
+    }
+
+    const QList<QCollatorSortKey> keys = sortKeys(list);
+    std::vector<qsizetype> order(count);
+    std::iota(order.begin(), order.end(), qsizetype(0));
+    std::stable_sort(order.begin(), order.end(), [&keys](qsizetype i, qsizetype j) {
+        return keys.at(i).compare(keys.at(j)) < 0;
+    });
+
+    QStringList sorted;
+    sorted.reserve(count);
+    for (qsizetype i : order)
+        sorted.append(std::move(list[i]));
+    list.swap(sorted);
+}
 
 /*!
     \class QCollatorSortKey
@@ -18,8 +18,9 @@
 #include <stdlib.h>
 #include <time.h>
 
-#include <limits>
+#include <array>
 #include <charconv>
+#include <limits>
 
 #if defined(Q_OS_LINUX) && !defined(__UCLIBC__)
 #    include <fenv.h>
@@ -42,6 +43,66 @@ using namespace QtMiscUtils;
 
 QT_CLOCALE_HOLDER
 
+// std::to_chars() and std::from_chars() for floating-point types are exact,
+// and the standard libraries implement them with Ryu and fast_float or
+// similar algorithms, which are faster than libdouble-conversion and sscanf.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#  define QT_HAS_FLOATING_POINT_CHARCONV
+#endif
+
+#ifdef QT_HAS_FLOATING_POINT_CHARCONV
+// Shortest representation that reads back as d, in the same form as
+// DoubleToAscii's SHORTEST mode: the digits, and the position of the decimal
+// point relative to them
+static void shortestDoubleToAscii(double d, char *buf, qsizetype bufSize,
+                                  bool &sign, int &length, int &decpt)
+{
+    // "-d.ddddddddddddddde-xxx"
+    char target[std::numeric_limits<double>::max_digits10 + 8];
+    const auto r = std::to_chars(target, target + sizeof(target), d, std::chars_format::scientific);
+    Q_ASSERT(r.ec == std::errc{});
+
+    const char *p = target;
+    sign = *p == '-';
+    if (sign)
+        ++p;
+    length = 0;
+    for ( ; *p != 'e'; ++p) {
+        if (*p != '.' && length < bufSize)
+            buf[length++] = *p;
+    }
+
+    ++p; // skip 'e'
+    int exponent = 0;
+    std::from_chars(*p == '+' ? p + 1 : p, r.ptr, exponent);
+    decpt = exponent + 1;
+}
+
+// Parses a number of the form [-]digits[.digits][e[+-]digits], if that is all
+// of the input and it neither overflows nor underflows. Everything else is
+// left to the general code, which reports the details.
+static bool fastAsciiToDouble(const char *num, qsizetype numLen, double &d)
+{
+    const char *const end = num + numLen;
+    const char *p = *num == '-' ? num + 1 : num;
+    if (p == end || !(isAsciiDigit(*p) || *p == '.'))
+        return false;
+
+    const auto r = std::from_chars(num, end, d);
+    if (r.ec != std::errc{} || r.ptr != end)
+        return false;
+
+    if (isZero(d)) {
+        // make sure this isn't an underflow
+        for ( ; p < end && *p != 'e' && *p != 'E'; ++p) {
+            if (*p >= '1' && *p <= '9')
+                return false;
+        }
+    }
+    return true;
+}
+#endif // QT_HAS_FLOATING_POINT_CHARCONV
+
 void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision,
                       char *buf, qsizetype bufSize,
                       bool &sign, int &length, int &decpt)
@@ -84,6 +145,13 @@ void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision,
     if (form == QLocaleData::DFSignificantDigits && precision == 0)
         precision = 1; // 0 significant digits is silently converted to 1
 
+#ifdef QT_HAS_FLOATING_POINT_CHARCONV
+    if (precision == QLocale::FloatingPointShortest) {
+        shortestDoubleToAscii(d, buf, bufSize, sign, length, decpt);
+        return;
+    }
+#endif
+
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
     // one digit before the decimal dot, counts as significant digit for DoubleToStringConverter
     if (form == QLocaleData::DFExponent && precision >= 0)
@@ -293,6 +361,11 @@ QSimpleParsedNumber<double> qt_asciiToDouble(const char *num, qsizetype numLen,
     }
 
     double d = 0.0;
+#ifdef QT_HAS_FLOATING_POINT_CHARCONV
+    if (fastAsciiToDouble(num, numLen, d))
+        return { d, numLen };
+#endif
+
     int processed;
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
     int conv_flags = double_conversion::StringToDoubleConverter::NO_FLAGS;
@@ -469,6 +542,18 @@ QSimpleParsedNumber<qlonglong> qstrntoll(const char *begin, qsizetype size, int
     return { negate ? -result : result, res.ptr - begin };
 }
 
+#ifndef __OPTIMIZE_SIZE__
+// "00", "01", ..., "99"
+static constexpr auto decimalDigitPairs = []() constexpr {
+    std::array<char, 200> pairs {};
+    for (int i = 0; i < 100; ++i) {
+        pairs[2 * i] = char('0' + i / 10);
+        pairs[2 * i + 1] = char('0' + i % 10);
+    }
+    return pairs;
+}();
+#endif
+
 template <typename Char>
 static Q_ALWAYS_INLINE void qulltoString_helper(qulonglong number, int base, Char *&p)
 {
@@ -489,7 +574,22 @@ static Q_ALWAYS_INLINE void qulltoString_helper(qulonglong number, int base, Cha
 
     case 2: SMALL_BASE_LOOP(2); break;
     case 8: SMALL_BASE_LOOP(8); break;
-    case 10: SMALL_BASE_LOOP(10); break;
+    case 10:
+        // Two digits per division, which halves the number of (slow) 64-bit
+        // divisions:
+        while (number >= 100) {
+            const uint r = uint(number % 100);
+            number /= 100;
+            *--p = Char(decimalDigitPairs[2 * r + 1]);
+            *--p = Char(decimalDigitPairs[2 * r]);
+        }
+        if (number >= 10) {
+            *--p = Char(decimalDigitPairs[2 * number + 1]);
+            *--p = Char(decimalDigitPairs[2 * number]);
+        } else {
+            *--p = Char('0' + number);
+        }
+        break;
     case 16: BIG_BASE_LOOP(16); break;
 #undef SMALL_BASE_LOOP
 #endif
@@ -0,0 +1,897 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmultistringmatcher.h"
+
+#include <QtCore/qlatin1stringmatcher.h>
+#include <private/qsimd_p.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Both matchers compile their patterns into one Aho-Corasick automaton, so
+    the text is scanned once however many patterns there are.
+
+    The alphabet is reduced to the code units that occur in the patterns,
+    plus one class for everything else. As long as that keeps the table
+    small, the automaton is a DFA with a transition for every state and
+    class; otherwise it keeps the sparse trie and follows failure links.
+
+    When the patterns start with only a few different code units, the
+    scanner uses SIMD compares to skip over text that can't start a match
+    while it is in the start state.
+
+    Case-insensitive matching folds both the patterns and the text: Latin-1
+    for the byte matcher, and Unicode simple case folding for the string
+    matcher. Both keep the length of the text, so positions in the folded
+    text are positions in the original.
+*/
+
+namespace {
+
+// don't build a DFA bigger than this, in transitions
+constexpr qsizetype MaxDenseTableSize = 1 << 22;
+// number of different code units that can start a match for the SIMD filter
+constexpr qsizetype MaxFilterUnits = 16;
+
+inline uchar foldLatin1(uchar c) noexcept
+{
+    return uchar(QtPrivate::QCaseInsensitiveLatin1Hash{}(char(c)));
+}
+
+inline char16_t foldUtf16(char16_t c) noexcept
+{
+    if (c < 0x80)
+        return c >= u'A' && c <= u'Z' ? c | 0x20 : c;
+    return char16_t(QChar::toCaseFolded(char32_t(c)));
+}
+
+template <typename Char> class Automaton
+{
+public:
+    using Pattern = std::vector<Char>;
+
+    void build(const std::vector<Pattern> &patterns);
+    void setFilter(const std::vector<Char> &units);
+
+    qsizetype patternLength(qsizetype patternIndex) const { return lengths[patternIndex]; }
+    qsizetype maximumLength() const { return maxLength; }
+
+    // Calls report(end, patternIndex) for every match ending before limit,
+    // which report() returns the new value of.
+    template <typename Report>
+    void scan(const Char *text, qsizetype from, qsizetype size, bool fold, Report report) const
+    {
+        if (!delta.empty())
+            scanImpl<true>(text, from, size, fold, report);
+        else
+            scanImpl<false>(text, from, size, fold, report);
+    }
+
+private:
+    quint16 classOf(Char c) const noexcept
+    {
+        if constexpr (sizeof(Char) == 1)
+            return classTable[c];
+        else
+            return classTable[pageIndex[c >> 8] * 256 + (c & 0xff)];
+    }
+    quint16 addClass(Char c);
+
+    qint32 sparseStep(qint32 state, quint16 cls) const noexcept;
+    qsizetype skipToCandidate(const Char *text, qsizetype from, qsizetype size) const noexcept;
+
+    template <bool Dense, typename Report>
+    void scanImpl(const Char *text, qsizetype from, qsizetype size, bool fold, Report report) const;
+
+    // alphabet: pages of 256 classes, the first one for units without a class
+    std::vector<quint16> classTable;
+    quint16 pageIndex[sizeof(Char) == 1 ? 1 : 256] = {};
+    qsizetype classCount = 1;
+
+    // dense transitions: delta[state * classCount + class]
+    std::vector<qint32> delta;
+    // sparse transitions: edges[edgeStart[state]] to edges[edgeStart[state + 1]],
+    // sorted by class, and the failure links
+    std::vector<std::pair<quint16, qint32>> edges;
+    std::vector<qint32> edgeStart;
+    std::vector<qint32> fail;
+
+    std::vector<qint32> output;     // the first pattern recognized in a state, or -1
+    std::vector<qint32> firstOut;   // the state itself or dictLink, if either has an output
+    std::vector<qint32> dictLink;   // the next state on the failure chain with an output
+    std::vector<qint32> nextSame;   // the next pattern with the same (folded) text
+    std::vector<qsizetype> lengths;
+    qsizetype maxLength = 0;
+
+    Char filter[MaxFilterUnits] = {};
+    qsizetype filterSize = 0;
+};
+
+template <typename Char>
+quint16 Automaton<Char>::addClass(Char c)
+{
+    const quint16 cls = quint16(classCount++);
+    if constexpr (sizeof(Char) == 1) {
+        classTable[c] = cls;
+    } else {
+        quint16 &page = pageIndex[c >> 8];
+        if (page == 0) {
+            page = quint16(classTable.size() / 256);
+            classTable.resize(classTable.size() + 256);
+        }
+        classTable[page * 256 + (c & 0xff)] = cls;
+    }
+    return cls;
+}
+
+template <typename Char>
+void Automaton<Char>::build(const std::vector<Pattern> &patterns)
+{
+    classTable.assign(256, 0);
+    std::vector<std::vector<std::pair<quint16, qint32>>> children(1);
+    output.assign(1, -1);
+    nextSame.assign(patterns.size(), -1);
+    lengths.resize(patterns.size());
+
+    // the trie
+    for (qsizetype i = 0; i < qsizetype(patterns.size()); ++i) {
+        const Pattern &pattern = patterns[i];
+        lengths[i] = qsizetype(pattern.size());
+        if (pattern.empty())
+            continue;   // never matches
+        maxLength = qMax(maxLength, lengths[i]);
+
+        qint32 state = 0;
+        for (Char c : pattern) {
+            quint16 cls = classOf(c);
+            if (!cls)
+                cls = addClass(c);
+            auto &kids = children[state];
+            const auto it = std::lower_bound(kids.begin(), kids.end(), cls,
+                                             [](const auto &e, quint16 k) { return e.first < k; });
+            if (it != kids.end() && it->first == cls) {
+                state = it->second;
+            } else {
+                const qint32 next = qint32(children.size());
+                kids.insert(it, { cls, next });
+                children.emplace_back();
+                output.push_back(-1);
+                state = next;
+            }
+        }
+
+        if (output[state] < 0) {
+            output[state] = qint32(i);
+        } else {
+            qint32 last = output[state];
+            while (nextSame[last] >= 0)
+                last = nextSame[last];
+            nextSame[last] = qint32(i);
+        }
+    }
+
+    const auto child = [&children](qint32 state, quint16 cls) {
+        for (const auto &[k, next] : children[state]) {
+            if (k == cls)
+                return next;
+        }
+        return -1;
+    };
+
+    // failure and dictionary links, breadth first
+    const qsizetype stateCount = qsizetype(children.size());
+    fail.assign(stateCount, 0);
+    dictLink.assign(stateCount, -1);
+    firstOut.assign(stateCount, -1);
+    std::vector<qint32> order;
+    order.reserve(stateCount);
+    order.push_back(0);
+    for (qsizetype head = 0; head < qsizetype(order.size()); ++head) {
+        const qint32 state = order[head];
+        for (const auto &[cls, next] : children[state]) {
+            if (state != 0) {
+                qint32 f = fail[state];
+                qint32 target;
+                while ((target = child(f, cls)) < 0 && f != 0)
+                    f = fail[f];
+                fail[next] = qMax(target, 0);
+            }
+            const qint32 f = fail[next];
+            dictLink[next] = output[f] >= 0 ? f : dictLink[f];
+            firstOut[next] = output[next] >= 0 ? next : dictLink[next];
+            order.push_back(next);
+        }
+    }
+
+    if (stateCount * classCount <= MaxDenseTableSize) {
+        // the failure state of a state comes before it in breadth-first
+        // order, so its row is complete by the time we copy it
+        delta.assign(stateCount * classCount, 0);
+        for (qint32 state : order) {
+            qint32 *row = delta.data() + state * classCount;
+            if (state != 0)
+                std::copy_n(delta.data() + fail[state] * classCount, classCount, row);
+            for (const auto &[cls, next] : children[state])
+                row[cls] = next;
+        }
+        fail = {};
+    } else {
+        edgeStart.resize(stateCount + 1);
+        for (qsizetype state = 0; state < stateCount; ++state) {
+            edgeStart[state] = qint32(edges.size());
+            edges.insert(edges.end(), children[state].begin(), children[state].end());
+        }
+        edgeStart[stateCount] = qint32(edges.size());
+    }
+}
+
+template <typename Char>
+void Automaton<Char>::setFilter(const std::vector<Char> &units)
+{
+    filterSize = 0;
+    if (qsizetype(units.size()) > MaxFilterUnits)
+        return;
+    std::copy(units.begin(), units.end(), filter);
+    filterSize = qsizetype(units.size());
+}
+
+template <typename Char>
+qint32 Automaton<Char>::sparseStep(qint32 state, quint16 cls) const noexcept
+{
+    if (cls == 0)
+        return 0;   // not in any pattern
+    for (;;) {
+        const auto begin = edges.begin() + edgeStart[state];
+        const auto end = edges.begin() + edgeStart[state + 1];
+        const auto it = std::lower_bound(begin, end, cls,
+                                         [](const auto &e, quint16 k) { return e.first < k; });
+        if (it != end && it->first == cls)
+            return it->second;
+        if (state == 0)
+            return 0;
+        state = fail[state];
+    }
+}
+
+// Returns the first position from \a from on whose code unit can start a match.
+template <typename Char>
+qsizetype Automaton<Char>::skipToCandidate(const Char *text, qsizetype from,
+                                           qsizetype size) const noexcept
+{
+    qsizetype i = from;
+#if defined(__SSE2__)
+    if constexpr (sizeof(Char) == 1) {
+        __m128i needles[MaxFilterUnits];
+        for (qsizetype k = 0; k < filterSize; ++k)
+            needles[k] = _mm_set1_epi8(char(filter[k]));
+        for (; i + 16 <= size; i += 16) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+            __m128i hits = _mm_cmpeq_epi8(chunk, needles[0]);
+            for (qsizetype k = 1; k < filterSize; ++k)
+                hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, needles[k]));
+            if (const uint mask = _mm_movemask_epi8(hits))
+                return i + qCountTrailingZeroBits(mask);
+        }
+    } else {
+        __m128i needles[MaxFilterUnits];
+        for (qsizetype k = 0; k < filterSize; ++k)
+            needles[k] = _mm_set1_epi16(short(filter[k]));
+        for (; i + 8 <= size; i += 8) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+            __m128i hits = _mm_cmpeq_epi16(chunk, needles[0]);
+            for (qsizetype k = 1; k < filterSize; ++k)
+                hits = _mm_or_si128(hits, _mm_cmpeq_epi16(chunk, needles[k]));
+            if (const uint mask = _mm_movemask_epi8(hits))
+                return i + qCountTrailingZeroBits(mask) / 2;
+        }
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    if constexpr (sizeof(Char) == 1) {
+        uint8x16_t needles[MaxFilterUnits];
+        for (qsizetype k = 0; k < filterSize; ++k)
+            needles[k] = vdupq_n_u8(filter[k]);
+        for (; i + 16 <= size; i += 16) {
+            const uint8x16_t chunk = vld1q_u8(text + i);
+            uint8x16_t hits = vceqq_u8(chunk, needles[0]);
+            for (qsizetype k = 1; k < filterSize; ++k)
+                hits = vorrq_u8(hits, vceqq_u8(chunk, needles[k]));
+            if (vmaxvq_u8(hits))
+                break;      // find it below
+        }
+    } else {
+        uint16x8_t needles[MaxFilterUnits];
+        for (qsizetype k = 0; k < filterSize; ++k)
+            needles[k] = vdupq_n_u16(filter[k]);
+        for (; i + 8 <= size; i += 8) {
+            const uint16x8_t chunk = vld1q_u16(reinterpret_cast<const uint16_t *>(text + i));
+            uint16x8_t hits = vceqq_u16(chunk, needles[0]);
+            for (qsizetype k = 1; k < filterSize; ++k)
+                hits = vorrq_u16(hits, vceqq_u16(chunk, needles[k]));
+            if (vmaxvq_u16(hits))
+                break;
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        if (std::find(filter, filter + filterSize, text[i]) != filter + filterSize)
+            return i;
+    }
+    return size;
+}
+
+template <typename Char>
+template <bool Dense, typename Report>
+void Automaton<Char>::scanImpl(const Char *text, qsizetype from, qsizetype size, bool fold,
+                               Report report) const
+{
+    qint32 state = 0;
+    char16_t pendingLow = 0;    // second half of a folded surrogate pair
+    qsizetype limit = size;
+    for (qsizetype i = from; i < limit; ++i) {
+        if (state == 0 && filterSize && !pendingLow) {
+            i = skipToCandidate(text, i, limit);
+            if (i == limit)
+                break;
+        }
+
+        Char c = text[i];
+        if (fold) {
+            if constexpr (sizeof(Char) == 1) {
+                c = foldLatin1(c);
+            } else if (pendingLow) {
+                c = std::exchange(pendingLow, 0);
+            } else if (QChar::isHighSurrogate(c) && i + 1 < size
+                       && QChar::isLowSurrogate(text[i + 1])) {
+                const char32_t folded =
+                        QChar::toCaseFolded(QChar::surrogateToUcs4(c, text[i + 1]));
+                c = QChar::highSurrogate(folded);
+                pendingLow = QChar::lowSurrogate(folded);
+            } else {
+                c = foldUtf16(c);
+            }
+        }
+
+        if constexpr (Dense)
+            state = delta[state * classCount + classOf(c)];
+        else
+            state = sparseStep(state, classOf(c));
+
+        for (qint32 out = firstOut[state]; out >= 0; out = dictLink[out]) {
+            for (qint32 pattern = output[out]; pattern >= 0; pattern = nextSame[pattern])
+                limit = qMin(limit, report(i + 1, qsizetype(pattern)));
+        }
+    }
+}
+
+// Sets up the SIMD filter from the first code units of the (folded) patterns
+// and the units that fold to them.
+template <typename Char>
+void setUpFilter(Automaton<Char> &automaton,
+                 const std::vector<typename Automaton<Char>::Pattern> &patterns, bool fold)
+{
+    std::vector<Char> first;
+    for (const auto &pattern : patterns) {
+        if (pattern.empty())
+            continue;
+        if (std::find(first.begin(), first.end(), pattern.front()) == first.end())
+            first.push_back(pattern.front());
+        if (qsizetype(first.size()) > MaxFilterUnits)
+            return;
+    }
+    if (first.empty())
+        return;
+    if (!fold) {
+        automaton.setFilter(first);
+        return;
+    }
+
+    std::vector<Char> units;
+    constexpr char32_t LastUnit = sizeof(Char) == 1 ? 0xff : 0xffff;
+    for (char32_t u = 0; u <= LastUnit; ++u) {
+        const Char c = Char(u);
+        Char folded;
+        if constexpr (sizeof(Char) == 1) {
+            folded = foldLatin1(c);
+        } else {
+            if (QChar::isSurrogate(u)) {
+                // can't tell from a single unit; don't filter if that matters
+                if (std::find(first.begin(), first.end(), c) != first.end())
+                    return;
+                continue;
+            }
+            folded = foldUtf16(c);
+        }
+        if (std::find(first.begin(), first.end(), folded) != first.end()) {
+            units.push_back(c);
+            if (qsizetype(units.size()) > MaxFilterUnits)
+                return;
+        }
+    }
+    automaton.setFilter(units);
+}
+
+std::vector<uchar> foldedPattern(QByteArrayView pattern, bool fold)
+{
+    std::vector<uchar> result(pattern.begin(), pattern.end());
+    if (fold)
+        std::transform(result.begin(), result.end(), result.begin(), foldLatin1);
+    return result;
+}
+
+std::vector<char16_t> foldedPattern(QStringView pattern, bool fold)
+{
+    std::vector<char16_t> result(pattern.utf16(), pattern.utf16() + pattern.size());
+    if (!fold)
+        return result;
+    for (size_t i = 0; i < result.size(); ++i) {
+        if (QChar::isHighSurrogate(result[i]) && i + 1 < result.size()
+                && QChar::isLowSurrogate(result[i + 1])) {
+            const char32_t folded =
+                    QChar::toCaseFolded(QChar::surrogateToUcs4(result[i], result[i + 1]));
+            result[i] = QChar::highSurrogate(folded);
+            result[++i] = QChar::lowSurrogate(folded);
+        } else {
+            result[i] = foldUtf16(result[i]);
+        }
+    }
+    return result;
+}
+
+template <typename Match, typename Char>
+Match firstMatch(const Automaton<Char> &automaton, const Char *text, qsizetype size,
+                 qsizetype from, bool fold)
+{
+    // The leftmost match, and the longest one of those. We've seen all
+    // candidates once we are past its start by the longest pattern.
+    Match best;
+    automaton.scan(text, from, size, fold, [&](qsizetype end, qsizetype patternIndex) {
+        const qsizetype length = automaton.patternLength(patternIndex);
+        const qsizetype position = end - length;
+        if (!best.isValid() || position < best.position
+                || (position == best.position && length > best.length)) {
+            best = Match{ position, length, patternIndex };
+        }
+        return best.position + automaton.maximumLength();
+    });
+    return best;
+}
+
+template <typename Match, typename Char>
+QList<Match> allMatches(const Automaton<Char> &automaton, const Char *text, qsizetype size,
+                        qsizetype from, bool fold)
+{
+    QList<Match> result;
+    automaton.scan(text, from, size, fold, [&](qsizetype end, qsizetype patternIndex) {
+        const qsizetype length = automaton.patternLength(patternIndex);
+        result.append(Match{ end - length, length, patternIndex });
+        return size;
+    });
+    return result;
+}
+
+inline qsizetype normalizedFrom(qsizetype from, qsizetype size)
+{
+    if (from < 0)
+        from = qMax(from + size, qsizetype(0));
+    return from;
+}
+
+} // unnamed namespace
+
+class QMultiByteArrayMatcherPrivate : public QSharedData
+{
+public:
+    QByteArrayList patterns;
+    Qt::CaseSensitivity cs = Qt::CaseSensitive;
+    Automaton<uchar> automaton;
+};
+
+class QMultiStringMatcherPrivate : public QSharedData
+{
+public:
+    QStringList patterns;
+    Qt::CaseSensitivity cs = Qt::CaseSensitive;
+    Automaton<char16_t> automaton;
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QMultiByteArrayMatcherPrivate)
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QMultiStringMatcherPrivate)
+
+/*!
+    \class QMultiByteArrayMatcher
+    \inmodule QtCore
+    \since 6.9
+    \brief The QMultiByteArrayMatcher class finds any of a set of byte
+    sequences in a byte array.
+
+    \ingroup tools
+    \ingroup string-processing
+    \reentrant
+
+    QMultiByteArrayMatcher searches for many patterns at the same time. It
+    compiles them into a single automaton, so a search reads the data only
+    once, however many patterns there are. This is much faster than
+    searching for each pattern with a QByteArrayMatcher, or than matching
+    a QRegularExpression that lists all patterns as alternatives.
+
+    Construct the matcher with the list of patterns, then call match() to
+    find the first match in some data, or matches() to find all of them.
+    Each match reports which pattern was found, as an index into the list:
+
+    \snippet code/src_corelib_text_qmultistringmatcher.cpp 0
+
+    With Qt::CaseInsensitive, the patterns and the data are compared as
+    Latin-1 text ignoring case.
+
+    Building the automaton takes time proportional to the total length of
+    the patterns, so it pays off when a matcher is used for many searches.
+    Copies of a matcher share the automaton.
+
+    \sa QMultiStringMatcher, QByteArrayMatcher
+*/
+
+/*!
+    \class QMultiByteArrayMatcher::Match
+    \inmodule QtCore
+    \since 6.9
+    \brief The Match struct describes where a pattern was found.
+
+    \sa QMultiByteArrayMatcher::match(), QMultiByteArrayMatcher::matches()
+*/
+
+/*!
+    \variable QMultiByteArrayMatcher::Match::position
+
+    The position of the match in the data, or -1 for a default-constructed
+    Match.
+*/
+
+/*!
+    \variable QMultiByteArrayMatcher::Match::length
+
+    The length of the match, which is the length of the pattern.
+*/
+
+/*!
+    \variable QMultiByteArrayMatcher::Match::patternIndex
+
+    The index of the pattern that was found in the list of patterns.
+*/
+
+/*!
+    \fn bool QMultiByteArrayMatcher::Match::isValid() const
+
+    Returns \c true if this describes a match, \c false if no pattern was
+    found.
+*/
+
+/*!
+    Constructs an empty matcher, which never finds a match.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher() noexcept = default;
+
+/*!
+    Constructs a matcher that searches for the given \a patterns, with case
+    sensitivity \a cs.
+
+    Empty patterns never match.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(const QByteArrayList &patterns,
+                                               Qt::CaseSensitivity cs)
+{
+    setPatterns(patterns, cs);
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(const QMultiByteArrayMatcher &other) noexcept
+    = default;
+
+/*!
+    \fn QMultiByteArrayMatcher::QMultiByteArrayMatcher(QMultiByteArrayMatcher &&other)
+
+    Move-constructs a matcher from \a other.
+*/
+
+/*!
+    Assigns \a other to this matcher and returns a reference to it.
+*/
+QMultiByteArrayMatcher &
+QMultiByteArrayMatcher::operator=(const QMultiByteArrayMatcher &other) noexcept = default;
+
+/*!
+    \fn QMultiByteArrayMatcher &QMultiByteArrayMatcher::operator=(QMultiByteArrayMatcher &&other)
+
+    Move-assigns \a other to this matcher and returns a reference to it.
+*/
+
+/*!
+    \fn void QMultiByteArrayMatcher::swap(QMultiByteArrayMatcher &other)
+    \memberswap{matcher}
+*/
+
+/*!
+    Destroys the matcher.
+*/
+QMultiByteArrayMatcher::~QMultiByteArrayMatcher() = default;
+
+/*!
+    Sets the patterns to search for to \a patterns, with case sensitivity
+    \a cs.
+
+    \sa patterns(), caseSensitivity()
+*/
+void QMultiByteArrayMatcher::setPatterns(const QByteArrayList &patterns, Qt::CaseSensitivity cs)
+{
+    const bool fold = cs == Qt::CaseInsensitive;
+    std::vector<std::vector<uchar>> folded;
+    folded.reserve(patterns.size());
+    for (const QByteArray &pattern : patterns)
+        folded.push_back(foldedPattern(pattern, fold));
+
+    auto dd = new QMultiByteArrayMatcherPrivate;
+    dd->patterns = patterns;
+    dd->cs = cs;
+    dd->automaton.build(folded);
+    setUpFilter(dd->automaton, folded, fold);
+    d.reset(dd);
+}
+
+/*!
+    Returns the patterns this matcher searches for.
+
+    \sa setPatterns()
+*/
+QByteArrayList QMultiByteArrayMatcher::patterns() const
+{
+    return d ? d->patterns : QByteArrayList();
+}
+
+/*!
+    Returns the case sensitivity of the matcher.
+
+    \sa setPatterns()
+*/
+Qt::CaseSensitivity QMultiByteArrayMatcher::caseSensitivity() const noexcept
+{
+    return d ? d->cs : Qt::CaseSensitive;
+}
+
+/*!
+    Searches \a data from position \a from for the patterns and returns the
+    first match. If several patterns match at that position, the longest
+    one wins, and of equal ones the first in the list.
+
+    If \a from is negative, the search starts that many bytes from the end.
+    Returns a Match that isn't \l{Match::isValid()}{valid} if no pattern
+    was found.
+
+    \sa matches()
+*/
+QMultiByteArrayMatcher::Match QMultiByteArrayMatcher::match(QByteArrayView data,
+                                                            qsizetype from) const
+{
+    if (!d)
+        return Match();
+    return firstMatch<Match>(d->automaton, reinterpret_cast<const uchar *>(data.data()),
+                             data.size(), normalizedFrom(from, data.size()),
+                             d->cs == Qt::CaseInsensitive);
+}
+
+/*!
+    Searches \a data from position \a from for the patterns and returns all
+    matches, including overlapping ones. The matches are ordered by where
+    they end; of matches that end at the same position, longer ones come
+    first.
+
+    If \a from is negative, the search starts that many bytes from the end.
+
+    \sa match()
+*/
+QList<QMultiByteArrayMatcher::Match> QMultiByteArrayMatcher::matches(QByteArrayView data,
+                                                                     qsizetype from) const
+{
+    if (!d)
+        return {};
+    return allMatches<Match>(d->automaton, reinterpret_cast<const uchar *>(data.data()),
+                             data.size(), normalizedFrom(from, data.size()),
+                             d->cs == Qt::CaseInsensitive);
+}
+
+/*!
+    \class QMultiStringMatcher
+    \inmodule QtCore
+    \since 6.9
+    \brief The QMultiStringMatcher class finds any of a set of strings in a
+    Unicode string.
+
+    \ingroup tools
+    \ingroup string-processing
+    \reentrant
+
+    QMultiStringMatcher is the UTF-16 counterpart of QMultiByteArrayMatcher.
+    It searches for many patterns in one pass over the string, which is
+    much faster than using a QStringMatcher for each of them, or a
+    QRegularExpression that lists all patterns as alternatives:
+
+    \snippet code/src_corelib_text_qmultistringmatcher.cpp 1
+
+    With Qt::CaseInsensitive, the patterns and the string are compared
+    after simple Unicode case folding, as done by QChar::toCaseFolded().
+    Positions and lengths are in UTF-16 code units.
+
+    \sa QMultiByteArrayMatcher, QStringMatcher
+*/
+
+/*!
+    \class QMultiStringMatcher::Match
+    \inmodule QtCore
+    \since 6.9
+    \brief The Match struct describes where a pattern was found.
+
+    \sa QMultiStringMatcher::match(), QMultiStringMatcher::matches()
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::position
+
+    The position of the match in the string, or -1 for a default-constructed
+    Match.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::length
+
+    The length of the match, which is the length of the pattern.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::patternIndex
+
+    The index of the pattern that was found in the list of patterns.
+*/
+
+/*!
+    \fn bool QMultiStringMatcher::Match::isValid() const
+
+    Returns \c true if this describes a match, \c false if no pattern was
+    found.
+*/
+
+/*!
+    Constructs an empty matcher, which never finds a match.
+*/
+QMultiStringMatcher::QMultiStringMatcher() noexcept = default;
+
+/*!
+    Constructs a matcher that searches for the given \a patterns, with case
+    sensitivity \a cs.
+
+    Empty patterns never match.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QStringList &patterns, Qt::CaseSensitivity cs)
+{
+    setPatterns(patterns, cs);
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QMultiStringMatcher &other) noexcept = default;
+
+/*!
+    \fn QMultiStringMatcher::QMultiStringMatcher(QMultiStringMatcher &&other)
+
+    Move-constructs a matcher from \a other.
+*/
+
+/*!
+    Assigns \a other to this matcher and returns a reference to it.
+*/
+QMultiStringMatcher &
+QMultiStringMatcher::operator=(const QMultiStringMatcher &other) noexcept = default;
+
+/*!
+    \fn QMultiStringMatcher &QMultiStringMatcher::operator=(QMultiStringMatcher &&other)
+
+    Move-assigns \a other to this matcher and returns a reference to it.
+*/
+
+/*!
+    \fn void QMultiStringMatcher::swap(QMultiStringMatcher &other)
+    \memberswap{matcher}
+*/
+
+/*!
+    Destroys the matcher.
+*/
+QMultiStringMatcher::~QMultiStringMatcher() = default;
+
+/*!
+    Sets the patterns to search for to \a patterns, with case sensitivity
+    \a cs.
+
+    \sa patterns(), caseSensitivity()
+*/
+void QMultiStringMatcher::setPatterns(const QStringList &patterns, Qt::CaseSensitivity cs)
+{
+    const bool fold = cs == Qt::CaseInsensitive;
+    std::vector<std::vector<char16_t>> folded;
+    folded.reserve(patterns.size());
+    for (const QString &pattern : patterns)
+        folded.push_back(foldedPattern(pattern, fold));
+
+    auto dd = new QMultiStringMatcherPrivate;
+    dd->patterns = patterns;
+    dd->cs = cs;
+    dd->automaton.build(folded);
+    setUpFilter(dd->automaton, folded, fold);
+    d.reset(dd);
+}
+
+/*!
+    Returns the patterns this matcher searches for.
+
+    \sa setPatterns()
+*/
+QStringList QMultiStringMatcher::patterns() const
+{
+    return d ? d->patterns : QStringList();
+}
+
+/*!
+    Returns the case sensitivity of the matcher.
+
+    \sa setPatterns()
+*/
+Qt::CaseSensitivity QMultiStringMatcher::caseSensitivity() const noexcept
+{
+    return d ? d->cs : Qt::CaseSensitive;
+}
+
+/*!
+    Searches \a str from position \a from for the patterns and returns the
+    first match. If several patterns match at that position, the longest
+    one wins, and of equal ones the first in the list.
+
+    If \a from is negative, the search starts that many characters from the
+    end. Returns a Match that isn't \l{Match::isValid()}{valid} if no
+    pattern was found.
+
+    \sa matches()
+*/
+QMultiStringMatcher::Match QMultiStringMatcher::match(QStringView str, qsizetype from) const
+{
+    if (!d)
+        return Match();
+    return firstMatch<Match>(d->automaton, str.utf16(), str.size(),
+                             normalizedFrom(from, str.size()), d->cs == Qt::CaseInsensitive);
+}
+
+/*!
+    Searches \a str from position \a from for the patterns and returns all
+    matches, including overlapping ones. The matches are ordered by where
+    they end; of matches that end at the same position, longer ones come
+    first.
+
+    If \a from is negative, the search starts that many characters from the
+    end.
+
+    \sa match()
+*/
+QList<QMultiStringMatcher::Match> QMultiStringMatcher::matches(QStringView str,
+                                                               qsizetype from) const
+{
+    if (!d)
+        return {};
+    return allMatches<Match>(d->automaton, str.utf16(), str.size(),
+                             normalizedFrom(from, str.size()), d->cs == Qt::CaseInsensitive);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,95 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMULTISTRINGMATCHER_H
+#define QMULTISTRINGMATCHER_H
+
+#include <QtCore/qbytearraylist.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qstringview.h>
+
+QT_BEGIN_NAMESPACE
+
+class QMultiByteArrayMatcherPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QMultiByteArrayMatcherPrivate, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QMultiByteArrayMatcher
+{
+public:
+    struct Match
+    {
+        qsizetype position = -1;
+        qsizetype length = 0;
+        qsizetype patternIndex = -1;
+
+        constexpr bool isValid() const noexcept { return position >= 0; }
+    };
+
+    QMultiByteArrayMatcher() noexcept;
+    explicit QMultiByteArrayMatcher(const QByteArrayList &patterns,
+                                    Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    QMultiByteArrayMatcher(const QMultiByteArrayMatcher &other) noexcept;
+    QMultiByteArrayMatcher(QMultiByteArrayMatcher &&other) noexcept = default;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QMultiByteArrayMatcher)
+    QMultiByteArrayMatcher &operator=(const QMultiByteArrayMatcher &other) noexcept;
+    ~QMultiByteArrayMatcher();
+
+    void swap(QMultiByteArrayMatcher &other) noexcept { d.swap(other.d); }
+
+    void setPatterns(const QByteArrayList &patterns, Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    QByteArrayList patterns() const;
+    Qt::CaseSensitivity caseSensitivity() const noexcept;
+
+    Match match(QByteArrayView data, qsizetype from = 0) const;
+    QList<Match> matches(QByteArrayView data, qsizetype from = 0) const;
+
+private:
+    QExplicitlySharedDataPointer<QMultiByteArrayMatcherPrivate> d;
+};
+
+Q_DECLARE_SHARED(QMultiByteArrayMatcher)
+
+class QMultiStringMatcherPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QMultiStringMatcherPrivate, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QMultiStringMatcher
+{
+public:
+    struct Match
+    {
+        qsizetype position = -1;
+        qsizetype length = 0;
+        qsizetype patternIndex = -1;
+
+        constexpr bool isValid() const noexcept { return position >= 0; }
+    };
+
+    QMultiStringMatcher() noexcept;
+    explicit QMultiStringMatcher(const QStringList &patterns,
+                                 Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    QMultiStringMatcher(const QMultiStringMatcher &other) noexcept;
+    QMultiStringMatcher(QMultiStringMatcher &&other) noexcept = default;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QMultiStringMatcher)
+    QMultiStringMatcher &operator=(const QMultiStringMatcher &other) noexcept;
+    ~QMultiStringMatcher();
+
+    void swap(QMultiStringMatcher &other) noexcept { d.swap(other.d); }
+
+    void setPatterns(const QStringList &patterns, Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    QStringList patterns() const;
+    Qt::CaseSensitivity caseSensitivity() const noexcept;
+
+    Match match(QStringView str, qsizetype from = 0) const;
+    QList<Match> matches(QStringView str, qsizetype from = 0) const;
+
+private:
+    QExplicitlySharedDataPointer<QMultiStringMatcherPrivate> d;
+};
+
+Q_DECLARE_SHARED(QMultiStringMatcher)
+
+QT_END_NAMESPACE
+
+#endif // QMULTISTRINGMATCHER_H
@@ -13,6 +13,7 @@
 #include <QtCore/qdebug.h>
 #include <QtCore/qglobal.h>
 #include <QtCore/qatomic.h>
+#include <QtCore/qcache.h>
 #include <QtCore/qdatastream.h>
 
 #if defined(Q_OS_MACOS)
@@ -23,6 +24,8 @@
 
 #include <pcre2.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
@@ -701,6 +704,35 @@ static int convertToPcreOptions(QRegularExpression::MatchOptions matchOptions)
     return options;
 }
 
+/*!
+    \internal
+
+    Holds the result of compiling a pattern with a given set of pattern
+    options. Objects of this class are immutable once constructed, and are
+    shared (through the pattern cache) by all the QRegularExpressionPrivate
+    objects that use the same pattern and options, in any thread: PCRE2 allows
+    a compiled pattern, JIT-compiled or not, to be used concurrently.
+*/
+struct QRegularExpressionCompiledPattern
+{
+    QRegularExpressionCompiledPattern(const QString &pattern,
+                                      QRegularExpression::PatternOptions patternOptions);
+    ~QRegularExpressionCompiledPattern();
+    Q_DISABLE_COPY_MOVE(QRegularExpressionCompiledPattern)
+
+    void getPatternInfo();
+    void optimizePattern();
+
+    pcre2_code_16 *code = nullptr;
+    int errorCode = 0;
+    qsizetype errorOffset = -1;
+    int capturingCount = 0;
+    bool usingCrLfNewlines = false;
+    bool hasJOptionChanged = false;
+};
+
+using QRegularExpressionCompiledPatternPointer = std::shared_ptr<const QRegularExpressionCompiledPattern>;
+
 struct QRegularExpressionPrivate : QSharedData
 {
     QRegularExpressionPrivate();
@@ -710,7 +742,6 @@ struct QRegularExpressionPrivate : QSharedData
     void cleanCompiledPattern();
     void compilePattern();
     void getPatternInfo();
-    void optimizePattern();
 
     enum CheckSubjectStringOption {
         CheckSubjectString,
@@ -733,9 +764,11 @@ struct QRegularExpressionPrivate : QSharedData
     // (right after a detach happened).
     mutable QMutex mutex;
 
-    // The PCRE code pointer is reference-counted by the QRegularExpressionPrivate
-    // objects themselves; when the private is copied (i.e. a detach happened)
-    // it is set to nullptr
+    // The compiled pattern is shared with the pattern cache and with any other
+    // QRegularExpressionPrivate using the same pattern and options;
+    // compiledPattern is a shortcut to its PCRE code. When the private is
+    // copied (i.e. a detach happened) both are reset.
+    QRegularExpressionCompiledPatternPointer compiled;
     pcre2_code_16 *compiledPattern;
     int errorCode;
     qsizetype errorOffset;
@@ -869,7 +902,7 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
 */
 void QRegularExpressionPrivate::cleanCompiledPattern()
 {
-    pcre2_code_free_16(compiledPattern);
+    compiled.reset();
     compiledPattern = nullptr;
     errorCode = 0;
     errorOffset = -1;
@@ -877,31 +910,82 @@ void QRegularExpressionPrivate::cleanCompiledPattern()
     usingCrLfNewlines = false;
 }
 
-/*!
-    \internal
+namespace {
+struct QRegularExpressionPatternCacheKey
+{
+    QString pattern;
+    QRegularExpression::PatternOptions patternOptions;
+
+    friend bool operator==(const QRegularExpressionPatternCacheKey &lhs,
+                           const QRegularExpressionPatternCacheKey &rhs) noexcept
+    {
+        return lhs.patternOptions == rhs.patternOptions && lhs.pattern == rhs.pattern;
+    }
+
+    friend size_t qHash(const QRegularExpressionPatternCacheKey &key, size_t seed = 0) noexcept
+    {
+        return qHashMulti(seed, key.pattern, key.patternOptions);
+    }
+};
+
+/*
+    Process-wide cache of the most recently compiled patterns, so that
+    QRegularExpression objects that are created over and over again with
+    the same pattern (e.g. local variables in a function) don't pay for
+    compiling, and JIT-compiling, it every time.
 */
-void QRegularExpressionPrivate::compilePattern()
+class QRegularExpressionPatternCache
 {
-    const QMutexLocker lock(&mutex);
+public:
+    enum { MaxCachedPatterns = 256 };
 
-    if (!isDirty)
-        return;
+    QRegularExpressionCompiledPatternPointer compiledPattern(const QString &pattern,
+                                                             QRegularExpression::PatternOptions patternOptions)
+    {
+        QRegularExpressionPatternCacheKey key{ pattern, patternOptions };
+        {
+            const QMutexLocker lock(&mutex);
+            if (const auto *cached = cache.object(key))
+                return *cached;
+        }
 
-    isDirty = false;
-    cleanCompiledPattern();
+        // Compile without holding the lock, as that may take a while; if
+        // another thread was faster, use its result instead.
+        auto result = std::make_shared<const QRegularExpressionCompiledPattern>(pattern, patternOptions);
+
+        const QMutexLocker lock(&mutex);
+        if (const auto *cached = cache.object(key))
+            return *cached;
+        cache.insert(std::move(key), new QRegularExpressionCompiledPatternPointer(result));
+        return result;
+    }
+
+private:
+    QMutex mutex;
+    QCache<QRegularExpressionPatternCacheKey, QRegularExpressionCompiledPatternPointer> cache{ MaxCachedPatterns };
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QRegularExpressionPatternCache, patternCache)
 
+/*!
+    \internal
+*/
+QRegularExpressionCompiledPattern::QRegularExpressionCompiledPattern(const QString &pattern,
+                                                                     QRegularExpression::PatternOptions patternOptions)
+{
     int options = convertToPcreOptions(patternOptions);
     options |= PCRE2_UTF;
 
     PCRE2_SIZE patternErrorOffset;
-    compiledPattern = pcre2_compile_16(reinterpret_cast<PCRE2_SPTR16>(pattern.constData()),
-                                       pattern.size(),
-                                       options,
-                                       &errorCode,
-                                       &patternErrorOffset,
-                                       nullptr);
-
-    if (!compiledPattern) {
+    code = pcre2_compile_16(reinterpret_cast<PCRE2_SPTR16>(pattern.constData()),
+                            pattern.size(),
+                            options,
+                            &errorCode,
+                            &patternErrorOffset,
+                            nullptr);
+
+    if (!code) {
         errorOffset = qsizetype(patternErrorOffset);
         return;
     } else {
@@ -916,15 +1000,23 @@ void QRegularExpressionPrivate::compilePattern()
 /*!
     \internal
 */
-void QRegularExpressionPrivate::getPatternInfo()
+QRegularExpressionCompiledPattern::~QRegularExpressionCompiledPattern()
 {
-    Q_ASSERT(compiledPattern);
+    pcre2_code_free_16(code);
+}
 
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
+/*!
+    \internal
+*/
+void QRegularExpressionCompiledPattern::getPatternInfo()
+{
+    Q_ASSERT(code);
+
+    pcre2_pattern_info_16(code, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
 
     // detect the settings for the newline
     unsigned int patternNewlineSetting;
-    if (pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
+    if (pcre2_pattern_info_16(code, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
         // no option was specified in the regexp, grab PCRE build defaults
         pcre2_config_16(PCRE2_CONFIG_NEWLINE, &patternNewlineSetting);
     }
@@ -933,9 +1025,54 @@ void QRegularExpressionPrivate::getPatternInfo()
             (patternNewlineSetting == PCRE2_NEWLINE_ANY) ||
             (patternNewlineSetting == PCRE2_NEWLINE_ANYCRLF);
 
-    unsigned int hasJOptionChanged;
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
-    if (Q_UNLIKELY(hasJOptionChanged)) {
+    unsigned int jOptionChanged;
+    pcre2_pattern_info_16(code, PCRE2_INFO_JCHANGED, &jOptionChanged);
+    hasJOptionChanged = jOptionChanged;
+}
+
+/*!
+    \internal
+
+    Gets the compiled pattern from the pattern cache, compiling it if it's
+    not there.
+*/
+void QRegularExpressionPrivate::compilePattern()
+{
+    const QMutexLocker lock(&mutex);
+
+    if (!isDirty)
+        return;
+
+    isDirty = false;
+    cleanCompiledPattern();
+
+    if (QRegularExpressionPatternCache *cache = patternCache())
+        compiled = cache->compiledPattern(pattern, patternOptions);
+    else // called during the destruction of global statics
+        compiled = std::make_shared<const QRegularExpressionCompiledPattern>(pattern, patternOptions);
+
+    compiledPattern = compiled->code;
+    if (!compiledPattern) {
+        errorCode = compiled->errorCode;
+        errorOffset = compiled->errorOffset;
+        return;
+    }
+
+    getPatternInfo();
+}
+
+/*!
+    \internal
+*/
+void QRegularExpressionPrivate::getPatternInfo()
+{
+    Q_ASSERT(compiled && compiledPattern);
+
+    capturingCount = compiled->capturingCount;
+    usingCrLfNewlines = compiled->usingCrLfNewlines;
+
+    // warn every time, not just the first time the pattern gets compiled
+    if (Q_UNLIKELY(compiled->hasJOptionChanged)) {
         qWarning("QRegularExpressionPrivate::getPatternInfo(): the pattern '%ls'\n    is using the (?J) option; duplicate capturing group names are not supported by Qt",
                  qUtf16Printable(pattern));
     }
@@ -993,19 +1130,19 @@ static bool isJitEnabled()
     The purpose of the function is to call pcre2_jit_compile_16, which
     JIT-compiles the pattern.
 
-    It gets called when a pattern is recompiled by us (in compilePattern()),
-    under mutex protection.
+    It gets called once, when the pattern gets compiled, before the compiled
+    pattern is shared with anyone.
 */
-void QRegularExpressionPrivate::optimizePattern()
+void QRegularExpressionCompiledPattern::optimizePattern()
 {
-    Q_ASSERT(compiledPattern);
+    Q_ASSERT(code);
 
     static const bool enableJit = isJitEnabled();
 
     if (!enableJit)
         return;
 
-    pcre2_jit_compile_16(compiledPattern, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
+    pcre2_jit_compile_16(code, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
 }
 
 /*!
@@ -1721,6 +1858,73 @@ QRegularExpressionMatchIterator QRegularExpression::globalMatchView(QStringView
     return QRegularExpressionMatchIterator(*priv);
 }
 
+/*!
+    \since 6.9
+
+    Attempts to match the regular expression against each string view in
+    \a subjects, honoring the given \a matchOptions, and returns the offsets
+    of the first match found in each of them.
+
+    The result holds \c{2 * (captureCount() + 1)} offsets for each subject, in
+    the same order as \a subjects: the start and end offsets of the implicit
+    capturing group 0, followed by the ones of each capturing group. All of
+    them are -1 for a subject that does not match, as well as for any group
+    that did not capture anything.
+
+    This is meant for matching the same regular expression against many short
+    strings, such as the lines of a log file: it allocates the result and
+    the matching resources once for the whole batch, rather than creating a
+    QRegularExpressionMatch for every subject. Use matchView() when you need
+    partial matching, named groups, or a starting offset.
+
+    If the regular expression is not valid, a warning is printed and an
+    empty list is returned.
+
+    \snippet code/src_corelib_text_qregularexpression.cpp 37
+
+    \sa matchView(), captureCount(), isValid()
+*/
+QList<qsizetype> QRegularExpression::matchOffsets(QSpan<const QStringView> subjects,
+                                                  MatchOptions matchOptions) const
+{
+    d.data()->compilePattern();
+
+    const pcre2_code_16 *code = d->compiledPattern;
+    if (Q_UNLIKELY(!code)) {
+        qtWarnAboutInvalidRegularExpression(d->pattern, "QRegularExpression::matchOffsets");
+        return {};
+    }
+
+    const qsizetype stride = 2 * (qsizetype(d->capturingCount) + 1);
+    QList<qsizetype> offsets(subjects.size() * stride, -1);
+
+    pcre2_match_context_16 *matchContext = pcre2_match_context_create_16(nullptr);
+    pcre2_jit_stack_assign_16(matchContext, &qtPcreCallback, nullptr);
+    pcre2_match_data_16 *matchData = pcre2_match_data_create_from_pattern_16(code, nullptr);
+    const PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_16(matchData);
+    const int pcreOptions = convertToPcreOptions(matchOptions);
+
+    // see QRegularExpressionPrivate::doMatch() about null subjects
+    const char16_t dummySubject = 0;
+    qsizetype *out = offsets.data();
+    for (QStringView subject : subjects) {
+        const char16_t *subjectUtf16 = subject.utf16() ? subject.utf16() : &dummySubject;
+        const int result = safe_pcre2_match_16(code,
+                                               reinterpret_cast<PCRE2_SPTR16>(subjectUtf16),
+                                               subject.size(), 0, pcreOptions,
+                                               matchData, matchContext);
+        // ovector holds PCRE2_UNSET, i.e. -1 as a qsizetype, for unset groups
+        for (int i = 0; i < 2 * result; ++i)
+            out[i] = qsizetype(ovector[i]);
+        out += stride;
+    }
+
+    pcre2_match_data_free_16(matchData);
+    pcre2_match_context_free_16(matchContext);
+
+    return offsets;
+}
+
 /*!
     \since 5.4
 
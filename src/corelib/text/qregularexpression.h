@@ -7,9 +7,11 @@
 #define QREGULAREXPRESSION_H
 
 #include <QtCore/qglobal.h>
+#include <QtCore/qlist.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qstringview.h>
 #include <QtCore/qshareddata.h>
+#include <QtCore/qspan.h>
 #include <QtCore/qvariant.h>
 
 #include <iterator>
@@ -127,6 +129,10 @@ public:
                                                     MatchType matchType       = NormalMatch,
                                                     MatchOptions matchOptions = NoMatchOption) const;
 
+    [[nodiscard]]
+    QList<qsizetype> matchOffsets(QSpan<const QStringView> subjects,
+                                  MatchOptions matchOptions = NoMatchOption) const;
+
     void optimize() const;
 
     enum WildcardConversionOption {
@@ -1190,6 +1190,285 @@ void qt_to_latin1_unchecked(uchar *dst, const char16_t *src, qsizetype length)
     qt_to_latin1_internal<false>(dst, src, length);
 }
 
+/*
+    US-ASCII fast paths for the case-insensitive comparison and the case
+    conversion functions below.
+
+    For US-ASCII characters, case folding, lowercasing and uppercasing only
+    ever flip the 0x20 bit of the letters in one of the ranges A-Z or a-z,
+    so whole vectors of them can be handled at once. Each function returns
+    how many leading characters it handled, and the caller continues with the
+    full Unicode code from there; that includes any tail shorter than a
+    vector.
+*/
+#ifdef __SSE2__
+// Returns 0xffff in the lanes of \a data that are in the range [first, first + 25].
+// The comparisons are signed, but anything at or above U+8000 is out of range
+// either way.
+static Q_ALWAYS_INLINE __m128i mm_ascii_letter_mask(__m128i data, char16_t first)
+{
+    const __m128i low = _mm_set1_epi16(short(first - 1));
+    const __m128i high = _mm_set1_epi16(short(first + 26));
+    return _mm_and_si128(_mm_cmpgt_epi16(data, low), _mm_cmplt_epi16(data, high));
+}
+
+static Q_ALWAYS_INLINE __m128i mm_ascii_fold(__m128i data)
+{
+    return _mm_or_si128(data, _mm_and_si128(mm_ascii_letter_mask(data, u'A'),
+                                            _mm_set1_epi16(0x20)));
+}
+
+// Returns 0xffff in the lanes of \a data that are US-ASCII.
+static Q_ALWAYS_INLINE __m128i mm_ascii_mask(__m128i data)
+{
+    return _mm_cmpeq_epi16(_mm_and_si128(data, _mm_set1_epi16(short(0xff80))),
+                           _mm_setzero_si128());
+}
+
+template <typename Char>
+static qsizetype ucstricmp_ascii_sse2(const char16_t *a, const Char *b, qsizetype l)
+{
+    qsizetype i = 0;
+    for ( ; i + 8 <= l; i += 8) {
+        __m128i adata = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i bdata;
+        if constexpr (sizeof(Char) == 1)
+            bdata = mm_load8_zero_extend(b + i);
+        else
+            bdata = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        adata = mm_ascii_fold(adata);
+        bdata = mm_ascii_fold(bdata);
+
+        const __m128i ascii = mm_ascii_mask(_mm_or_si128(adata, bdata));
+        const __m128i equal = _mm_and_si128(_mm_cmpeq_epi16(adata, bdata), ascii);
+        const uint mask = ~uint(_mm_movemask_epi8(equal)) & 0xffff;
+        if (mask)
+            return i + qCountTrailingZeroBits(mask) / 2;
+    }
+    return i;
+}
+
+static qsizetype ascii_unchanged_sse2(const char16_t *p, qsizetype l, char16_t first)
+{
+    qsizetype i = 0;
+    for ( ; i + 8 <= l; i += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        const __m128i unchanged = _mm_andnot_si128(mm_ascii_letter_mask(data, first),
+                                                   mm_ascii_mask(data));
+        const uint mask = ~uint(_mm_movemask_epi8(unchanged)) & 0xffff;
+        if (mask)
+            return i + qCountTrailingZeroBits(mask) / 2;
+    }
+    return i;
+}
+
+static qsizetype ascii_convert_case_sse2(char16_t *dst, const char16_t *src, qsizetype l,
+                                         char16_t first)
+{
+    qsizetype i = 0;
+    for ( ; i + 8 <= l; i += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(mm_ascii_mask(data)) != 0xffff)
+            break;
+        const __m128i flip = _mm_and_si128(mm_ascii_letter_mask(data, first), _mm_set1_epi16(0x20));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(data, flip));
+    }
+    return i;
+}
+
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(AVX2) __m256i mm256_ascii_letter_mask(__m256i data, char16_t first)
+{
+    const __m256i low = _mm256_set1_epi16(short(first - 1));
+    const __m256i high = _mm256_set1_epi16(short(first + 26));
+    return _mm256_and_si256(_mm256_cmpgt_epi16(data, low), _mm256_cmpgt_epi16(high, data));
+}
+
+static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(AVX2) __m256i mm256_ascii_mask(__m256i data)
+{
+    return _mm256_cmpeq_epi16(_mm256_and_si256(data, _mm256_set1_epi16(short(0xff80))),
+                              _mm256_setzero_si256());
+}
+
+static qsizetype QT_FUNCTION_TARGET(AVX2)
+ucstricmp_ascii_avx2(const char16_t *a, const char16_t *b, qsizetype l)
+{
+    const __m256i caseBit = _mm256_set1_epi16(0x20);
+    qsizetype i = 0;
+    for ( ; i + 16 <= l; i += 16) {
+        __m256i adata = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i bdata = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        adata = _mm256_or_si256(adata, _mm256_and_si256(mm256_ascii_letter_mask(adata, u'A'), caseBit));
+        bdata = _mm256_or_si256(bdata, _mm256_and_si256(mm256_ascii_letter_mask(bdata, u'A'), caseBit));
+
+        const __m256i ascii = mm256_ascii_mask(_mm256_or_si256(adata, bdata));
+        const __m256i equal = _mm256_and_si256(_mm256_cmpeq_epi16(adata, bdata), ascii);
+        const uint mask = ~uint(_mm256_movemask_epi8(equal));
+        if (mask)
+            return i + qCountTrailingZeroBits(mask) / 2;
+    }
+    return i + ucstricmp_ascii_sse2(a + i, b + i, l - i);
+}
+
+static qsizetype QT_FUNCTION_TARGET(AVX2)
+ascii_unchanged_avx2(const char16_t *p, qsizetype l, char16_t first)
+{
+    qsizetype i = 0;
+    for ( ; i + 16 <= l; i += 16) {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        const __m256i unchanged = _mm256_andnot_si256(mm256_ascii_letter_mask(data, first),
+                                                      mm256_ascii_mask(data));
+        const uint mask = ~uint(_mm256_movemask_epi8(unchanged));
+        if (mask)
+            return i + qCountTrailingZeroBits(mask) / 2;
+    }
+    return i + ascii_unchanged_sse2(p + i, l - i, first);
+}
+
+static qsizetype QT_FUNCTION_TARGET(AVX2)
+ascii_convert_case_avx2(char16_t *dst, const char16_t *src, qsizetype l, char16_t first)
+{
+    const __m256i caseBit = _mm256_set1_epi16(0x20);
+    qsizetype i = 0;
+    for ( ; i + 16 <= l; i += 16) {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        if (uint(_mm256_movemask_epi8(mm256_ascii_mask(data))) != 0xffffffffU)
+            break;
+        const __m256i flip = _mm256_and_si256(mm256_ascii_letter_mask(data, first), caseBit);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(data, flip));
+    }
+    return i + ascii_convert_case_sse2(dst + i, src + i, l - i, first);
+}
+#  endif // AVX2
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+static const uint16x8_t neonLaneBits = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+
+static inline uint16x8_t vascii_letter_mask(uint16x8_t data, char16_t first)
+{
+    return vandq_u16(vcgeq_u16(data, vdupq_n_u16(first)),
+                     vcleq_u16(data, vdupq_n_u16(first + 25)));
+}
+
+// Returns the bitmask of the lanes that are not set in \a lanes.
+static inline uint vfirst_clear_lanes(uint16x8_t lanes)
+{
+    return vaddvq_u16(vandq_u16(vmvnq_u16(lanes), neonLaneBits));
+}
+
+template <typename Char>
+static qsizetype ucstricmp_ascii_neon(const char16_t *a, const Char *b, qsizetype l)
+{
+    const uint16x8_t caseBit = vdupq_n_u16(0x20);
+    qsizetype i = 0;
+    for ( ; i + 8 <= l; i += 8) {
+        uint16x8_t adata = vld1q_u16(reinterpret_cast<const uint16_t *>(a + i));
+        uint16x8_t bdata;
+        if constexpr (sizeof(Char) == 1)
+            bdata = vmovl_u8(vld1_u8(reinterpret_cast<const uint8_t *>(b + i)));
+        else
+            bdata = vld1q_u16(reinterpret_cast<const uint16_t *>(b + i));
+        adata = vorrq_u16(adata, vandq_u16(vascii_letter_mask(adata, u'A'), caseBit));
+        bdata = vorrq_u16(bdata, vandq_u16(vascii_letter_mask(bdata, u'A'), caseBit));
+
+        const uint16x8_t ascii = vcltq_u16(vorrq_u16(adata, bdata), vdupq_n_u16(0x80));
+        if (uint mask = vfirst_clear_lanes(vandq_u16(vceqq_u16(adata, bdata), ascii)))
+            return i + qCountTrailingZeroBits(mask);
+    }
+    return i;
+}
+
+static qsizetype ascii_unchanged_neon(const char16_t *p, qsizetype l, char16_t first)
+{
+    qsizetype i = 0;
+    for ( ; i + 8 <= l; i += 8) {
+        const uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(p + i));
+        const uint16x8_t ascii = vcltq_u16(data, vdupq_n_u16(0x80));
+        if (uint mask = vfirst_clear_lanes(vbicq_u16(ascii, vascii_letter_mask(data, first))))
+            return i + qCountTrailingZeroBits(mask);
+    }
+    return i;
+}
+
+static qsizetype ascii_convert_case_neon(char16_t *dst, const char16_t *src, qsizetype l,
+                                         char16_t first)
+{
+    qsizetype i = 0;
+    for ( ; i + 8 <= l; i += 8) {
+        const uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+        if (vmaxvq_u16(data) >= 0x80)
+            break;
+        const uint16x8_t flip = vandq_u16(vascii_letter_mask(data, first), vdupq_n_u16(0x20));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dst + i), veorq_u16(data, flip));
+    }
+    return i;
+}
+#endif
+
+// Returns how many leading characters of \a a and \a b are US-ASCII and
+// compare equal case-insensitively.
+template <typename Char>
+static qsizetype ucstricmp_ascii(const char16_t *a, const Char *b, qsizetype l)
+{
+#if defined(__SSE2__)
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if constexpr (sizeof(Char) == 2) {
+        if (l >= 16 && qCpuHasFeature(AVX2))
+            return ucstricmp_ascii_avx2(a, b, l);
+    }
+#  endif
+    return ucstricmp_ascii_sse2(a, b, l);
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    return ucstricmp_ascii_neon(a, b, l);
+#else
+    Q_UNUSED(a);
+    Q_UNUSED(b);
+    Q_UNUSED(l);
+    return 0;
+#endif
+}
+
+// Returns how many leading characters of \a p are US-ASCII and not in the
+// range [first, first + 25], i.e. would not be changed by the case conversion.
+static qsizetype ascii_unchanged(const char16_t *p, qsizetype l, char16_t first)
+{
+#if defined(__SSE2__)
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (l >= 16 && qCpuHasFeature(AVX2))
+        return ascii_unchanged_avx2(p, l, first);
+#  endif
+    return ascii_unchanged_sse2(p, l, first);
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    return ascii_unchanged_neon(p, l, first);
+#else
+    Q_UNUSED(p);
+    Q_UNUSED(l);
+    Q_UNUSED(first);
+    return 0;
+#endif
+}
+
+// Copies the leading US-ASCII characters of \a src to \a dst, which may be the
+// same, flipping the case of those in the range [first, first + 25]. Returns
+// how many characters were copied.
+static qsizetype ascii_convert_case(char16_t *dst, const char16_t *src, qsizetype l, char16_t first)
+{
+#if defined(__SSE2__)
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (l >= 16 && qCpuHasFeature(AVX2))
+        return ascii_convert_case_avx2(dst, src, l, first);
+#  endif
+    return ascii_convert_case_sse2(dst, src, l, first);
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    return ascii_convert_case_neon(dst, src, l, first);
+#else
+    Q_UNUSED(dst);
+    Q_UNUSED(src);
+    Q_UNUSED(l);
+    Q_UNUSED(first);
+    return 0;
+#endif
+}
+
 // Unicode case-insensitive comparison (argument order matches QStringView)
 Q_NEVER_INLINE static int ucstricmp(qsizetype alen, const char16_t *a, qsizetype blen, const char16_t *b)
 {
@@ -1201,6 +1480,15 @@ Q_NEVER_INLINE static int ucstricmp(qsizetype alen, const char16_t *a, qsizetype
     qsizetype l = qMin(alen, blen);
     qsizetype i;
     for (i = 0; i < l; ++i) {
+        if ((a[i] | b[i]) < 0x80) {
+            if (qsizetype n = ucstricmp_ascii(a + i, b + i, l - i)) {
+                i += n;
+                if (i == l)
+                    break;
+                alast = a[i - 1];
+                blast = b[i - 1];
+            }
+        }
 //         qDebug() << Qt::hex << alast << blast;
 //         qDebug() << Qt::hex << "*a=" << *a << "alast=" << alast << "folded=" << foldCase (*a, alast);
 //         qDebug() << Qt::hex << "*b=" << *b << "blast=" << blast << "folded=" << foldCase (*b, blast);
@@ -1223,6 +1511,11 @@ Q_NEVER_INLINE static int ucstricmp(qsizetype alen, const char16_t *a, qsizetype
     qsizetype l = qMin(alen, blen);
     qsizetype i;
     for (i = 0; i < l; ++i) {
+        if ((a[i] | uchar(b[i])) < 0x80) {
+            i += ucstricmp_ascii(a + i, b + i, l - i);
+            if (i == l)
+                break;
+        }
         int diff = foldCase(a[i]) - foldCase(char16_t{uchar(b[i])});
         if ((diff))
             return diff;
@@ -7141,16 +7434,31 @@ namespace QUnicodeTables {
     There is one pathological case left: when the in-place conversion needs to
     reallocate memory to grow the buffer. In that case, we need to adjust the \a
     it pointer.
+
+    \a end is the index at which \a it ends. Runs of US-ASCII characters are
+    converted a vector at a time.
  */
 template <typename T>
 Q_NEVER_INLINE
-static QString detachAndConvertCase(T &str, QStringIterator it, QUnicodeTables::Case which)
+static QString detachAndConvertCase(T &str, QStringIterator it, qsizetype end,
+                                    QUnicodeTables::Case which)
 {
     Q_ASSERT(!str.isEmpty());
     QString s = std::move(str);         // will copy if T is const QString
     QChar *pp = s.begin() + it.index(); // will detach if necessary
+    const char16_t asciiFirst = which == QUnicodeTables::UpperCase ? u'a' : u'A';
 
     do {
+        if (it.position()->unicode() < 0x80) {
+            const qsizetype n = ascii_convert_case(reinterpret_cast<char16_t *>(pp),
+                                                   reinterpret_cast<const char16_t *>(it.position()),
+                                                   end - it.index(), asciiFirst);
+            pp += n;
+            it.setPosition(it.position() + n);
+            if (!it.hasNext())
+                break;
+        }
+
         const auto folded = fullConvertCase(it.next(), which);
         if (Q_UNLIKELY(folded.size() > 1)) {
             if (folded.chars[0] == *pp && folded.size() == 2) {
@@ -7167,8 +7475,10 @@ static QString detachAndConvertCase(T &str, QStringIterator it, QUnicodeTables::
                 pp = const_cast<QChar *>(s.constBegin()) + outpos + folded.size();
 
                 // Adjust the input iterator if we are performing an in-place conversion
-                if constexpr (!std::is_const<T>::value)
+                if constexpr (!std::is_const<T>::value) {
                     it = QStringIterator(s.constBegin(), inpos + folded.size(), s.constEnd());
+                    end = s.size();
+                }
             }
         } else {
             *pp++ = folded.chars[0];
@@ -7188,12 +7498,19 @@ static QString convertCase(T &str, QUnicodeTables::Case which)
     while (e != p && e[-1].isHighSurrogate())
         --e;
 
+    const char16_t asciiFirst = which == QUnicodeTables::UpperCase ? u'a' : u'A';
     QStringIterator it(p, e);
     while (it.hasNext()) {
+        if (it.position()->unicode() < 0x80) {
+            it.setPosition(it.position() + ascii_unchanged(reinterpret_cast<const char16_t *>(it.position()),
+                                                           e - it.position(), asciiFirst));
+            if (!it.hasNext())
+                break;
+        }
         const char32_t uc = it.next();
         if (qGetProp(uc)->cases[which].diff) {
             it.recede();
-            return detachAndConvertCase(str, it, which);
+            return detachAndConvertCase(str, it, e - p, which);
         }
     }
     return std::move(str);
@@ -7227,6 +7544,69 @@ QString QString::toCaseFolded_helper(QString &str)
     return QUnicodeTables::convertCase(str, QUnicodeTables::CaseFold);
 }
 
+/*!
+    \relates QHash
+    \since 6.9
+
+    Returns the hash value for the case folded equivalent of \a key, using
+    \a seed to seed the calculation. The result is the same as that of
+    \c{qHash(key.toString().toCaseFolded(), seed)}, but this function does not
+    create the case folded string, and does not allocate memory for keys of up
+    to 256 characters. If \a key is already case folded, it is hashed in place.
+
+    Together with a case-insensitive comparison, this allows QHash to use
+    strings as case-insensitive keys.
+
+    \sa QString::toCaseFolded(), QString::compare()
+*/
+size_t qHashCaseFolded(QStringView key, size_t seed)
+{
+    // keep in sync with QUnicodeTables::convertCase() and detachAndConvertCase()
+    const QChar *p = key.begin();
+    const QChar *e = key.end();
+    while (e != p && e[-1].isHighSurrogate())
+        --e;
+
+    QStringIterator it(p, e);
+    while (it.hasNext()) {
+        if (it.position()->unicode() < 0x80) {
+            it.setPosition(it.position() + ascii_unchanged(reinterpret_cast<const char16_t *>(it.position()),
+                                                           e - it.position(), u'A'));
+            if (!it.hasNext())
+                break;
+        }
+        if (qGetProp(it.next())->cases[QUnicodeTables::CaseFold].diff) {
+            it.recede();
+            break;
+        }
+    }
+    if (!it.hasNext())
+        return qHash(key, seed);
+
+    QVarLengthArray<char16_t, 256> folded;
+    folded.reserve(key.size());
+    folded.append(key.utf16(), it.index());
+    do {
+        if (it.position()->unicode() < 0x80) {
+            const qsizetype start = folded.size();
+            const qsizetype remaining = e - it.position();
+            folded.resize(start + remaining);
+            const qsizetype n = ascii_convert_case(folded.data() + start,
+                                                   reinterpret_cast<const char16_t *>(it.position()),
+                                                   remaining, u'A');
+            folded.resize(start + n);
+            it.setPosition(it.position() + n);
+            if (!it.hasNext())
+                break;
+        }
+        for (char16_t c : fullConvertCase(it.next(), QUnicodeTables::CaseFold))
+            folded.append(c);
+    } while (it.hasNext());
+    folded.append(reinterpret_cast<const char16_t *>(e), key.end() - e);
+
+    return qHash(QStringView(folded.constData(), folded.size()), seed);
+}
+
 /*!
     \fn QString QString::toUpper() const
 
@@ -0,0 +1,150 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qstringatom_p.h"
+
+#include "qhash.h"
+#include "qmutex.h"
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QBasicStringAtom
+    \inmodule QtCore
+    \brief The QBasicStringAtom class is an interned string.
+
+    Constructing an atom looks its text up in a process-wide table and
+    shares the string data with every other atom, and every string obtained
+    from string(), that has the same contents. Comparing two atoms is a
+    pointer comparison, and their hash is computed once, when the text is
+    first interned.
+
+    Use QStringAtom for QString and QByteArrayAtom for QByteArray. This is
+    meant for identifiers that are repeated many times over, such as property
+    names and HTTP header names: it saves both the duplicate allocations and
+    hashing them again in every lookup.
+
+    The table is sharded by hash, each shard with its own lock, so that
+    threads interning different strings rarely contend. It doesn't keep
+    strings alive: entries that are no longer referenced from outside the
+    table are dropped the next time their shard grows.
+
+    All empty strings, and default-constructed atoms, are the same null atom.
+*/
+
+namespace {
+template <typename String>
+class InternTable
+{
+public:
+    using View = typename QBasicStringAtom<String>::View;
+
+    String intern(View s, size_t hash)
+    {
+        return shards[shardIndex(hash)].intern(s, hash);
+    }
+
+private:
+    struct Key
+    {
+        View view;  // into the value, whose data never moves
+        size_t hash;
+
+        friend bool operator==(const Key &lhs, const Key &rhs) noexcept
+        { return lhs.hash == rhs.hash && lhs.view == rhs.view; }
+        friend size_t qHash(const Key &key, size_t) noexcept
+        { return key.hash; }
+    };
+
+    // one per cache line, so that the mutexes don't share one
+    struct alignas(64) Shard
+    {
+        String intern(View s, size_t hash)
+        {
+            QMutexLocker locker(&mutex);
+            if (auto it = strings.constFind(Key{ s, hash }); it != strings.cend())
+                return *it;
+
+            if (strings.size() >= sweepThreshold) {
+                sweep();
+                sweepThreshold = qMax(MinimumSweepThreshold, 2 * strings.size());
+            }
+            String copy(s.data(), s.size());
+            strings.emplace(Key{ copy, hash }, copy);
+            return copy;
+        }
+
+        // Drops the strings only the shard still references. Nobody else can
+        // acquire a reference to them without holding the mutex.
+        void sweep()
+        {
+            for (auto it = strings.begin(); it != strings.end(); ) {
+                if (it->data_ptr().isShared())
+                    ++it;
+                else
+                    it = strings.erase(it);
+            }
+        }
+
+        QBasicMutex mutex;
+        QHash<Key, String> strings;
+        qsizetype sweepThreshold = MinimumSweepThreshold;
+    };
+
+    // QHash picks buckets with the low bits of the hash, so use the high ones
+    static size_t shardIndex(size_t hash) noexcept
+    {
+        return hash >> (std::numeric_limits<size_t>::digits - ShardBits);
+    }
+
+    static constexpr int ShardBits = 5;
+    static constexpr qsizetype MinimumSweepThreshold = 16;
+
+    Shard shards[1 << ShardBits];
+};
+
+Q_GLOBAL_STATIC(InternTable<QString>, stringTable)
+Q_GLOBAL_STATIC(InternTable<QByteArray>, byteArrayTable)
+
+template <typename String, typename View, typename Table>
+String internHelper(Table *table, View s, size_t *hash)
+{
+    // empty strings all become the null atom, whose hash is zero like that
+    // of a default-constructed one
+    if (s.isEmpty()) {
+        *hash = 0;
+        return String();
+    }
+    *hash = qHash(s, QHashSeed::globalSeed());
+    if (!table) // during application shutdown
+        return String(s.data(), s.size());
+    return table->intern(s, *hash);
+}
+} // unnamed namespace
+
+/*!
+    \internal
+
+    Returns a string with the contents of \a s, sharing its data with every
+    other interned string of the same contents, and stores its hash in \a hash.
+
+    \sa QStringAtom
+*/
+QString QtPrivate::internString(QStringView s, size_t *hash)
+{
+    return internHelper<QString>(stringTable(), s, hash);
+}
+
+/*!
+    \internal
+    \overload
+*/
+QByteArray QtPrivate::internString(QByteArrayView s, size_t *hash)
+{
+    return internHelper<QByteArray>(byteArrayTable(), s, hash);
+}
+
+QT_END_NAMESPACE
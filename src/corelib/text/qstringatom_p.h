@@ -0,0 +1,79 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSTRINGATOM_P_H
+#define QSTRINGATOM_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhashfunctions.h>
+#include <QtCore/qstring.h>
+
+#include <type_traits>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+Q_CORE_EXPORT QString internString(QStringView s, size_t *hash);
+Q_CORE_EXPORT QByteArray internString(QByteArrayView s, size_t *hash);
+}
+
+template <typename String>
+class QBasicStringAtom
+{
+public:
+    using View = std::conditional_t<std::is_same_v<String, QString>, QStringView, QByteArrayView>;
+
+    QBasicStringAtom() noexcept = default;
+    explicit QBasicStringAtom(View s)
+        : m_string(QtPrivate::internString(s, &m_hash))
+    {}
+
+    void swap(QBasicStringAtom &other) noexcept
+    {
+        m_string.swap(other.m_string);
+        std::swap(m_hash, other.m_hash);
+    }
+
+    bool isNull() const noexcept { return m_string.isNull(); }
+    bool isEmpty() const noexcept { return m_string.isEmpty(); }
+    qsizetype size() const noexcept { return m_string.size(); }
+
+    const String &string() const noexcept { return m_string; }
+    View view() const noexcept { return m_string; }
+    size_t hash() const noexcept { return m_hash; }
+
+private:
+    // All atoms with the same contents share the same string data
+    friend bool operator==(const QBasicStringAtom &lhs, const QBasicStringAtom &rhs) noexcept
+    { return lhs.m_string.constData() == rhs.m_string.constData(); }
+    friend bool operator!=(const QBasicStringAtom &lhs, const QBasicStringAtom &rhs) noexcept
+    { return !(lhs == rhs); }
+    friend size_t qHash(const QBasicStringAtom &atom, size_t seed = 0) noexcept
+    { return qHash(atom.m_hash, seed); }
+
+    size_t m_hash = 0;  // set by internString(), so it must come first
+    String m_string;
+};
+
+using QStringAtom = QBasicStringAtom<QString>;
+using QByteArrayAtom = QBasicStringAtom<QByteArray>;
+
+Q_DECLARE_SHARED(QStringAtom)
+Q_DECLARE_SHARED(QByteArrayAtom)
+
+QT_END_NAMESPACE
+
+#endif // QSTRINGATOM_P_H
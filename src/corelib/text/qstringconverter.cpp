@@ -469,6 +469,354 @@ static void simdCompareAscii(const qchar8_t *&, const qchar8_t *, const char16_t
 }
 #endif
 
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(SSSE3)
+/*
+    SSSE3 code for text that isn't US-ASCII, in the style of simdutf.
+
+    The UTF-8 decoder looks at 16 bytes at a time. Byte i ends a character if
+    byte i + 1 is not a continuation byte, so the continuation bytes tell
+    where the characters in the first 12 bytes end. A table indexed by those
+    12 bits gives a PSHUFB mask that moves each character into its own lane.
+    It uses 16-bit lanes for up to six characters of one or two bytes, and
+    32-bit lanes for up to four characters of one to three bytes. All lanes
+    are then validated and decoded at once. Four-byte sequences and invalid
+    input end the fast path, so the scalar code handles them and all error
+    reporting.
+
+    The encoder does the reverse for four code points at a time. It spreads
+    each code point over the first one to three bytes of a 32-bit lane, and a
+    table indexed by the lengths gives the PSHUFB mask that packs them.
+*/
+struct Utf8DecodeTables
+{
+    struct Step {
+        uchar shuffle;          // index in shuffles, or NoShuffle
+        uchar count;            // characters decoded
+        uchar consumed;         // bytes consumed
+    };
+    static constexpr uchar NoShuffle = 0xff;
+    static constexpr int FirstThreeByteShuffle = 126;   // 2^1 + ... + 2^6
+    static constexpr int ShuffleCount = FirstThreeByteShuffle + 120;    // 3^1 + ... + 3^4
+
+    Step steps[1 << 12] = {};
+    uchar shuffles[ShuffleCount][16] = {};
+};
+
+static constexpr int utf8DecodePow3(int n)
+{
+    int result = 1;
+    while (n--)
+        result *= 3;
+    return result;
+}
+
+static constexpr Utf8DecodeTables makeUtf8DecodeTables()
+{
+    Utf8DecodeTables t;
+
+    // 16-bit lanes: byte 0 is the last byte, byte 1 the first one of
+    // two-byte characters (or zero)
+    for (int n = 1; n <= 6; ++n) {
+        for (int combination = 0; combination < (1 << n); ++combination) {
+            uchar *shuffle = t.shuffles[(1 << n) - 2 + combination];
+            int start = 0;
+            for (int i = 0; i < 8; ++i) {
+                const int length = i < n ? 1 + ((combination >> i) & 1) : 0;
+                shuffle[2 * i] = length ? uchar(start + length - 1) : 0x80;
+                shuffle[2 * i + 1] = length == 2 ? uchar(start) : 0x80;
+                start += length;
+            }
+        }
+    }
+
+    // 32-bit lanes: bytes 0 to 2 are the last to the first byte of the
+    // character (or zero)
+    for (int n = 1; n <= 4; ++n) {
+        for (int combination = 0; combination < utf8DecodePow3(n); ++combination) {
+            uchar *shuffle = t.shuffles[Utf8DecodeTables::FirstThreeByteShuffle
+                                        + (utf8DecodePow3(n) - 3) / 2 + combination];
+            int start = 0;
+            for (int i = 0, c = combination; i < 4; ++i, c /= 3) {
+                const int length = i < n ? 1 + c % 3 : 0;
+                for (int j = 0; j < 4; ++j)
+                    shuffle[4 * i + j] = j < length ? uchar(start + length - 1 - j) : 0x80;
+                start += length;
+            }
+        }
+    }
+
+    for (int mask = 0; mask < (1 << 12); ++mask) {
+        int lengths[12] = {};
+        int count = 0;
+        for (int pos = 0, start = 0; pos < 12; ++pos) {
+            if (mask & (1 << pos)) {
+                lengths[count++] = pos - start + 1;
+                start = pos + 1;
+            }
+        }
+
+        int twoByteCount = 0;
+        while (twoByteCount < count && twoByteCount < 6 && lengths[twoByteCount] <= 2)
+            ++twoByteCount;
+        int threeByteCount = 0;
+        while (threeByteCount < count && threeByteCount < 4 && lengths[threeByteCount] <= 3)
+            ++threeByteCount;
+
+        Utf8DecodeTables::Step &step = t.steps[mask];
+        step.shuffle = Utf8DecodeTables::NoShuffle;
+        if (twoByteCount && twoByteCount >= threeByteCount) {
+            int combination = 0;
+            for (int i = 0; i < twoByteCount; ++i) {
+                combination |= (lengths[i] - 1) << i;
+                step.consumed += lengths[i];
+            }
+            step.shuffle = uchar((1 << twoByteCount) - 2 + combination);
+            step.count = uchar(twoByteCount);
+        } else if (threeByteCount) {
+            int combination = 0;
+            for (int i = 0, weight = 1; i < threeByteCount; ++i, weight *= 3) {
+                combination += (lengths[i] - 1) * weight;
+                step.consumed += lengths[i];
+            }
+            step.shuffle = uchar(Utf8DecodeTables::FirstThreeByteShuffle
+                                 + (utf8DecodePow3(threeByteCount) - 3) / 2 + combination);
+            step.count = uchar(threeByteCount);
+        }
+    }
+    return t;
+}
+
+static constexpr Utf8DecodeTables utf8DecodeTables = makeUtf8DecodeTables();
+
+struct Utf8EncodeTables
+{
+    // indexed by a mask of the lanes needing two bytes or more, ORed with
+    // a mask of those needing three bytes shifted left by four
+    uchar shuffles[256][16] = {};
+    uchar lengths[256] = {};
+};
+
+static constexpr Utf8EncodeTables makeUtf8EncodeTables()
+{
+    Utf8EncodeTables t;
+    for (int index = 0; index < 256; ++index) {
+        int pos = 0;
+        for (int i = 0; i < 4; ++i) {
+            const int length = 1 + ((index >> i) & 1) + ((index >> (i + 4)) & 1);
+            for (int j = 0; j < length; ++j)
+                t.shuffles[index][pos++] = uchar(4 * i + j);
+        }
+        t.lengths[index] = uchar(pos);
+        while (pos < 16)
+            t.shuffles[index][pos++] = 0x80;
+    }
+    return t;
+}
+
+static constexpr Utf8EncodeTables utf8EncodeTables = makeUtf8EncodeTables();
+
+template <bool Output> static bool QT_FUNCTION_TARGET(SSSE3)
+simdDecodeNonAscii_ssse3(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    const uchar *const start = src;
+    const __m128i packLowHalves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    // the destination holds at least as many characters as there are bytes left
+    while (end - src >= 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        if (_mm_movemask_epi8(data) == 0) {
+            if constexpr (Output) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi8(data, _mm_setzero_si128()));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst) + 1, _mm_unpackhi_epi8(data, _mm_setzero_si128()));
+                dst += 16;
+            }
+            src += 16;
+            continue;
+        }
+
+        // continuation bytes are 0x80 to 0xBF, i.e. less than 0xC0 as signed bytes
+        const __m128i continuation = _mm_cmplt_epi8(data, _mm_set1_epi8(char(0xc0)));
+        const uint endMask = (~uint(_mm_movemask_epi8(continuation)) >> 1) & 0xfff;
+        const Utf8DecodeTables::Step step = utf8DecodeTables.steps[endMask];
+        if (step.shuffle == Utf8DecodeTables::NoShuffle)
+            break;
+
+        const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8DecodeTables.shuffles[step.shuffle]));
+        const __m128i v = _mm_shuffle_epi8(data, shuffle);
+        __m128i valid;
+        __m128i utf16;
+        if (step.shuffle < Utf8DecodeTables::FirstThreeByteShuffle) {
+            // 0x00XX (US-ASCII) or 0xYYXX (YY must be 0xC2 to 0xDF), compared
+            // as signed 16-bit values after biasing
+            const __m128i biased = _mm_xor_si128(v, _mm_set1_epi16(short(0x8000)));
+            const __m128i oneByte = _mm_cmplt_epi16(biased, _mm_set1_epi16(short(0x8080)));
+            const __m128i twoBytes = _mm_and_si128(_mm_cmpgt_epi16(biased, _mm_set1_epi16(0x427f)),
+                                                   _mm_cmplt_epi16(biased, _mm_set1_epi16(0x6000)));
+            valid = _mm_or_si128(oneByte, twoBytes);
+            utf16 = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi16(0x7f)),
+                                 _mm_and_si128(_mm_srli_epi16(v, 2), _mm_set1_epi16(0x7c0)));
+        } else {
+            // 0x0000XX, 0x00YYXX (YY must be 0xC2 to 0xDF) or 0xZZYYXX (ZZ
+            // must be 0xE0 to 0xEF, no overlong forms and no surrogates)
+            const __m128i u = _mm_or_si128(_mm_or_si128(_mm_and_si128(v, _mm_set1_epi32(0x7f)),
+                                                        _mm_and_si128(_mm_srli_epi32(v, 2), _mm_set1_epi32(0xfc0))),
+                                           _mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi32(0xf000)));
+            const __m128i oneByte = _mm_cmplt_epi32(v, _mm_set1_epi32(0x80));
+            const __m128i twoBytes = _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(0xc27f)),
+                                                   _mm_cmplt_epi32(v, _mm_set1_epi32(0xe000)));
+            const __m128i surrogate = _mm_cmpeq_epi32(_mm_and_si128(u, _mm_set1_epi32(0xf800)),
+                                                      _mm_set1_epi32(0xd800));
+            const __m128i threeBytes = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(0xdfffff)),
+                                                                   _mm_cmplt_epi32(v, _mm_set1_epi32(0xf00000))),
+                                                     _mm_andnot_si128(surrogate, _mm_cmpgt_epi32(u, _mm_set1_epi32(0x7ff))));
+            valid = _mm_or_si128(_mm_or_si128(oneByte, twoBytes), threeBytes);
+            utf16 = _mm_shuffle_epi8(u, packLowHalves);
+        }
+        if (_mm_movemask_epi8(valid) != 0xffff)
+            break;
+
+        if constexpr (Output) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), utf16);
+            dst += step.count;
+        }
+        src += step.consumed;
+    }
+    return src != start;
+}
+
+// Encodes the four code points (below U+10000, not surrogates) in the 32-bit
+// lanes of u; writes 16 bytes, of which up to 12 are valid
+static Q_ALWAYS_INLINE QT_FUNCTION_TARGET(SSSE3) void simdEncodeUtf8Lanes_ssse3(uchar *&dst, __m128i u)
+{
+    const __m128i twoBytes = _mm_cmpgt_epi32(u, _mm_set1_epi32(0x7f));
+    const __m128i threeBytes = _mm_cmpgt_epi32(u, _mm_set1_epi32(0x7ff));
+    const __m128i last = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi32(0x3f)), _mm_set1_epi32(0x80));
+    const __m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(u, 6), _mm_set1_epi32(0x3f)),
+                                        _mm_set1_epi32(0x80));
+    const __m128i lead2 = _mm_or_si128(_mm_srli_epi32(u, 6), _mm_set1_epi32(0xc0));
+    const __m128i lead3 = _mm_or_si128(_mm_srli_epi32(u, 12), _mm_set1_epi32(0xe0));
+
+    const __m128i first = _mm_or_si128(_mm_andnot_si128(twoBytes, u),
+                                       _mm_or_si128(_mm_and_si128(_mm_andnot_si128(threeBytes, twoBytes), lead2),
+                                                    _mm_and_si128(threeBytes, lead3)));
+    const __m128i second = _mm_or_si128(_mm_andnot_si128(threeBytes, last), _mm_and_si128(threeBytes, middle));
+    const __m128i bytes = _mm_or_si128(first, _mm_or_si128(_mm_slli_epi32(second, 8), _mm_slli_epi32(last, 16)));
+
+    const uint index = uint(_mm_movemask_ps(_mm_castsi128_ps(twoBytes)))
+            | uint(_mm_movemask_ps(_mm_castsi128_ps(threeBytes))) << 4;
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8EncodeTables.shuffles[index]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(bytes, shuffle));
+    dst += utf8EncodeTables.lengths[index];
+}
+
+static bool QT_FUNCTION_TARGET(SSSE3)
+simdEncodeNonAscii_ssse3(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    const char16_t *const start = src;
+
+    // the destination holds at least three bytes per character left; we need
+    // 28 bytes for eight characters
+    while (end - src >= 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(data, _mm_set1_epi16(short(0xf800))),
+                                                   _mm_set1_epi16(short(0xd800)));
+        if (_mm_movemask_epi8(surrogates))
+            break;
+
+        const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(data, _mm_set1_epi16(short(0xff80))),
+                                              _mm_setzero_si128());
+        if (_mm_movemask_epi8(ascii) == 0xffff) {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(data, data));
+            dst += 8;
+        } else {
+            simdEncodeUtf8Lanes_ssse3(dst, _mm_unpacklo_epi16(data, _mm_setzero_si128()));
+            simdEncodeUtf8Lanes_ssse3(dst, _mm_unpackhi_epi16(data, _mm_setzero_si128()));
+        }
+        src += 8;
+    }
+    return src != start;
+}
+
+static void QT_FUNCTION_TARGET(SSSE3)
+simdEncodeLatin1_ssse3(uchar *&dst, const uchar *&src, const uchar *end)
+{
+    // the destination holds at least two bytes per character left; we need
+    // 24 bytes for eight characters
+    while (end - src >= 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        if (_mm_movemask_epi8(data) == 0) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), data);
+            dst += 16;
+            src += 16;
+            continue;
+        }
+
+        const __m128i chars = _mm_unpacklo_epi8(data, _mm_setzero_si128());
+        simdEncodeUtf8Lanes_ssse3(dst, _mm_unpacklo_epi16(chars, _mm_setzero_si128()));
+        simdEncodeUtf8Lanes_ssse3(dst, _mm_unpackhi_epi16(chars, _mm_setzero_si128()));
+        src += 8;
+    }
+}
+#endif // SSSE3
+
+// Decodes valid UTF-8 up to the first invalid or four-byte sequence, or up to
+// the last 16 bytes. Returns whether it decoded anything.
+static inline bool simdDecodeNonAscii(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(SSSE3)
+    if (qCpuHasFeature(SSSE3))
+        return simdDecodeNonAscii_ssse3<true>(dst, src, end);
+#else
+    Q_UNUSED(dst);
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+#endif
+    return false;
+}
+
+// Same as simdDecodeNonAscii(), without the output
+static inline bool simdValidateNonAscii(const uchar *&src, const uchar *end)
+{
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(SSSE3)
+    if (qCpuHasFeature(SSSE3)) {
+        char16_t *dummy = nullptr;
+        return simdDecodeNonAscii_ssse3<false>(dummy, src, end);
+    }
+#else
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+#endif
+    return false;
+}
+
+// Encodes UTF-16 up to the first surrogate, or up to the last 16 characters.
+// Returns whether it encoded anything.
+static inline bool simdEncodeNonAscii(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(SSSE3)
+    if (qCpuHasFeature(SSSE3))
+        return simdEncodeNonAscii_ssse3(dst, src, end);
+#else
+    Q_UNUSED(dst);
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+#endif
+    return false;
+}
+
+// Encodes Latin-1 up to the last 16 characters
+static inline void simdEncodeLatin1(uchar *&dst, const uchar *&src, const uchar *end)
+{
+#if defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(SSSE3)
+    if (qCpuHasFeature(SSSE3))
+        simdEncodeLatin1_ssse3(dst, src, end);
+#else
+    Q_UNUSED(dst);
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+#endif
+}
+
 enum { HeaderDone = 1 };
 
 QByteArray QUtf8::convertFromUnicode(QStringView in)
@@ -485,6 +833,8 @@ QByteArray QUtf8::convertFromUnicode(QStringView in)
         const char16_t *nextAscii = end;
         if (simdEncodeAscii(dst, nextAscii, src, end))
             break;
+        if (simdEncodeNonAscii(dst, src, end))
+            continue;
 
         do {
             char16_t u = *src++;
@@ -551,6 +901,8 @@ char *QUtf8::convertFromUnicode(char *out, QStringView in, QStringConverter::Sta
         const char16_t *nextAscii = end;
         if (simdEncodeAscii(cursor, nextAscii, src, end))
             break;
+        if (simdEncodeNonAscii(cursor, src, end))
+            continue;
 
         do {
             char16_t uc = *src++;
@@ -580,17 +932,22 @@ char *QUtf8::convertFromUnicode(char *out, QStringView in, QStringConverter::Sta
 
 char *QUtf8::convertFromLatin1(char *out, QLatin1StringView in)
 {
-    // ### SIMD-optimize:
-    for (uchar ch : in) {
+    uchar *dst = reinterpret_cast<uchar *>(out);
+    const uchar *src = reinterpret_cast<const uchar *>(in.data());
+    const uchar *const end = src + in.size();
+    simdEncodeLatin1(dst, src, end);
+
+    for ( ; src != end; ++src) {
+        const uchar ch = *src;
         if (ch < 128) {
-            *out++ = ch;
+            *dst++ = ch;
         } else {
             // as per https://en.wikipedia.org/wiki/UTF-8#Encoding, 2nd row
-            *out++ = 0b110'0'0000u | (ch >> 6);
-            *out++ = 0b10'00'0000u | (ch & 0b0011'1111);
+            *dst++ = 0b110'0'0000u | (ch >> 6);
+            *dst++ = 0b10'00'0000u | (ch & 0b0011'1111);
         }
     }
-    return out;
+    return reinterpret_cast<char *>(dst);
 }
 
 QString QUtf8::convertToUnicode(QByteArrayView in)
@@ -654,6 +1011,8 @@ char16_t *QUtf8::convertToUnicode(char16_t *dst, QByteArrayView in) noexcept
             nextAscii = end;
             if (simdDecodeAscii(dst, nextAscii, src, end))
                 break;
+            if (simdDecodeNonAscii(dst, src, end))
+                continue;
 
             do {
                 uchar b = *src++;
@@ -755,8 +1114,14 @@ char16_t *QUtf8::convertToUnicode(char16_t *dst, QByteArrayView in, QStringConve
     res = 0;
     const uchar *nextAscii = src;
     while (res >= 0 && src < end) {
-        if (src >= nextAscii && simdDecodeAscii(dst, nextAscii, src, end))
-            break;
+        if (src >= nextAscii) {
+            if (simdDecodeAscii(dst, nextAscii, src, end))
+                break;
+            if (simdDecodeNonAscii(dst, src, end)) {
+                nextAscii = src;
+                continue;
+            }
+        }
 
         ch = *src++;
         res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(ch, dst, src, end);
@@ -808,6 +1173,11 @@ QUtf8::ValidUtf8Result QUtf8::isValidUtf8(QByteArrayView in)
             src = simdFindNonAscii(src, end, nextAscii);
         if (src == end)
             break;
+        if (*src >= 0x80 && simdValidateNonAscii(src, end)) {
+            isValidAscii = false;
+            nextAscii = src;
+            continue;
+        }
 
         do {
             uchar b = *src++;
@@ -0,0 +1,287 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qstringformat_p.h"
+
+#include "qiodevice.h"
+#include "qvarlengtharray.h"
+#include "private/qlocale_p.h"
+#include "private/qnumeric_p.h"
+#include "private/qstringconverter_p.h"
+
+#include <charconv>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QFormatString
+    \inmodule QtCore
+    \brief The QFormatString class is a format string parsed at compile time.
+
+    A QFormatString is made from a UTF-8 (\c char) or UTF-16 (\c char16_t)
+    string literal with the same placeholders as QString::arg(): \c{%1} to
+    \c{%99}, optionally written \c{%L1} and so on. Like with QString::arg(),
+    the lowest placeholder number is replaced with the first argument, the
+    next one with the second, and so on, and placeholders without an argument
+    are left as they are.
+
+    Declare it as a \c{static constexpr} variable so that the format string is
+    parsed by the compiler, and then pass it to qFormat(), qFormatUtf8() or
+    qFormatTo():
+
+    \code
+    static constexpr QFormatString format(u"%1: %2 bytes");
+    static_assert(format.argumentCount() == 2);
+    const QString text = qFormat(format, fileName, size);
+    \endcode
+
+    Where a QString::arg() chain parses the string again, and allocates a
+    new one, for every argument, these compute the size of the result from
+    the pre-parsed parts and the converted arguments, and write it in one go.
+    Numbers are converted into a buffer on the stack.
+
+    The arguments can be strings (QString, QStringView, QLatin1StringView,
+    QUtf8StringView, QByteArray and \c{const char *}, which are UTF-8),
+    characters, integers in base 10, and floating-point numbers, which are
+    formatted like QString::number(). Use qFormatNumber() to set the field
+    width, the base or the fill character of an integer. There is no
+    localization: \c{%L1} is treated like \c{%1}.
+*/
+
+/*!
+    \internal
+    \fn template <typename Char, size_t N, typename...Args> QString qFormat(const QFormatString<Char, N> &format, const Args &...args)
+    \relates QFormatString
+
+    Returns \a format with its placeholders replaced by \a args.
+*/
+
+/*!
+    \internal
+    \fn template <typename Char, size_t N, typename...Args> QByteArray qFormatUtf8(const QFormatString<Char, N> &format, const Args &...args)
+    \relates QFormatString
+
+    Returns \a format with its placeholders replaced by \a args, in UTF-8.
+*/
+
+/*!
+    \internal
+    \fn template <typename Char, size_t N, typename...Args> void qFormatTo(QString &out, const QFormatString<Char, N> &format, const Args &...args)
+    \fn template <typename Char, size_t N, typename...Args> void qFormatTo(QByteArray &out, const QFormatString<Char, N> &format, const Args &...args)
+    \relates QFormatString
+
+    Appends \a format with its placeholders replaced by \a args to \a out.
+    A QByteArray gets UTF-8.
+*/
+
+/*!
+    \internal
+    \fn template <typename Char, size_t N, typename...Args> qint64 qFormatTo(QIODevice *device, const QFormatString<Char, N> &format, const Args &...args)
+    \relates QFormatString
+
+    Writes \a format with its placeholders replaced by \a args to \a device
+    in UTF-8, with a single call to QIODevice::write(), and returns what that
+    returned.
+*/
+
+/*!
+    \internal
+    \fn template <typename T> QtPrivate::FormatInteger qFormatNumber(T value, int fieldWidth, int base, char fill)
+    \relates QFormatString
+
+    Returns an argument for qFormat() that formats the integer \a value in
+    \a base, padded with \a fill to \a fieldWidth characters, like
+    QString::arg() does. \a fieldWidth is limited to 64.
+*/
+
+namespace {
+using namespace QtPrivate;
+
+// An upper bound of the size of the result, in code units of the output
+template <typename Out>
+qsizetype maximumSize(const FormatPattern &pattern, const FormatArgument *args, qsizetype n)
+{
+    qsizetype size = 0;
+    for (qsizetype i = 0; i < pattern.partCount; ++i) {
+        const FormatPart &part = pattern.parts[i];
+        const QAnyStringView s = part.argument >= 0 && part.argument < n
+                ? args[part.argument].view()
+                : pattern.text.mid(part.offset, part.size);
+        if constexpr (std::is_same_v<Out, char16_t>) {
+            // a UTF-8 code unit never decodes to more than one UTF-16 one
+            size += s.size();
+        } else {
+            size += s.visit([](auto s) -> qsizetype {
+                using View = decltype(s);
+                if constexpr (std::is_same_v<View, QStringView>)
+                    return s.size() * 3;
+                else if constexpr (std::is_same_v<View, QLatin1StringView>)
+                    return s.size() * 2;
+                else
+                    return s.size();
+            });
+        }
+    }
+    return size;
+}
+
+char16_t *write(char16_t *out, QAnyStringView s) noexcept
+{
+    return s.visit([out](auto s) {
+        using View = decltype(s);
+        if constexpr (std::is_same_v<View, QStringView>)
+            return std::copy_n(s.utf16(), s.size(), out);
+        else if constexpr (std::is_same_v<View, QLatin1StringView>)
+            return QLatin1::convertToUnicode(out, s);
+        else
+            return QUtf8::convertToUnicode(out, QByteArrayView(s.data(), s.size()));
+    });
+}
+
+char *write(char *out, QAnyStringView s) noexcept
+{
+    return s.visit([out](auto s) {
+        using View = decltype(s);
+        if constexpr (std::is_same_v<View, QStringView>) {
+            QStringConverter::State state(QStringConverter::Flag::Stateless);
+            return QUtf8::convertFromUnicode(out, s, &state);
+        } else if constexpr (std::is_same_v<View, QLatin1StringView>) {
+            return QUtf8::convertFromLatin1(out, s);
+        } else {
+            return std::copy_n(s.data(), s.size(), out);
+        }
+    });
+}
+
+template <typename Out>
+Out *write(Out *out, const FormatPattern &pattern, const FormatArgument *args, qsizetype n)
+{
+    for (qsizetype i = 0; i < pattern.partCount; ++i) {
+        const FormatPart &part = pattern.parts[i];
+        if (part.argument >= 0 && part.argument < n)
+            out = write(out, args[part.argument].view());
+        else
+            out = write(out, pattern.text.mid(part.offset, part.size));
+    }
+    return out;
+}
+
+void checkArgumentCount(const FormatPattern &pattern, qsizetype n)
+{
+    if (Q_UNLIKELY(n > pattern.argumentCount)) {
+        qWarning("qFormat: %d argument(s) missing in %ls", int(n - pattern.argumentCount),
+                 qUtf16Printable(pattern.text.toString()));
+    }
+}
+
+template <typename String>
+void appendFormatted(String &out, const FormatPattern &pattern,
+                     const FormatArgument *args, qsizetype n)
+{
+    using Out = std::conditional_t<std::is_same_v<String, QString>, char16_t, char>;
+    checkArgumentCount(pattern, n);
+    const qsizetype oldSize = out.size();
+    out.resizeForOverwrite(oldSize + maximumSize<Out>(pattern, args, n));
+    Out *begin = reinterpret_cast<Out *>(out.data());
+    Out *end = write(begin + oldSize, pattern, args, n);
+    // converting to or from UTF-8 may have caused an overestimate
+    out.truncate(end - begin);
+}
+} // unnamed namespace
+
+void QtPrivate::formatTo(QString &out, const FormatPattern &pattern,
+                         const FormatArgument *args, qsizetype n)
+{
+    appendFormatted(out, pattern, args, n);
+}
+
+void QtPrivate::formatTo(QByteArray &out, const FormatPattern &pattern,
+                         const FormatArgument *args, qsizetype n)
+{
+    appendFormatted(out, pattern, args, n);
+}
+
+qint64 QtPrivate::formatTo(QIODevice *device, const FormatPattern &pattern,
+                           const FormatArgument *args, qsizetype n)
+{
+    checkArgumentCount(pattern, n);
+    QVarLengthArray<char, 512> buffer(maximumSize<char>(pattern, args, n));
+    char *end = write(buffer.data(), pattern, args, n);
+    return device->write(buffer.data(), end - buffer.data());
+}
+
+void QtPrivate::FormatArgument::setInteger(FormatInteger value) noexcept
+{
+    Q_ASSERT(value.base >= 2 && value.base <= 36);
+    const int fieldWidth = qBound(-MaxFieldWidth, value.fieldWidth, MaxFieldWidth);
+    const qsizetype width = qAbs(fieldWidth);
+
+    // Write the digits backwards, from the end of the buffer
+    char *const bufferEnd = m_buffer + sizeof(m_buffer);
+    char *p = bufferEnd;
+    qulonglong magnitude = value.magnitude;
+    do {
+        const int digit = int(magnitude % value.base);
+        *--p = char(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        magnitude /= value.base;
+    } while (magnitude);
+
+    // Like QString::arg(), zero padding goes between the sign and the digits
+    const bool zeroPadded = value.fill == '0' && fieldWidth > 0;
+    if (zeroPadded) {
+        const char *const padEnd = bufferEnd - width + (value.negative ? 1 : 0);
+        while (p > padEnd)
+            *--p = '0';
+    }
+    if (value.negative)
+        *--p = '-';
+    if (!zeroPadded && fieldWidth > 0) {
+        while (p > bufferEnd - width)
+            *--p = value.fill;
+    }
+
+    qsizetype size = bufferEnd - p;
+    if (fieldWidth < 0 && size < width) {
+        // left-aligned: move to the start of the buffer and pad after
+        memmove(m_buffer, p, size);
+        p = m_buffer;
+        while (size < width)
+            p[size++] = value.fill;
+    }
+    m_view = QLatin1StringView(p, size);
+}
+
+QtPrivate::FormatArgument::FormatArgument(double value) noexcept
+{
+    qsizetype size;
+    if (qt_is_nan(value)) {
+        size = 3;
+        memcpy(m_buffer, "nan", size);
+    } else if (qt_is_inf(value)) {
+        size = value < 0 ? 4 : 3;
+        memcpy(m_buffer, value < 0 ? "-inf" : "inf", size);
+    } else if (value == 0) {
+        // QString::number() drops the sign of negative zero
+        size = 1;
+        m_buffer[0] = '0';
+    } else {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        // the same as QString::number(value), which is 'g' with a precision of 6
+        const auto r = std::to_chars(m_buffer, m_buffer + sizeof(m_buffer), value,
+                                     std::chars_format::general, 6);
+        Q_ASSERT(r.ec == std::errc{});
+        size = r.ptr - m_buffer;
+#else
+        const QString s = QLocaleData::c()->doubleToString(value, 6, QLocaleData::DFSignificantDigits,
+                                                           -1, QLocaleData::ZeroPadExponent);
+        size = s.size();
+        Q_ASSERT(size_t(size) <= sizeof(m_buffer));
+        for (qsizetype i = 0; i < size; ++i)
+            m_buffer[i] = char(s.at(i).unicode());
+#endif
+    }
+    m_view = QLatin1StringView(m_buffer, size);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,267 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSTRINGFORMAT_P_H
+#define QSTRINGFORMAT_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qanystringview.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qstring.h>
+
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+namespace QtPrivate {
+
+struct FormatPart
+{
+    int offset;
+    int size;
+    int argument;   // -1 for literal text
+};
+
+struct FormatPattern
+{
+    QAnyStringView text;
+    const FormatPart *parts;
+    qsizetype partCount;
+    int argumentCount;
+};
+
+struct FormatInteger
+{
+    qulonglong magnitude;
+    bool negative;
+    int fieldWidth;
+    int base;
+    char fill;
+};
+
+template <typename T>
+constexpr FormatInteger makeFormatInteger(T value, int fieldWidth, int base, char fill) noexcept
+{
+    FormatInteger n = { qulonglong(value), false, fieldWidth, base, fill };
+    if constexpr (std::is_signed_v<T>) {
+        n.negative = value < 0;
+        if (n.negative)
+            n.magnitude = 0 - n.magnitude;
+    }
+    return n;
+}
+
+class FormatArgument
+{
+    template <typename T>
+    using if_integer = std::enable_if_t<std::is_integral_v<T>
+                                        && !std::is_same_v<T, bool>
+                                        && !std::is_same_v<T, char>
+                                        && !std::is_same_v<T, char16_t>
+                                        && !std::is_same_v<T, char32_t>
+#ifdef __cpp_char8_t
+                                        && !std::is_same_v<T, char8_t>
+#endif
+                                        , bool>;
+public:
+    FormatArgument(const QString &s) noexcept : m_view(s) {}
+    FormatArgument(QStringView s) noexcept : m_view(s) {}
+    FormatArgument(QLatin1StringView s) noexcept : m_view(s) {}
+    FormatArgument(QUtf8StringView s) noexcept : m_view(s) {}
+    FormatArgument(const QByteArray &s) noexcept : m_view(QUtf8StringView(s)) {}
+    FormatArgument(QByteArrayView s) noexcept : m_view(QUtf8StringView(s)) {}
+    FormatArgument(const char *s) noexcept : m_view(QUtf8StringView(s)) {}
+    FormatArgument(const QChar &c) noexcept : m_view(QStringView(&c, 1)) {}
+    FormatArgument(const char16_t &c) noexcept : m_view(QStringView(&c, 1)) {}
+    FormatArgument(const char &c) noexcept : m_view(QLatin1StringView(&c, 1)) {}
+
+    template <typename T, if_integer<T> = true>
+    FormatArgument(T value) noexcept
+    { setInteger(makeFormatInteger(value, 0, 10, ' ')); }
+    FormatArgument(FormatInteger value) noexcept { setInteger(value); }
+    Q_CORE_EXPORT FormatArgument(double value) noexcept;
+    FormatArgument(float value) noexcept : FormatArgument(double(value)) {}
+
+    // the view may point into this object
+    FormatArgument(const FormatArgument &) = delete;
+    FormatArgument &operator=(const FormatArgument &) = delete;
+
+    QAnyStringView view() const noexcept { return m_view; }
+
+    static constexpr int MaxFieldWidth = 64;
+
+private:
+    Q_CORE_EXPORT void setInteger(FormatInteger value) noexcept;
+
+    QAnyStringView m_view;
+    char m_buffer[MaxFieldWidth + 8];
+};
+
+Q_CORE_EXPORT void formatTo(QString &out, const FormatPattern &pattern,
+                            const FormatArgument *args, qsizetype n);
+Q_CORE_EXPORT void formatTo(QByteArray &out, const FormatPattern &pattern,
+                            const FormatArgument *args, qsizetype n);
+Q_CORE_EXPORT qint64 formatTo(QIODevice *device, const FormatPattern &pattern,
+                              const FormatArgument *args, qsizetype n);
+
+template <typename Out, size_t N>
+decltype(auto) formatArray(Out &&out, const FormatPattern &pattern,
+                           const FormatArgument (&args)[N])
+{
+    return formatTo(out, pattern, args, qsizetype(N));
+}
+
+template <typename Out, typename...Args>
+decltype(auto) formatDispatch(Out &&out, const FormatPattern &pattern, const Args &...args)
+{
+    if constexpr (sizeof...(Args) == 0) {
+        return formatTo(out, pattern, nullptr, 0);
+    } else {
+        // A temporary array, so that the arguments, and any temporaries
+        // they refer to, live until formatTo() returns.
+        using Arguments = FormatArgument[sizeof...(Args)];
+        return formatArray(out, pattern, Arguments{ FormatArgument(args)... });
+    }
+}
+
+} // namespace QtPrivate
+
+template <typename Char, size_t N>
+class QFormatString
+{
+    static_assert(std::is_same_v<Char, char> || std::is_same_v<Char, char16_t>,
+                  "Format strings must be UTF-8 or UTF-16 string literals");
+public:
+    constexpr QFormatString(const Char (&text)[N]) noexcept
+        : m_text(text)
+    {
+        constexpr int size = int(N - 1);
+        int last = 0;
+        int i = 0;
+        while (i < size - 1) {
+            const int percent = i;
+            const int number = parsePlaceholder(text, &i, size);
+            if (number < 0) {
+                ++i;
+                continue;
+            }
+            if (last != percent)
+                m_parts[m_partCount++] = { last, percent - last, -1 };
+            m_parts[m_partCount++] = { percent, i - percent, number };
+            last = i;
+        }
+        if (last < size)
+            m_parts[m_partCount++] = { last, size - last, -1 };
+
+        // Like QString::arg(), the lowest placeholder number gets the first
+        // argument, the next one the second, and so on.
+        bool seen[100] = {};
+        for (int p = 0; p < m_partCount; ++p) {
+            if (m_parts[p].argument >= 0)
+                seen[m_parts[p].argument] = true;
+        }
+        int ranks[100] = {};
+        for (int number = 0; number < 100; ++number) {
+            ranks[number] = m_argumentCount;
+            if (seen[number])
+                ++m_argumentCount;
+        }
+        for (int p = 0; p < m_partCount; ++p) {
+            if (m_parts[p].argument >= 0)
+                m_parts[p].argument = ranks[m_parts[p].argument];
+        }
+    }
+
+    constexpr int argumentCount() const noexcept { return m_argumentCount; }
+    constexpr qsizetype size() const noexcept { return qsizetype(N - 1); }
+
+    QtPrivate::FormatPattern pattern() const noexcept
+    {
+        if constexpr (std::is_same_v<Char, char>)
+            return { QUtf8StringView(m_text, size()), m_parts, m_partCount, m_argumentCount };
+        else
+            return { QStringView(m_text, size()), m_parts, m_partCount, m_argumentCount };
+    }
+
+private:
+    // %n or %Ln with one or two digits, as in QString::arg()
+    static constexpr int parsePlaceholder(const Char *text, int *pos, int size) noexcept
+    {
+        int i = *pos;
+        if (text[i] != Char('%'))
+            return -1;
+        ++i;
+        if (i < size && text[i] == Char('L'))
+            ++i;
+        if (i >= size || text[i] < Char('0') || text[i] > Char('9'))
+            return -1;
+        int number = text[i++] - Char('0');
+        if (i < size && text[i] >= Char('0') && text[i] <= Char('9'))
+            number = number * 10 + (text[i++] - Char('0'));
+        *pos = i;
+        return number;
+    }
+
+    const Char *m_text;
+    QtPrivate::FormatPart m_parts[N] = {};
+    int m_partCount = 0;
+    int m_argumentCount = 0;
+};
+
+template <typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr QtPrivate::FormatInteger qFormatNumber(T value, int fieldWidth = 0, int base = 10,
+                                                 char fill = ' ') noexcept
+{
+    return QtPrivate::makeFormatInteger(value, fieldWidth, base, fill);
+}
+
+template <typename Char, size_t N, typename...Args>
+[[nodiscard]] QString qFormat(const QFormatString<Char, N> &format, const Args &...args)
+{
+    QString result;
+    QtPrivate::formatDispatch(result, format.pattern(), args...);
+    return result;
+}
+
+template <typename Char, size_t N, typename...Args>
+[[nodiscard]] QByteArray qFormatUtf8(const QFormatString<Char, N> &format, const Args &...args)
+{
+    QByteArray result;
+    QtPrivate::formatDispatch(result, format.pattern(), args...);
+    return result;
+}
+
+template <typename Char, size_t N, typename...Args>
+void qFormatTo(QString &out, const QFormatString<Char, N> &format, const Args &...args)
+{
+    QtPrivate::formatDispatch(out, format.pattern(), args...);
+}
+
+template <typename Char, size_t N, typename...Args>
+void qFormatTo(QByteArray &out, const QFormatString<Char, N> &format, const Args &...args)
+{
+    QtPrivate::formatDispatch(out, format.pattern(), args...);
+}
+
+template <typename Char, size_t N, typename...Args>
+qint64 qFormatTo(QIODevice *device, const QFormatString<Char, N> &format, const Args &...args)
+{
+    return QtPrivate::formatDispatch(device, format.pattern(), args...);
+}
+
+QT_END_NAMESPACE
+
+#endif // QSTRINGFORMAT_P_H
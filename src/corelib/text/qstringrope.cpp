@@ -0,0 +1,472 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qstringrope_p.h"
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QStringRope
+    \inmodule QtCore
+    \brief The QStringRope class is a string optimized for edits in the middle
+    of large texts.
+
+    QStringRope stores its text as a sequence of chunks of at most
+    MaxChunkSize characters, kept in an implicit treap (a randomized balanced
+    binary tree ordered by position, where each node knows the length of its
+    subtree). Inserting, removing and accessing a character at any position
+    therefore costs O(log n), plus the cost of copying at most one chunk,
+    instead of the O(n) memmove a QString needs.
+
+    The text can be iterated chunk by chunk as QStringView, using chunks(),
+    without ever materializing it. toString() and mid() only build a QString
+    when asked for.
+
+    Small insertions are merged into an existing chunk when it has room, and
+    adjacent chunks are coalesced after edits, so that repeated appends of
+    short lines do not degenerate into one node per line.
+
+    Copies are cheap: the tree is shared until one of the copies is
+    modified, and even then the chunks themselves stay implicitly shared.
+
+    This is internal plumbing for Qt's own modules, not public API: it is
+    only declared in a private header, and its interface may change without
+    notice.
+*/
+
+struct QStringRopeNode
+{
+    QString text;               // never empty
+    qsizetype length = 0;       // of the whole subtree
+    QStringRopeNode *left = nullptr;
+    QStringRopeNode *right = nullptr;
+    QStringRopeNode *parent = nullptr;
+    quint32 priority = 0;
+};
+
+namespace {
+using Node = QStringRopeNode;
+
+constexpr qsizetype MaxChunkSize = 4096;
+
+inline qsizetype lengthOf(const Node *n) noexcept
+{
+    return n ? n->length : 0;
+}
+
+inline void update(Node *n) noexcept
+{
+    n->length = lengthOf(n->left) + n->text.size() + lengthOf(n->right);
+    if (n->left)
+        n->left->parent = n;
+    if (n->right)
+        n->right->parent = n;
+}
+
+void destroy(Node *n) noexcept
+{
+    while (n) {
+        destroy(n->left);
+        Node *right = n->right;
+        delete n;
+        n = right;
+    }
+}
+
+Node *clone(const Node *n)
+{
+    if (!n)
+        return nullptr;
+    Node *copy = new Node{ n->text, n->length, clone(n->left), clone(n->right), nullptr,
+                           n->priority };
+    update(copy);
+    return copy;
+}
+
+qsizetype countNodes(const Node *n) noexcept
+{
+    qsizetype count = 0;
+    while (n) {
+        count += 1 + countNodes(n->left);
+        n = n->right;
+    }
+    return count;
+}
+
+// Joins two trees; every character of \a a comes before every character of \a b.
+Node *merge(Node *a, Node *b) noexcept
+{
+    if (!a)
+        return b;
+    if (!b)
+        return a;
+    if (a->priority > b->priority) {
+        a->right = merge(a->right, b);
+        update(a);
+        return a;
+    }
+    b->left = merge(a, b->left);
+    update(b);
+    return b;
+}
+
+// Returns the node holding character \a i and the position of its first
+// character in \a start.
+const Node *findNode(const Node *n, qsizetype i, qsizetype *start) noexcept
+{
+    qsizetype offset = 0;
+    while (n) {
+        const qsizetype leftLength = lengthOf(n->left);
+        if (i < leftLength) {
+            n = n->left;
+            continue;
+        }
+        i -= leftLength;
+        offset += leftLength;
+        if (i < n->text.size())
+            break;
+        i -= n->text.size();
+        offset += n->text.size();
+        n = n->right;
+    }
+    *start = offset;
+    return n;
+}
+
+const Node *leftmost(const Node *n) noexcept
+{
+    if (n) {
+        while (n->left)
+            n = n->left;
+    }
+    return n;
+}
+
+const Node *successor(const Node *n) noexcept
+{
+    if (n->right)
+        return leftmost(n->right);
+    while (n->parent && n->parent->right == n)
+        n = n->parent;
+    return n->parent;
+}
+} // unnamed namespace
+
+class QStringRopeData : public QSharedData
+{
+public:
+    QStringRopeData() = default;
+    QStringRopeData(const QStringRopeData &other)
+        : QSharedData(other), root(clone(other.root)), seed(other.seed)
+    {}
+    QStringRopeData &operator=(const QStringRopeData &) = delete;
+    ~QStringRopeData() { destroy(root); }
+
+    Node *newNode(QString &&text)
+    {
+        Q_ASSERT(!text.isEmpty());
+        // The balance of a treap only depends on the priorities being
+        // uncorrelated with the positions, so a cheap hash of a counter will do.
+        quint32 x = (seed += 0x9e3779b9U);
+        x = (x ^ (x >> 16)) * 0x7feb352dU;
+        x = (x ^ (x >> 15)) * 0x846ca68bU;
+        x ^= x >> 16;
+        const qsizetype length = text.size();
+        return new Node{ std::move(text), length, nullptr, nullptr, nullptr, x };
+    }
+
+    // Builds a tree holding \a text, cut into chunks of at most MaxChunkSize.
+    Node *build(QStringView text)
+    {
+        Node *result = nullptr;
+        while (!text.isEmpty()) {
+            const qsizetype n = qMin(text.size(), MaxChunkSize);
+            result = merge(result, newNode(text.first(n).toString()));
+            text = text.sliced(n);
+        }
+        return result;
+    }
+
+    // Splits \a n into the trees holding its first \a pos characters and the rest.
+    std::pair<Node *, Node *> split(Node *n, qsizetype pos)
+    {
+        auto result = splitHelper(n, pos);
+        if (result.first)
+            result.first->parent = nullptr;
+        if (result.second)
+            result.second->parent = nullptr;
+        return result;
+    }
+
+    std::pair<Node *, Node *> splitRoot(qsizetype pos)
+    {
+        return split(std::exchange(root, nullptr), pos);
+    }
+
+    void setRoot(Node *n) noexcept
+    {
+        root = n;
+        if (root)
+            root->parent = nullptr;
+    }
+
+    Node *root = nullptr;
+    quint32 seed = 0;
+
+private:
+    std::pair<Node *, Node *> splitHelper(Node *n, qsizetype pos)
+    {
+        if (!n)
+            return {};
+        const qsizetype leftLength = lengthOf(n->left);
+        if (pos <= leftLength) {
+            const auto [l, r] = splitHelper(n->left, pos);
+            n->left = r;
+            update(n);
+            return { l, n };
+        }
+        const qsizetype nodeEnd = leftLength + n->text.size();
+        if (pos >= nodeEnd) {
+            const auto [l, r] = splitHelper(n->right, pos - nodeEnd);
+            n->right = l;
+            update(n);
+            return { n, r };
+        }
+        // pos falls inside this chunk: cut it in two
+        const qsizetype offset = pos - leftLength;
+        Node *tail = newNode(n->text.sliced(offset));
+        n->text.truncate(offset);
+        Node *right = std::exchange(n->right, nullptr);
+        update(n);
+        return { n, merge(tail, right) };
+    }
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QStringRopeData)
+
+/*!
+    Returns the text of the chunk this iterator points to.
+*/
+QStringView QStringRope::ChunkIterator::operator*() const noexcept
+{
+    Q_ASSERT(node);
+    return node->text;
+}
+
+/*!
+    Advances this iterator to the next chunk.
+*/
+QStringRope::ChunkIterator &QStringRope::ChunkIterator::operator++() noexcept
+{
+    Q_ASSERT(node);
+    node = successor(node);
+    return *this;
+}
+
+/*!
+    Constructs an empty rope.
+*/
+QStringRope::QStringRope() noexcept = default;
+
+/*!
+    Constructs a rope holding a copy of \a text.
+*/
+QStringRope::QStringRope(QStringView text)
+{
+    insert(0, text);
+}
+
+QStringRope::QStringRope(const QStringRope &other) noexcept = default;
+QStringRope &QStringRope::operator=(const QStringRope &other) noexcept = default;
+QStringRope::~QStringRope() = default;
+
+/*!
+    Returns the number of characters in this rope.
+*/
+qsizetype QStringRope::size() const noexcept
+{
+    return d ? lengthOf(d->root) : 0;
+}
+
+/*!
+    Returns the number of chunks the text is currently stored in. This is
+    an implementation detail, mostly useful to tests and benchmarks.
+*/
+qsizetype QStringRope::chunkCount() const noexcept
+{
+    return d ? countNodes(d->root) : 0;
+}
+
+/*!
+    Returns the character at position \a i, which must be a valid index
+    position in this rope.
+
+    \sa size()
+*/
+QChar QStringRope::at(qsizetype i) const
+{
+    Q_ASSERT(size_t(i) < size_t(size()));
+    qsizetype start;
+    const Node *n = findNode(d->root, i, &start);
+    return n->text.at(i - start);
+}
+
+/*!
+    Inserts \a text at position \a pos, which must be between 0 and size(),
+    inclusive.
+*/
+void QStringRope::insert(qsizetype pos, QStringView text)
+{
+    Q_ASSERT(size_t(pos) <= size_t(size()));
+    if (text.isEmpty())
+        return;
+    if (!d)
+        d = new QStringRopeData;
+    else
+        d.detach();
+
+    if (d->root && text.size() < MaxChunkSize) {
+        // Try to fit it in the chunk that ends at, or contains, pos.
+        qsizetype start;
+        Node *n = const_cast<Node *>(findNode(d->root, pos > 0 ? pos - 1 : 0, &start));
+        if (n->text.size() + text.size() <= MaxChunkSize) {
+            n->text.insert(pos - start, text);
+            for (; n; n = n->parent)
+                n->length += text.size();
+            return;
+        }
+    }
+
+    const auto [left, right] = d->splitRoot(pos);
+    d->setRoot(merge(merge(left, d->build(text)), right));
+    coalesceAt(pos + text.size());
+    coalesceAt(pos);
+}
+
+/*!
+    Removes \a n characters starting at position \a pos. The range must lie
+    within the rope.
+*/
+void QStringRope::remove(qsizetype pos, qsizetype n)
+{
+    Q_ASSERT(pos >= 0 && n >= 0 && pos <= size() - n);
+    if (n == 0)
+        return;
+    if (n == size()) {
+        clear();
+        return;
+    }
+    d.detach();
+    const auto [left, rest] = d->splitRoot(pos);
+    const auto [middle, right] = d->split(rest, n);
+    destroy(middle);
+    d->setRoot(merge(left, right));
+    coalesceAt(pos);
+}
+
+/*!
+    Truncates the rope at position \a pos, which must be between 0 and size(),
+    inclusive.
+*/
+void QStringRope::truncate(qsizetype pos)
+{
+    remove(pos, size() - pos);
+}
+
+/*!
+    Removes \a n characters from the end of the rope. \a n must not be larger
+    than size().
+*/
+void QStringRope::chop(qsizetype n)
+{
+    remove(size() - n, n);
+}
+
+/*!
+    Removes all text from this rope.
+*/
+void QStringRope::clear()
+{
+    d.reset();
+}
+
+/*!
+    Returns a string holding \a n characters of this rope, starting at
+    position \a pos. If \a n is -1, or extends beyond the end, the text up to
+    the end of the rope is returned.
+*/
+QString QStringRope::mid(qsizetype pos, qsizetype n) const
+{
+    Q_ASSERT(size_t(pos) <= size_t(size()));
+    if (n < 0 || n > size() - pos)
+        n = size() - pos;
+    QString result;
+    if (n == 0)
+        return result;
+    result.reserve(n);
+    qsizetype start;
+    for (const Node *node = findNode(d->root, pos, &start); n > 0; node = successor(node)) {
+        const QStringView chunk = QStringView(node->text).sliced(pos - start);
+        const qsizetype count = qMin(chunk.size(), n);
+        result.append(chunk.first(count));
+        n -= count;
+        pos = start = 0;
+    }
+    return result;
+}
+
+/*!
+    Returns the whole text of this rope as a QString.
+
+    \sa chunks()
+*/
+QString QStringRope::toString() const
+{
+    QString result;
+    result.reserve(size());
+    for (QStringView chunk : chunks())
+        result.append(chunk);
+    return result;
+}
+
+/*!
+    Returns an iterator to the first chunk of text.
+
+    \sa chunks(), chunkEnd()
+*/
+QStringRope::ChunkIterator QStringRope::chunkBegin() const noexcept
+{
+    return ChunkIterator(d ? leftmost(d->root) : nullptr);
+}
+
+/*!
+    \internal
+
+    Merges the chunks on either side of \a pos if they fit in one, to keep
+    the number of nodes proportional to the size of the text.
+*/
+void QStringRope::coalesceAt(qsizetype pos)
+{
+    if (pos <= 0 || pos >= size())
+        return;
+    qsizetype beforeStart, afterStart;
+    const Node *before = findNode(d->root, pos - 1, &beforeStart);
+    const Node *after = findNode(d->root, pos, &afterStart);
+    if (before == after || before->text.size() + after->text.size() > MaxChunkSize)
+        return;
+
+    const qsizetype end = afterStart + after->text.size();
+    const auto [left, rest] = d->splitRoot(beforeStart);
+    const auto [middle, right] = d->split(rest, end - beforeStart);
+    Q_ASSERT(middle && countNodes(middle) == 2);
+    const Node *first = leftmost(middle);
+    const Node *second = successor(first);
+    Node *joined = d->newNode(first->text + second->text);
+    destroy(middle);
+    d->setRoot(merge(merge(left, joined), right));
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSTRINGROPE_P_H
+#define QSTRINGROPE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+struct QStringRopeNode;
+class QStringRopeData;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QStringRopeData, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QStringRope
+{
+public:
+    class Q_CORE_EXPORT ChunkIterator
+    {
+        const QStringRopeNode *node = nullptr;
+        friend class QStringRope;
+        explicit ChunkIterator(const QStringRopeNode *n) noexcept : node(n) {}
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = qptrdiff;
+        using value_type = QStringView;
+        using pointer = void;
+        using reference = QStringView;
+
+        ChunkIterator() noexcept = default;
+
+        QStringView operator*() const noexcept;
+        ChunkIterator &operator++() noexcept;
+        ChunkIterator operator++(int) noexcept
+        { ChunkIterator copy = *this; ++*this; return copy; }
+
+        friend bool operator==(ChunkIterator lhs, ChunkIterator rhs) noexcept
+        { return lhs.node == rhs.node; }
+        friend bool operator!=(ChunkIterator lhs, ChunkIterator rhs) noexcept
+        { return lhs.node != rhs.node; }
+    };
+
+    struct Chunks
+    {
+        ChunkIterator first;
+        ChunkIterator last;
+        ChunkIterator begin() const noexcept { return first; }
+        ChunkIterator end() const noexcept { return last; }
+    };
+
+    QStringRope() noexcept;
+    explicit QStringRope(QStringView text);
+    QStringRope(const QStringRope &other) noexcept;
+    QStringRope &operator=(const QStringRope &other) noexcept;
+    QStringRope(QStringRope &&other) noexcept = default;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QStringRope)
+    ~QStringRope();
+
+    void swap(QStringRope &other) noexcept { d.swap(other.d); }
+
+    qsizetype size() const noexcept;
+    bool isEmpty() const noexcept { return size() == 0; }
+    qsizetype chunkCount() const noexcept;
+
+    QChar at(qsizetype i) const;
+    QChar operator[](qsizetype i) const { return at(i); }
+
+    void insert(qsizetype pos, QStringView text);
+    void append(QStringView text) { insert(size(), text); }
+    void prepend(QStringView text) { insert(0, text); }
+    void remove(qsizetype pos, qsizetype n);
+    void truncate(qsizetype pos);
+    void chop(qsizetype n);
+    void clear();
+
+    QString mid(qsizetype pos, qsizetype n = -1) const;
+    QString toString() const;
+
+    ChunkIterator chunkBegin() const noexcept;
+    ChunkIterator chunkEnd() const noexcept { return ChunkIterator(); }
+    Chunks chunks() const noexcept { return { chunkBegin(), chunkEnd() }; }
+
+private:
+    void coalesceAt(qsizetype pos);
+
+    QExplicitlySharedDataPointer<QStringRopeData> d;
+};
+
+Q_DECLARE_SHARED(QStringRope)
+
+QT_END_NAMESPACE
+
+#endif // QSTRINGROPE_P_H
@@ -7,20 +7,43 @@
 
 QT_BEGIN_NAMESPACE
 
+static QUnicodeTools::CharAttributeOptions attributeOptions(QTextBoundaryFinder::BoundaryType type)
+{
+    switch (type) {
+    case QTextBoundaryFinder::Grapheme: return QUnicodeTools::GraphemeBreaks;
+    case QTextBoundaryFinder::Word: return QUnicodeTools::WordBreaks;
+    case QTextBoundaryFinder::Sentence: return QUnicodeTools::SentenceBreaks;
+    case QTextBoundaryFinder::Line: return QUnicodeTools::LineBreaks;
+    }
+    return {};
+}
+
 static void init(QTextBoundaryFinder::BoundaryType type, QStringView str, QCharAttributes *attributes)
 {
     QUnicodeTools::ScriptItemArray scriptItems;
     QUnicodeTools::initScripts(str, &scriptItems);
 
-    QUnicodeTools::CharAttributeOptions options;
-    switch (type) {
-    case QTextBoundaryFinder::Grapheme: options |= QUnicodeTools::GraphemeBreaks; break;
-    case QTextBoundaryFinder::Word: options |= QUnicodeTools::WordBreaks; break;
-    case QTextBoundaryFinder::Sentence: options |= QUnicodeTools::SentenceBreaks; break;
-    case QTextBoundaryFinder::Line: options |= QUnicodeTools::LineBreaks; break;
-    default: break;
-    }
-    QUnicodeTools::initCharAttributes(str, scriptItems.data(), scriptItems.size(), attributes, options);
+    QUnicodeTools::initCharAttributes(str, scriptItems.data(), scriptItems.size(), attributes,
+                                      attributeOptions(type));
+}
+
+// Longer strings are segmented a window at a time, unless the user provides a
+// buffer for the whole string. In that case, the finder holds an
+// IncrementalCharAttributes instead of an array, and 'windowed' is set.
+static constexpr qsizetype IncrementalThreshold =
+        2 * QUnicodeTools::IncrementalCharAttributes::DefaultWindowSize;
+
+static QUnicodeTools::IncrementalCharAttributes *
+createIncremental(QTextBoundaryFinder::BoundaryType type, QStringView str)
+{
+    auto incremental = new QUnicodeTools::IncrementalCharAttributes(attributeOptions(type));
+    incremental->setText(str);
+    return incremental;
+}
+
+inline QCharAttributes QTextBoundaryFinder::attributeAt(qsizetype pos) const
+{
+    return windowed ? incremental->at(pos) : attributes[pos];
 }
 
 /*!
@@ -101,7 +124,7 @@ static void init(QTextBoundaryFinder::BoundaryType type, QStringView str, QCharA
   Constructs an invalid QTextBoundaryFinder object.
 */
 QTextBoundaryFinder::QTextBoundaryFinder()
-    : freeBuffer(true)
+    : freeBuffer(true), windowed(false)
 {
 }
 
@@ -114,8 +137,11 @@ QTextBoundaryFinder::QTextBoundaryFinder(const QTextBoundaryFinder &other)
     , sv(other.sv)
     , pos(other.pos)
     , freeBuffer(true)
+    , windowed(other.windowed)
 {
-    if (other.attributes) {
+    if (windowed) {
+        incremental = createIncremental(t, sv);
+    } else if (other.attributes) {
         Q_ASSERT(sv.size() > 0);
         attributes = (QCharAttributes *) malloc((sv.size() + 1) * sizeof(QCharAttributes));
         Q_CHECK_PTR(attributes);
@@ -131,28 +157,36 @@ QTextBoundaryFinder &QTextBoundaryFinder::operator=(const QTextBoundaryFinder &o
     if (&other == this)
         return *this;
 
-    if (other.attributes) {
+    if (windowed) {
+        delete incremental;
+        attributes = nullptr;
+        windowed = false;
+    }
+
+    if (other.windowed) {
+        if (freeBuffer)
+            free(attributes);
+        incremental = createIncremental(other.t, other.sv);
+        freeBuffer = true;
+        windowed = true;
+    } else if (other.attributes) {
         Q_ASSERT(other.sv.size() > 0);
         size_t newCapacity = (size_t(other.sv.size()) + 1) * sizeof(QCharAttributes);
         QCharAttributes *newD = (QCharAttributes *) realloc(freeBuffer ? attributes : nullptr, newCapacity);
         Q_CHECK_PTR(newD);
         freeBuffer = true;
         attributes = newD;
-    }
-
-    t = other.t;
-    s = other.s;
-    sv = other.sv;
-    pos = other.pos;
-
-    if (other.attributes) {
-        memcpy(attributes, other.attributes, (sv.size() + 1) * sizeof(QCharAttributes));
+        memcpy(attributes, other.attributes, newCapacity);
     } else {
         if (freeBuffer)
             free(attributes);
         attributes = nullptr;
     }
 
+    t = other.t;
+    s = other.s;
+    sv = other.sv;
+    pos = other.pos;
     return *this;
 }
 
@@ -162,7 +196,9 @@ QTextBoundaryFinder &QTextBoundaryFinder::operator=(const QTextBoundaryFinder &o
 QTextBoundaryFinder::~QTextBoundaryFinder()
 {
     Q_UNUSED(unused);
-    if (freeBuffer)
+    if (windowed)
+        delete incremental;
+    else if (freeBuffer)
         free(attributes);
 }
 
@@ -174,8 +210,12 @@ QTextBoundaryFinder::QTextBoundaryFinder(BoundaryType type, const QString &strin
     , s(string)
     , sv(s)
     , freeBuffer(true)
+    , windowed(false)
 {
-    if (sv.size() > 0) {
+    if (sv.size() > IncrementalThreshold) {
+        incremental = createIncremental(t, sv);
+        windowed = true;
+    } else if (sv.size() > 0) {
         attributes = (QCharAttributes *) malloc((sv.size() + 1) * sizeof(QCharAttributes));
         Q_CHECK_PTR(attributes);
         init(t, sv, attributes);
@@ -207,11 +247,16 @@ QTextBoundaryFinder::QTextBoundaryFinder(BoundaryType type, QStringView string,
     : t(type)
     , sv(string)
     , freeBuffer(true)
+    , windowed(false)
 {
     if (!sv.isEmpty()) {
         if (buffer && bufferSize / int(sizeof(QCharAttributes)) >= sv.size() + 1) {
             attributes = reinterpret_cast<QCharAttributes *>(buffer);
             freeBuffer = false;
+        } else if (sv.size() > IncrementalThreshold) {
+            incremental = createIncremental(t, sv);
+            windowed = true;
+            return;
         } else {
             attributes = (QCharAttributes *) malloc((sv.size() + 1) * sizeof(QCharAttributes));
             Q_CHECK_PTR(attributes);
@@ -296,7 +341,7 @@ QString QTextBoundaryFinder::string() const
 */
 qsizetype QTextBoundaryFinder::toNextBoundary()
 {
-    if (!attributes || pos < 0 || pos >= sv.size()) {
+    if (!isValid() || pos < 0 || pos >= sv.size()) {
         pos = -1;
         return pos;
     }
@@ -304,19 +349,19 @@ qsizetype QTextBoundaryFinder::toNextBoundary()
     ++pos;
     switch(t) {
     case Grapheme:
-        while (pos < sv.size() && !attributes[pos].graphemeBoundary)
+        while (pos < sv.size() && !attributeAt(pos).graphemeBoundary)
             ++pos;
         break;
     case Word:
-        while (pos < sv.size() && !attributes[pos].wordBreak)
+        while (pos < sv.size() && !attributeAt(pos).wordBreak)
             ++pos;
         break;
     case Sentence:
-        while (pos < sv.size() && !attributes[pos].sentenceBoundary)
+        while (pos < sv.size() && !attributeAt(pos).sentenceBoundary)
             ++pos;
         break;
     case Line:
-        while (pos < sv.size() && !attributes[pos].lineBreak)
+        while (pos < sv.size() && !attributeAt(pos).lineBreak)
             ++pos;
         break;
     }
@@ -331,7 +376,7 @@ qsizetype QTextBoundaryFinder::toNextBoundary()
 */
 qsizetype QTextBoundaryFinder::toPreviousBoundary()
 {
-    if (!attributes || pos <= 0 || pos > sv.size()) {
+    if (!isValid() || pos <= 0 || pos > sv.size()) {
         pos = -1;
         return pos;
     }
@@ -339,19 +384,19 @@ qsizetype QTextBoundaryFinder::toPreviousBoundary()
     --pos;
     switch(t) {
     case Grapheme:
-        while (pos > 0 && !attributes[pos].graphemeBoundary)
+        while (pos > 0 && !attributeAt(pos).graphemeBoundary)
             --pos;
         break;
     case Word:
-        while (pos > 0 && !attributes[pos].wordBreak)
+        while (pos > 0 && !attributeAt(pos).wordBreak)
             --pos;
         break;
     case Sentence:
-        while (pos > 0 && !attributes[pos].sentenceBoundary)
+        while (pos > 0 && !attributeAt(pos).sentenceBoundary)
             --pos;
         break;
     case Line:
-        while (pos > 0 && !attributes[pos].lineBreak)
+        while (pos > 0 && !attributeAt(pos).lineBreak)
             --pos;
         break;
     }
@@ -364,19 +409,19 @@ qsizetype QTextBoundaryFinder::toPreviousBoundary()
 */
 bool QTextBoundaryFinder::isAtBoundary() const
 {
-    if (!attributes || pos < 0 || pos > sv.size())
+    if (!isValid() || pos < 0 || pos > sv.size())
         return false;
 
     switch(t) {
     case Grapheme:
-        return attributes[pos].graphemeBoundary;
+        return attributeAt(pos).graphemeBoundary;
     case Word:
-        return attributes[pos].wordBreak;
+        return attributeAt(pos).wordBreak;
     case Sentence:
-        return attributes[pos].sentenceBoundary;
+        return attributeAt(pos).sentenceBoundary;
     case Line:
         // ### TR#14 LB2 prohibits break at sot
-        return attributes[pos].lineBreak || pos == 0;
+        return attributeAt(pos).lineBreak || pos == 0;
     }
     return false;
 }
@@ -387,10 +432,10 @@ bool QTextBoundaryFinder::isAtBoundary() const
 QTextBoundaryFinder::BoundaryReasons QTextBoundaryFinder::boundaryReasons() const
 {
     BoundaryReasons reasons = NotAtBoundary;
-    if (!attributes || pos < 0 || pos > sv.size())
+    if (!isValid() || pos < 0 || pos > sv.size())
         return reasons;
 
-    const QCharAttributes attr = attributes[pos];
+    const QCharAttributes attr = attributeAt(pos);
     switch (t) {
     case Grapheme:
         if (attr.graphemeBoundary) {
@@ -11,6 +11,7 @@ QT_BEGIN_NAMESPACE
 
 
 struct QCharAttributes;
+namespace QUnicodeTools { class IncrementalCharAttributes; }
 
 class Q_CORE_EXPORT QTextBoundaryFinder
 {
@@ -43,7 +44,7 @@ public:
     {}
     QTextBoundaryFinder(BoundaryType type, QStringView str, unsigned char *buffer = nullptr, qsizetype bufferSize = 0);
 
-    inline bool isValid() const { return attributes; }
+    inline bool isValid() const { return windowed ? incremental != nullptr : attributes != nullptr; }
 
     inline BoundaryType type() const { return t; }
     QString string() const;
@@ -60,13 +61,19 @@ public:
     BoundaryReasons boundaryReasons() const;
 
 private:
+    QCharAttributes attributeAt(qsizetype pos) const;
+
     BoundaryType t = Grapheme;
     QString s;
     QStringView sv;
     qsizetype pos = 0;
     uint freeBuffer : 1;
-    uint unused : 31;
-    QCharAttributes *attributes = nullptr;
+    uint windowed : 1;
+    uint unused : 30;
+    union {
+        QCharAttributes *attributes = nullptr;  // unless windowed
+        QUnicodeTools::IncrementalCharAttributes *incremental;
+    };
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QTextBoundaryFinder::BoundaryReasons)
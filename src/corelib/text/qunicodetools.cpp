@@ -5,6 +5,7 @@
 
 #include "qunicodetables_p.h"
 #include "qvarlengtharray.h"
+#include <private/qsimd_p.h>
 #if QT_CONFIG(library)
 #include "qlibrary.h"
 #endif
@@ -197,6 +198,24 @@ static void getGraphemeBreaks(const char16_t *string, qsizetype len, QCharAttrib
             attributes[pos].graphemeBoundary = true;
 
         lcls = cls;
+
+#if defined(__SSE2__)
+        // Fast path: there's a boundary before every printable US-ASCII
+        // character following an US-ASCII one (GB4, GB5, GB999).
+        if (ucs4 < 0x80 && state == GB::State::Normal) {
+            while (len - i > 8) {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i + 1));
+                const __m128i printable = _mm_and_si128(_mm_cmpgt_epi16(chunk, _mm_set1_epi16(0x1f)),
+                                                        _mm_cmplt_epi16(chunk, _mm_set1_epi16(0x7f)));
+                if (_mm_movemask_epi8(printable) != 0xffff)
+                    break;
+                for (int j = 1; j <= 8; ++j)
+                    attributes[i + j].graphemeBoundary = true;
+                i += 8;
+                lcls = QUnicodeTables::GraphemeBreak_Any;
+            }
+        }
+#endif
     }
 
     attributes[len].graphemeBoundary = true; // GB2
@@ -728,6 +747,14 @@ static void getLineBreaks(const char16_t *string, qsizetype len, QCharAttributes
         }
 
         if (Q_UNLIKELY(ncls >= QUnicodeTables::LineBreak_SP)) {
+            // LB25: spaces and line breaks end numbers; without this, a
+            // number's breaks would only be fixed up at the next non-space
+            // character, clearing the mandatory breaks in between as well
+            if (Q_UNLIKELY(LB::NS::actionTable[nelast][LB::NS::XX] == LB::NS::Break)) {
+                for (qsizetype j = nestart + 1; j < pos; ++j)
+                    attributes[j].lineBreak = false;
+            }
+            nelast = LB::NS::XX;
             if (ncls > QUnicodeTables::LineBreak_SP)
                 goto next; // LB6: x(BK|CR|LF|NL)
             goto next_no_cls_update; // LB7: xSP
@@ -2417,6 +2444,121 @@ Q_CORE_EXPORT void initCharAttributes(QStringView string,
 }
 
 
+// ----------------------------------------------------------------------------
+//
+// Incremental computation
+//
+// ----------------------------------------------------------------------------
+
+static inline bool isAsciiLetter(char16_t c) noexcept
+{
+    return char16_t((c | 0x20) - u'a') < 26;
+}
+
+// Returns true if the computation of the attributes can restart at \a pos
+// with only the two preceding characters as context, that is, if none of
+// the algorithms carries over any state from before them.
+static bool isRestartPoint(QStringView text, qsizetype pos) noexcept
+{
+    Q_ASSERT(pos > 0 && pos < text.size());
+    const char16_t prev = text[pos - 1].unicode();
+    switch (prev) {
+    case u'\n':
+    case QChar::ParagraphSeparator:
+        // GB4, WB3a, SB4 and LB4/LB5 all break after these, and start over
+        return true;
+    case u'\r':
+        return text[pos].unicode() != u'\n'; // GB3, WB3, LB5
+    case u' ':
+        // "a b": nothing before the space can be looked at, nor anything
+        // after the letter once the space is known (SB8 stops at letters)
+        return pos >= 2 && isAsciiLetter(text[pos - 2].unicode())
+                && isAsciiLetter(text[pos].unicode());
+    default:
+        return false;
+    }
+}
+
+/*!
+    \internal
+
+    Returns the last position at or before \a pos at which the attributes of
+    \a text can be computed independently of what comes before, or 0.
+*/
+qsizetype IncrementalCharAttributes::previousRestartPoint(QStringView text, qsizetype pos) noexcept
+{
+    for (pos = qMin(pos, text.size() - 1); pos > 0; --pos) {
+        if (isRestartPoint(text, pos))
+            return pos;
+    }
+    return 0;
+}
+
+/*!
+    \internal
+
+    Returns the first position at or after \a pos at which the attributes of
+    \a text can be computed independently of what comes before, or the size
+    of \a text.
+*/
+qsizetype IncrementalCharAttributes::nextRestartPoint(QStringView text, qsizetype pos) noexcept
+{
+    for (pos = qMax(pos, 1); pos < text.size(); ++pos) {
+        if (isRestartPoint(text, pos))
+            return pos;
+    }
+    return text.size();
+}
+
+void IncrementalCharAttributes::setText(QStringView text) noexcept
+{
+    m_text = text;
+    m_windowStart = m_windowEnd = 0;
+}
+
+void IncrementalCharAttributes::textChanged(QStringView text, qsizetype position,
+                                            qsizetype charsRemoved, qsizetype charsAdded) noexcept
+{
+    const qsizetype oldSize = m_text.size();
+    m_text = text;
+    if (m_windowStart == m_windowEnd)
+        return;
+
+    // The window depends on the text from two characters before its start
+    // up to its end; its last position also depends on the end of the text.
+    const qsizetype contextStart = qMax(m_windowStart - 2, 0);
+    if (m_windowEnd <= oldSize && position >= m_windowEnd)
+        return;
+    if (position + charsRemoved <= contextStart && contextStart > 0) {
+        m_windowStart += charsAdded - charsRemoved;
+        m_windowEnd += charsAdded - charsRemoved;
+        return;
+    }
+    m_windowStart = m_windowEnd = 0;
+}
+
+void IncrementalCharAttributes::segment(qsizetype pos)
+{
+    // Center the window on pos, so that walking backwards is as cheap as
+    // walking forwards.
+    const qsizetype start = previousRestartPoint(m_text, qMax(pos - m_windowSize / 2, 0));
+    const qsizetype end = nextRestartPoint(m_text, qMax(pos + 1, start + m_windowSize));
+    const qsizetype contextStart = qMax(start - 2, 0);
+    const QStringView window = m_text.sliced(contextStart, end - contextStart);
+
+    m_attributes.resize(window.size() + 1);
+    ::memset(m_attributes.data(), 0, m_attributes.size() * sizeof(QCharAttributes));
+    ScriptItemArray scriptItems;
+    initScripts(window, &scriptItems);
+    initCharAttributes(window, scriptItems.data(), scriptItems.size(), m_attributes.data(),
+                       m_options | DontClearAttributes);
+    m_attributes.remove(0, start - contextStart);
+
+    m_windowStart = start;
+    // the attributes at the end of the window are only right at the end of the text
+    m_windowEnd = end == m_text.size() ? end + 1 : end;
+}
+
 // ----------------------------------------------------------------------------
 //
 // The Unicode script property. See http://www.unicode.org/reports/tr24/tr24-24.html
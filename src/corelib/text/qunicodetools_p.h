@@ -68,6 +68,55 @@ Q_CORE_EXPORT void initCharAttributes(QStringView str,
 
 Q_CORE_EXPORT void initScripts(QStringView str, ScriptItemArray *scripts);
 
+// Computes the attributes of a string a window at a time, so that only
+// O(window) memory is needed and edits only invalidate the affected window.
+// Windows start and end at positions where none of the algorithms carries
+// state over from the preceding text, so they can be computed independently.
+class Q_CORE_EXPORT IncrementalCharAttributes
+{
+public:
+    enum { DefaultWindowSize = 4096 };
+
+    explicit IncrementalCharAttributes(CharAttributeOptions options,
+                                       qsizetype windowSize = DefaultWindowSize) noexcept
+        : m_options(options.setFlag(DontClearAttributes, false)), m_windowSize(windowSize)
+    {}
+
+    QStringView text() const noexcept { return m_text; }
+    void setText(QStringView text) noexcept;
+    // text is the new text, in which charsRemoved characters at position
+    // were replaced by charsAdded characters
+    void textChanged(QStringView text, qsizetype position,
+                     qsizetype charsRemoved, qsizetype charsAdded) noexcept;
+
+    // pos is between 0 and text().size(), inclusive
+    QCharAttributes at(qsizetype pos)
+    {
+        Q_ASSERT(pos >= 0 && pos <= m_text.size());
+        if (pos < m_windowStart || pos >= m_windowEnd)
+            segment(pos);
+        return m_attributes[pos - m_windowStart];
+    }
+
+    qsizetype windowStart() const noexcept { return m_windowStart; }
+    qsizetype windowEnd() const noexcept { return m_windowEnd; }
+
+    static qsizetype previousRestartPoint(QStringView text, qsizetype pos) noexcept;
+    static qsizetype nextRestartPoint(QStringView text, qsizetype pos) noexcept;
+
+private:
+    void segment(qsizetype pos);
+
+    QStringView m_text;
+    CharAttributeOptions m_options;
+    qsizetype m_windowSize;
+    // m_attributes[i] holds the attributes of position m_windowStart + i,
+    // valid for positions in [m_windowStart, m_windowEnd)
+    qsizetype m_windowStart = 0;
+    qsizetype m_windowEnd = 0;
+    QVarLengthArray<QCharAttributes, 256> m_attributes;
+};
+
 } // namespace QUnicodeTools
 
 QT_END_NAMESPACE
@@ -0,0 +1,237 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qepochreclaimer_p.h"
+
+#include <QtCore/qmutex.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QEpochReclaimer
+    \inmodule QtCore
+
+    \brief QEpochReclaimer defers the deletion of objects that lock-free
+    readers may still be using.
+
+    Lock-free data structures unlink objects while other threads may still
+    be reading them. Instead of deleting an unlinked object, a writer passes
+    it to retire(), and readers access the structure only while holding a
+    QEpochReclaimer::Guard:
+
+    \code
+    // reader
+    QEpochReclaimer::Guard guard;
+    Node *n = head.loadAcquire();
+    ...
+
+    // writer, with other writers excluded
+    Node *n = head.loadRelaxed();
+    head.storeRelease(n->next);
+    QEpochReclaimer::retire(n);
+    \endcode
+
+    The reclaimer keeps a global epoch counter. A guard publishes the epoch
+    its thread entered at, and the epoch only advances once every thread
+    inside a guard has seen the current one. An object retired in epoch \e e
+    can no longer be reached by anyone once the epoch has reached \e{e + 2},
+    at which point it is deleted.
+
+    Entering and leaving a guard costs a thread-local lookup and a memory
+    fence, and guards can be nested. Retired objects are kept in a list
+    owned by the retiring thread, so writers never contend with each other
+    in retire(). Objects are deleted in batches from retire() or collect(),
+    in whichever thread calls them, and never while the reclaimer holds a
+    lock. Callers should likewise not call retire() with their own locks
+    held, as it may run the deleters of earlier retired objects.
+*/
+
+namespace {
+struct Retired
+{
+    void *ptr;
+    QEpochReclaimer::Deleter deleter;
+    quint64 epoch;
+};
+
+struct ThreadRecord
+{
+    std::atomic<quint64> epoch = 0;     // 0 while not inside a guard
+    std::atomic<bool> inUse = true;
+    ThreadRecord *next = nullptr;
+    int nesting = 0;                    // only used by the owning thread
+
+    // Objects retired by the owning thread. The mutex is only contended by
+    // collect() and pendingCount(); when the thread exits, the objects stay
+    // here until collect() or the next thread using this record gets to
+    // them.
+    QBasicMutex limboMutex;
+    std::vector<Retired> limbo;
+    size_t nextCollection = CollectionThreshold;
+
+    static constexpr size_t CollectionThreshold = 128;
+};
+
+struct RecordHolder
+{
+    ~RecordHolder()
+    {
+        if (record)
+            record->inUse.store(false, std::memory_order_release);
+    }
+    ThreadRecord *record = nullptr;
+};
+} // unnamed namespace
+
+Q_CONSTINIT static std::atomic<ThreadRecord *> records = nullptr;
+Q_CONSTINIT static std::atomic<quint64> globalEpoch = 1;
+static thread_local RecordHolder recordHolder;
+
+static ThreadRecord *acquireRecord()
+{
+    // records are never freed, but reused once their thread exits
+    for (ThreadRecord *r = records.load(std::memory_order_acquire); r; r = r->next) {
+        bool expected = false;
+        if (!r->inUse.load(std::memory_order_relaxed)
+                && r->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            r->nesting = 0;
+            return r;
+        }
+    }
+
+    auto r = new ThreadRecord;
+    ThreadRecord *head = records.load(std::memory_order_relaxed);
+    do {
+        r->next = head;
+    } while (!records.compare_exchange_weak(head, r, std::memory_order_release,
+                                            std::memory_order_relaxed));
+    return r;
+}
+
+static ThreadRecord *currentRecord()
+{
+    ThreadRecord *&r = recordHolder.record;
+    if (!r)
+        r = acquireRecord();
+    return r;
+}
+
+static void deleteRetiredAtExit()
+{
+    for (ThreadRecord *r = records.load(std::memory_order_acquire); r; r = r->next) {
+        for (const Retired &item : r->limbo)
+            item.deleter(item.ptr);
+        r->limbo.clear();
+    }
+}
+Q_DESTRUCTOR_FUNCTION(deleteRetiredAtExit)
+
+void QEpochReclaimer::enter() noexcept
+{
+    ThreadRecord *r = currentRecord();
+    if (r->nesting++ == 0) {
+        r->epoch.store(globalEpoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        // make the epoch visible before anything this thread reads
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void QEpochReclaimer::leave()
+{
+    ThreadRecord *r = recordHolder.record;
+    Q_ASSERT(r && r->nesting > 0);
+    if (--r->nesting == 0)
+        r->epoch.store(0, std::memory_order_release);
+}
+
+// Advances the epoch if every thread inside a guard has seen the current
+// one, and returns the epoch to collect against.
+static quint64 tryAdvanceEpoch()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    quint64 epoch = globalEpoch.load(std::memory_order_relaxed);
+    for (ThreadRecord *r = records.load(std::memory_order_acquire); r; r = r->next) {
+        const quint64 e = r->epoch.load(std::memory_order_relaxed);
+        if (e && e != epoch)
+            return epoch;
+    }
+    // if this fails, another thread advanced it, which is just as good
+    if (globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst))
+        ++epoch;
+    return epoch;
+}
+
+// Moves what can be deleted from \a r's limbo into \a garbage. Must be
+// called with the record's limbo mutex locked.
+static void takeExpired(ThreadRecord *r, quint64 epoch, std::vector<Retired> &garbage)
+{
+    auto it = std::partition(r->limbo.begin(), r->limbo.end(), [epoch](const Retired &item) {
+        return item.epoch + 2 > epoch;
+    });
+    garbage.insert(garbage.end(), it, r->limbo.end());
+    r->limbo.erase(it, r->limbo.end());
+    r->nextCollection = r->limbo.size() + ThreadRecord::CollectionThreshold;
+}
+
+/*!
+    Schedules \a ptr to be deleted with \a deleter once no thread can be
+    reading it anymore. The object must already have been unlinked from any
+    shared data structure.
+
+    This function may delete objects retired earlier by the same thread, so
+    it should not be called while holding locks that their deleters might
+    need.
+*/
+void QEpochReclaimer::retire(void *ptr, Deleter deleter)
+{
+    // the unlinking must be visible before we read the epoch
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    ThreadRecord *r = currentRecord();
+    std::vector<Retired> garbage;
+    {
+        QMutexLocker locker(&r->limboMutex);
+        r->limbo.push_back({ ptr, deleter, globalEpoch.load(std::memory_order_relaxed) });
+        if (r->limbo.size() >= r->nextCollection)
+            takeExpired(r, tryAdvanceEpoch(), garbage);
+    }
+    for (const Retired &item : garbage)
+        item.deleter(item.ptr);
+}
+
+/*!
+    Deletes the retired objects of all threads that are no longer
+    reachable, advancing the epoch if possible. Calling this function twice
+    while no thread is inside a guard deletes all retired objects.
+*/
+void QEpochReclaimer::collect()
+{
+    const quint64 epoch = tryAdvanceEpoch();
+    std::vector<Retired> garbage;
+    for (ThreadRecord *r = records.load(std::memory_order_acquire); r; r = r->next) {
+        QMutexLocker locker(&r->limboMutex);
+        takeExpired(r, epoch, garbage);
+    }
+    for (const Retired &item : garbage)
+        item.deleter(item.ptr);
+}
+
+/*!
+    Returns the number of objects that were retired but not deleted yet.
+*/
+qsizetype QEpochReclaimer::pendingCount() noexcept
+{
+    qsizetype count = 0;
+    for (ThreadRecord *r = records.load(std::memory_order_acquire); r; r = r->next) {
+        QMutexLocker locker(&r->limboMutex);
+        count += qsizetype(r->limbo.size());
+    }
+    return count;
+}
+
+QT_END_NAMESPACE
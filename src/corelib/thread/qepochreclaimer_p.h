@@ -0,0 +1,53 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QEPOCHRECLAIMER_P_H
+#define QEPOCHRECLAIMER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+
+QT_REQUIRE_CONFIG(thread);
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QEpochReclaimer
+{
+public:
+    using Deleter = void (*)(void *);
+
+    class Guard
+    {
+    public:
+        Guard() noexcept { QEpochReclaimer::enter(); }
+        ~Guard() { QEpochReclaimer::leave(); }
+        Q_DISABLE_COPY_MOVE(Guard)
+    };
+
+    static void retire(void *ptr, Deleter deleter);
+    template <typename T> static void retire(T *ptr)
+    {
+        retire(ptr, [](void *p) { delete static_cast<T *>(p); });
+    }
+
+    static void collect();
+    static qsizetype pendingCount() noexcept;
+
+private:
+    static void enter() noexcept;
+    static void leave();
+};
+
+QT_END_NAMESPACE
+
+#endif // QEPOCHRECLAIMER_P_H
@@ -8,6 +8,7 @@
 #include "qreadwritelock.h"
 #include "qabstracteventdispatcher.h"
 #include "qbindingstorage.h"
+#include "qyieldcpu.h"
 
 #include <qeventloop.h>
 
@@ -15,6 +16,7 @@
 #include "private/qcoreapplication_p.h"
 
 #include <limits>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -40,6 +42,60 @@ void QPostEventList::addEvent(const QPostEvent &ev)
     }
 }
 
+void QPostEventList::pushIncomingEvent(IncomingEvent *e) noexcept
+{
+    e->next.storeRelaxed(nullptr);
+    IncomingEvent *previous = incomingTail.fetchAndStoreOrdered(e);
+    // until this store, the consumer sees the queue end at previous
+    previous->next.storeRelease(e);
+}
+
+// Takes the oldest event out of the queue, or returns nullptr if there is
+// none, or if the next one is still being pushed.
+QPostEventList::IncomingEvent *QPostEventList::popIncomingEvent() noexcept
+{
+    IncomingEvent *head = incomingHead;
+    IncomingEvent *next = head->next.loadAcquire();
+    if (head == &incomingStub) {
+        if (!next)
+            return nullptr;
+        incomingHead = head = next;
+        next = head->next.loadAcquire();
+    }
+    if (next) {
+        incomingHead = next;
+        return head;
+    }
+    if (head != incomingTail.loadAcquire())
+        return nullptr;
+
+    // head is the last one: put the stub back behind it
+    pushIncomingEvent(&incomingStub);
+    next = head->next.loadAcquire();
+    if (next) {
+        incomingHead = next;
+        return head;
+    }
+    return nullptr;
+}
+
+void QPostEventList::takeIncomingEvents()
+{
+    while (IncomingEvent *e = popIncomingEvent()) {
+        std::unique_ptr<IncomingEvent> node(e);
+        addEvent(node->event);
+    }
+}
+
+void QPostEventList::waitForProducers() const noexcept
+{
+    // Pairs with the QAtomicInt::ref() in QCoreApplication::postEvent(): if
+    // we don't see a producer here, it sees the thread data we stored before.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (producers.loadAcquire())
+        qYieldCpu();
+}
+
 
 /*
   QThreadData
@@ -82,6 +138,7 @@ QThreadData::~QThreadData()
     thread.storeRelease(nullptr);
     delete t;
 
+    postEventList.takeIncomingEvents();
     for (int i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
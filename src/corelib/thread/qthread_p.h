@@ -72,11 +72,33 @@ public:
 
     QMutex mutex;
 
+    // Normal priority events posted without locking the mutex, see
+    // QCoreApplicationPrivate::lockFreePostedEvents. They are kept in a
+    // multiple-producer, single-consumer queue until moved to the list;
+    // whoever has the mutex locked is the consumer.
+    struct IncomingEvent
+    {
+        QPostEvent event;
+        QAtomicPointer<IncomingEvent> next;
+    };
+    IncomingEvent incomingStub;
+    IncomingEvent *incomingHead = &incomingStub;
+    QAtomicPointer<IncomingEvent> incomingTail = &incomingStub;
+    // number of threads pushing to the queue, for QObject::moveToThread()
+    QAtomicInt producers;
+
     inline QPostEventList() : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0) { }
 
     void addEvent(const QPostEvent &ev);
+    void pushIncomingEvent(IncomingEvent *e) noexcept;
+    bool hasIncomingEvents() const noexcept { return incomingTail.loadRelaxed() != &incomingStub; }
+    // must be called with the mutex locked, before looking at the list
+    void takeIncomingEvents();
+    void waitForProducers() const noexcept;
 
 private:
+    IncomingEvent *popIncomingEvent() noexcept;
+
     //hides because they do not keep that list sorted. addEvent must be used
     using QList<QPostEvent>::append;
     using QList<QPostEvent>::insert;
@@ -308,7 +330,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return canWait && !postEventList.hasIncomingEvents();
     }
 
 private:
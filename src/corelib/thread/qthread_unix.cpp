@@ -229,6 +229,7 @@ QAbstractEventDispatcher *QThreadPrivate::createEventDispatcher(QThreadData *dat
     const bool isQtMainThread = data->thread.loadAcquire() == QCoreApplicationPrivate::mainThread();
     if (qEnvironmentVariableIsEmpty("QT_NO_GLIB")
         && (isQtMainThread || qEnvironmentVariableIsEmpty("QT_NO_THREADED_GLIB"))
+        && !QEventDispatcherUNIXPrivate::epollRequested()
         && QEventDispatcherGlib::versionSupported())
         return new QEventDispatcherGlib;
     else
@@ -29,6 +29,7 @@ public:
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+    uint homeQueue = 0;
 };
 
 /*
@@ -57,27 +58,35 @@ void QThreadPoolThread::run()
 
         do {
             if (r) {
-                // If autoDelete() is false, r might already be deleted after run(), so check status now.
-                const bool del = r->autoDelete();
-
-                // run the task
                 locker.unlock();
+                do {
+                    // If autoDelete() is false, r might already be deleted after run(), so check status now.
+                    const bool del = r->autoDelete();
+
+                    // run the task
 #ifndef QT_NO_EXCEPTIONS
-                try {
+                    try {
 #endif
-                    r->run();
+                        r->run();
 #ifndef QT_NO_EXCEPTIONS
-                } catch (...) {
-                    qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
-                             "This is not supported, exceptions thrown in worker threads must be\n"
-                             "caught before control returns to Qt Concurrent.");
-                    registerThreadInactive();
-                    throw;
-                }
+                    } catch (...) {
+                        qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
+                                 "This is not supported, exceptions thrown in worker threads must be\n"
+                                 "caught before control returns to Qt Concurrent.");
+                        registerThreadInactive();
+                        throw;
+                    }
 #endif
 
-                if (del)
-                    delete r;
+                    if (del)
+                        delete r;
+
+                    // in work-stealing mode, continue with the next local task
+                    // without going through the pool mutex, unless a task with
+                    // a higher priority is waiting in the shared queue
+                    r = manager->highPriorityPending.loadRelaxed()
+                            ? nullptr : manager->popLocalTask(homeQueue);
+                } while (r);
                 locker.relock();
             }
 
@@ -85,6 +94,12 @@ void QThreadPoolThread::run()
             if (manager->tooManyThreadsActive())
                 break;
 
+            if (manager->queue.isEmpty() || manager->queue.constFirst()->priority() <= 0) {
+                r = manager->popLocalTask(homeQueue);
+                if (r)
+                    continue;
+            }
+
             // all work is done, time to wait for more
             if (manager->queue.isEmpty())
                 break;
@@ -96,6 +111,7 @@ void QThreadPoolThread::run()
                 manager->queue.removeFirst();
                 delete page;
             }
+            manager->updateHighPriorityPending();
         } while (true);
 
         // this thread is about to be deleted, do not wait or expire
@@ -190,6 +206,13 @@ inline bool comparePriority(int priority, const QueuePage *p)
 void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
 {
     Q_ASSERT(runnable != nullptr);
+    if (workStealing && priority == 0) {
+        // count first, so that localTaskCount never underestimates the queued tasks
+        localTaskCount.fetchAndAddRelease(1);
+        localQueues[nextLocalQueue++ % localQueueCount].push(runnable);
+        return;
+    }
+
     for (QueuePage *page : std::as_const(queue)) {
         if (page->priority() == priority && !page->isFull()) {
             page->push(runnable);
@@ -198,6 +221,35 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     }
     auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority, comparePriority);
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
+    updateHighPriorityPending();
+}
+
+/*!
+    \internal
+
+    Returns a task from the work-stealing queues, preferring the front of
+    \a homeQueue and otherwise stealing from the back of the other queues,
+    or \nullptr if all of them are empty. Does not need the pool mutex.
+*/
+QRunnable *QThreadPoolPrivate::popLocalTask(uint homeQueue)
+{
+    // acquire pairs with the release in enqueueTask(), which also publishes localQueues
+    if (localTaskCount.loadAcquire() == 0)
+        return nullptr;
+
+    homeQueue %= localQueueCount;
+    QRunnable *runnable = localQueues[homeQueue].takeFirst();
+    for (uint i = 1; !runnable && i < localQueueCount; ++i)
+        runnable = localQueues[(homeQueue + i) % localQueueCount].takeLast();
+
+    if (runnable)
+        localTaskCount.fetchAndSubRelaxed(1);
+    return runnable;
+}
+
+void QThreadPoolPrivate::updateHighPriorityPending()
+{
+    highPriorityPending.storeRelaxed(!queue.isEmpty() && queue.constFirst()->priority() > 0);
 }
 
 int QThreadPoolPrivate::activeThreadCount() const
@@ -223,6 +275,18 @@ void QThreadPoolPrivate::tryToStartMoreThreads()
             delete page;
         }
     }
+    updateHighPriorityPending();
+
+    // hand work from the local queues to threads that can be started or woken up
+    while (!areAllThreadsActive()) {
+        QRunnable *runnable = popLocalTask(0);
+        if (!runnable)
+            break;
+        if (!tryStart(runnable)) {
+            enqueueTask(runnable);
+            break;
+        }
+    }
 }
 
 bool QThreadPoolPrivate::areAllThreadsActive() const
@@ -247,6 +311,7 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     if (objectName.isEmpty())
         objectName = u"Thread (pooled)"_s;
     thread->setObjectName(objectName);
+    thread->homeQueue = nextHomeQueue++;
     Q_ASSERT(!allThreads.contains(thread.get())); // if this assert hits, we have an ABA problem (deleted threads don't get removed here)
     allThreads.insert(thread.get());
     ++activeThreads;
@@ -290,10 +355,13 @@ void QThreadPoolPrivate::reset()
 bool QThreadPoolPrivate::waitForDone(const QDeadlineTimer &timer)
 {
     QMutexLocker locker(&mutex);
-    while (!(queue.isEmpty() && activeThreads == 0) && !timer.hasExpired())
+    const auto isDone = [this] {
+        return queue.isEmpty() && localTaskCount.loadRelaxed() == 0 && activeThreads == 0;
+    };
+    while (!isDone() && !timer.hasExpired())
         noActiveThreads.wait(&mutex, timer);
 
-    if (!queue.isEmpty() || activeThreads)
+    if (!isDone())
         return false;
 
     reset();
@@ -318,6 +386,19 @@ void QThreadPoolPrivate::clear()
         }
         delete page;
     }
+    updateHighPriorityPending();
+
+    for (uint i = 0; localTaskCount.loadRelaxed() && i < localQueueCount; ++i) {
+        const QList<QRunnable *> tasks = localQueues[i].takeAll();
+        localTaskCount.fetchAndSubRelaxed(tasks.size());
+        for (QRunnable *r : tasks) {
+            if (r->autoDelete()) {
+                locker.unlock();
+                delete r;
+                locker.relock();
+            }
+        }
+    }
 }
 
 /*!
@@ -351,6 +432,14 @@ bool QThreadPool::tryTake(QRunnable *runnable)
                 d->queue.removeOne(page);
                 delete page;
             }
+            d->updateHighPriorityPending();
+            return true;
+        }
+    }
+
+    for (uint i = 0; d->localTaskCount.loadRelaxed() && i < d->localQueueCount; ++i) {
+        if (d->localQueues[i].tryTake(runnable)) {
+            d->localTaskCount.fetchAndSubRelaxed(1);
             return true;
         }
     }
@@ -730,6 +819,49 @@ QThread::Priority QThreadPool::threadPriority() const
     return d->threadPriority;
 }
 
+/*! \property QThreadPool::workStealingEnabled
+    \brief whether queued runnables are distributed over per-thread queues.
+
+    By default, runnables that cannot be started immediately are kept in a
+    single queue shared by all worker threads, and every worker takes the
+    pool's lock to fetch its next runnable. With many threads running many
+    short runnables, that lock can dominate the run time.
+
+    When this property is \c true, runnables queued with the default
+    priority of 0 are spread over a set of queues with individual locks.
+    Each worker thread prefers its own queue and steals from the others
+    once it runs dry, so that fetching the next runnable no longer contends
+    on the pool's lock. Runnables queued with a different priority still go
+    through the shared queue: those with a higher priority run before, those
+    with a lower priority after the runnables with priority 0. Among
+    runnables with priority 0, the order of execution is no longer the order
+    in which they were queued.
+
+    The default value is \c false.
+
+    \since 6.9
+    \sa start()
+*/
+
+void QThreadPool::setWorkStealingEnabled(bool enabled)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (enabled && !d->localQueues) {
+        // never reallocated, so that workers can access it without the lock
+        d->localQueueCount = uint(qMax(d->maxThreadCount(), QThread::idealThreadCount()));
+        d->localQueues.reset(new QThreadPoolLocalQueue[d->localQueueCount]);
+    }
+    d->workStealing = enabled;
+}
+
+bool QThreadPool::isWorkStealingEnabled() const
+{
+    Q_D(const QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    return d->workStealing;
+}
+
 /*!
     Releases a thread previously reserved by a call to reserveThread().
 
@@ -24,6 +24,8 @@
 #include "QtCore/qqueue.h"
 #include "private/qobject_p.h"
 
+#include <memory>
+
 QT_REQUIRE_CONFIG(thread);
 
 QT_BEGIN_NAMESPACE
@@ -107,6 +109,47 @@ private:
     QRunnable *m_entries[MaxPageSize];
 };
 
+// One of the queues used in work-stealing mode. Tasks are only ever pushed
+// with the pool mutex held, but popped and stolen without it. Aligned so that
+// neighbouring queues do not share a cache line.
+class alignas(64) QThreadPoolLocalQueue
+{
+public:
+    void push(QRunnable *runnable)
+    {
+        QMutexLocker locker(&mutex);
+        tasks.append(runnable);
+    }
+
+    QRunnable *takeFirst()
+    {
+        QMutexLocker locker(&mutex);
+        return tasks.isEmpty() ? nullptr : tasks.takeFirst();
+    }
+
+    QRunnable *takeLast()
+    {
+        QMutexLocker locker(&mutex);
+        return tasks.isEmpty() ? nullptr : tasks.takeLast();
+    }
+
+    bool tryTake(QRunnable *runnable)
+    {
+        QMutexLocker locker(&mutex);
+        return tasks.removeOne(runnable);
+    }
+
+    QList<QRunnable *> takeAll()
+    {
+        QMutexLocker locker(&mutex);
+        return std::exchange(tasks, {});
+    }
+
+private:
+    QMutex mutex;
+    QList<QRunnable *> tasks;
+};
+
 class QThreadPoolThread;
 class Q_CORE_EXPORT QThreadPoolPrivate : public QObjectPrivate
 {
@@ -132,6 +175,8 @@ public:
     void clear();
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
+    QRunnable *popLocalTask(uint homeQueue);
+    void updateHighPriorityPending();
 
     static QThreadPool *qtGuiInstance();
 
@@ -149,6 +194,16 @@ public:
     int activeThreads = 0;
     uint stackSize = 0;
     QThread::Priority threadPriority = QThread::InheritPriority;
+
+    // work-stealing mode: priority 0 tasks are spread over localQueues,
+    // everything else stays in queue
+    std::unique_ptr<QThreadPoolLocalQueue[]> localQueues;
+    uint localQueueCount = 0;
+    uint nextLocalQueue = 0;
+    uint nextHomeQueue = 0;
+    QAtomicInt localTaskCount;
+    QAtomicInt highPriorityPending; // bool
+    bool workStealing = false;
 };
 
 QT_END_NAMESPACE
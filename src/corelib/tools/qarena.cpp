@@ -0,0 +1,196 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qarena_p.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qhash.h>
+
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QScopedArena
+    \inmodule QtCore
+
+    \brief QScopedArena makes the Qt containers allocate from a monotonic
+    arena in the current thread.
+
+    While a QScopedArena object exists, QArrayData (and thus QList, QString
+    and QByteArray) allocates its memory from it instead of the heap,
+    whenever it is created, detached or grown in the thread that created the
+    arena. Arenas can be nested; the innermost one is used. Whether a block
+    belongs to an arena is recorded in the ArenaAllocated flag of its
+    header, so no container layout depends on arenas.
+
+    QHash keeps allocating its spans and entries on the heap: those are
+    freed by inline code, and have no header to carry the flag in.
+
+    The arena allocates large chunks from the heap and hands out their memory
+    by bumping a pointer, without ever reusing freed blocks. Releasing a block
+    only decrements the use count of its chunk; a chunk is returned to the
+    heap once the arena is gone and all the blocks allocated in it were
+    released. So, for request-scoped work that creates and destroys many short
+    containers, the heap sees only a handful of allocations, all freed in bulk
+    when the scope ends.
+
+    Data that escapes the scope stays valid: it keeps its chunk alive, and
+    it is released, detached and copied like any other data, from any thread.
+    The copies are allocated on the heap if no arena is active. However, one
+    escaping string pins a whole chunk, so long-lived data should be copied
+    out with a deep copy (for example, QString(s.constData(), s.size()))
+    before the scope ends.
+
+    Using an arena is opt-in on the allocator level: only containers compiled
+    against Qt 6.9 or later request memory from it. Allocations made by code
+    built against older headers, which frees its blocks inline, always come
+    from the heap.
+*/
+
+namespace {
+// Placed in front of each block, so release() can find the chunk.
+struct BlockHeader
+{
+    QScopedArena::Chunk *chunk;
+    qsizetype size;
+};
+}
+
+struct QScopedArena::Chunk
+{
+    // one reference for the arena plus one per live block
+    QAtomicInteger<qsizetype> ref;
+    Chunk *next;
+
+    char *begin() { return reinterpret_cast<char *>(this + 1); }
+};
+
+Q_CONSTINIT static thread_local QScopedArena *currentArena = nullptr;
+Q_CONSTINIT QBasicAtomicInt QScopedArena::liveArenas = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static inline void derefChunk(QScopedArena::Chunk *chunk) noexcept
+{
+    if (!chunk->ref.deref())
+        ::free(chunk);
+}
+
+/*!
+    Creates an arena that allocates from the heap in chunks of \a chunkSize
+    bytes and makes it current for this thread.
+*/
+QScopedArena::QScopedArena(qsizetype chunkSize) noexcept
+    : previous(std::exchange(currentArena, this)), chunkSize(chunkSize)
+{
+    Q_ASSERT(chunkSize > qsizetype(sizeof(Chunk) + sizeof(BlockHeader)));
+    liveArenas.ref();
+}
+
+/*!
+    Restores the previous arena, if any, and frees all chunks whose blocks
+    were all released. The remaining chunks are freed when their last block
+    is.
+*/
+QScopedArena::~QScopedArena()
+{
+    Q_ASSERT_X(currentArena == this, "QScopedArena", "Arenas must be destroyed in reverse order");
+    currentArena = previous;
+    liveArenas.deref();
+
+    for (Chunk *list : { head, full }) {
+        while (list)
+            derefChunk(std::exchange(list, list->next));
+    }
+}
+
+/*!
+    \fn QScopedArena *QScopedArena::current()
+
+    Returns the arena in use by the current thread, or \nullptr if there is
+    none. While no thread has an arena, this only reads a global counter,
+    so allocations don't pay for the thread-local lookup.
+*/
+QScopedArena *QScopedArena::currentInThread() noexcept
+{
+    return currentArena;
+}
+
+QScopedArena::Chunk *QScopedArena::newChunk(qsizetype size) noexcept
+{
+    auto chunk = static_cast<Chunk *>(::malloc(sizeof(Chunk) + size_t(size)));
+    if (chunk) {
+        chunk->ref.storeRelaxed(1);
+        chunk->next = nullptr;
+        ++chunks;
+        allocated += size;
+    }
+    return chunk;
+}
+
+/*!
+    Returns a block of \a size bytes aligned to \a alignment, or \nullptr if
+    the memory could not be allocated. The block must be freed with
+    release().
+*/
+void *QScopedArena::allocate(qsizetype size, qsizetype alignment) noexcept
+{
+    Q_ASSERT(size >= 0);
+    Q_ASSERT(alignment > 0 && !(alignment & (alignment - 1)));
+    alignment = qMax(alignment, qsizetype(alignof(BlockHeader)));
+
+    auto place = [&](char *from) {
+        quintptr p = quintptr(from) + sizeof(BlockHeader);
+        return reinterpret_cast<char *>((p + alignment - 1) & ~quintptr(alignment - 1));
+    };
+
+    char *block = place(cursor);
+    Chunk *chunk = head;
+    if (!cursor || size > end - block) {
+        const qsizetype needed = size + alignment + qsizetype(sizeof(BlockHeader));
+        if (needed > chunkSize / 4) {
+            // too big to share a chunk with other blocks
+            chunk = newChunk(needed);
+            if (!chunk)
+                return nullptr;
+            chunk->next = std::exchange(full, chunk);
+            block = place(chunk->begin());
+        } else {
+            chunk = newChunk(chunkSize);
+            if (!chunk)
+                return nullptr;
+            if (head)
+                head->next = std::exchange(full, head);
+            head = chunk;
+            end = chunk->begin() + chunkSize;
+            block = place(chunk->begin());
+            cursor = block + size;
+        }
+    } else {
+        cursor = block + size;
+    }
+
+    chunk->ref.ref();
+    new (block - sizeof(BlockHeader)) BlockHeader{ chunk, size };
+    return block;
+}
+
+/*!
+    Releases the block \a ptr, which was returned by allocate() on any arena.
+    This function is thread-safe.
+*/
+void QScopedArena::release(void *ptr) noexcept
+{
+    if (ptr)
+        derefChunk(reinterpret_cast<BlockHeader *>(static_cast<char *>(ptr) - sizeof(BlockHeader))->chunk);
+}
+
+/*!
+    Returns the size the block \a ptr was allocated with.
+*/
+qsizetype QScopedArena::usableSize(const void *ptr) noexcept
+{
+    return reinterpret_cast<const BlockHeader *>(static_cast<const char *>(ptr) - sizeof(BlockHeader))->size;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,64 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QARENA_P_H
+#define QARENA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qatomic.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QScopedArena
+{
+public:
+    enum : qsizetype { DefaultChunkSize = 64 * 1024 };
+
+    explicit QScopedArena(qsizetype chunkSize = DefaultChunkSize) noexcept;
+    ~QScopedArena();
+    Q_DISABLE_COPY_MOVE(QScopedArena)
+
+    static QScopedArena *current() noexcept
+    {
+        return liveArenas.loadRelaxed() ? currentInThread() : nullptr;
+    }
+
+    void *allocate(qsizetype size, qsizetype alignment) noexcept;
+    static void release(void *ptr) noexcept;
+    static qsizetype usableSize(const void *ptr) noexcept;
+
+    qsizetype chunkCount() const noexcept { return chunks; }
+    qsizetype bytesAllocated() const noexcept { return allocated; }
+
+    struct Chunk;
+
+private:
+    static QScopedArena *currentInThread() noexcept;
+    Chunk *newChunk(qsizetype size) noexcept;
+
+    static QBasicAtomicInt liveArenas;     // in all threads
+
+    Chunk *head = nullptr;      // the chunk we're allocating from
+    Chunk *full = nullptr;      // the ones we're done with
+    char *cursor = nullptr;
+    char *end = nullptr;
+    QScopedArena *previous;
+    qsizetype chunkSize;
+    qsizetype chunks = 0;
+    qsizetype allocated = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QARENA_P_H
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include <QtCore/qarraydata.h>
+#include <QtCore/private/qarena_p.h>
 #include <QtCore/private/qnumeric_p.h>
 #include <QtCore/private/qtools_p.h>
 #include <QtCore/qmath.h>
@@ -134,12 +135,21 @@ calculateBlockSize(qsizetype capacity, qsizetype objectSize, qsizetype headerSiz
     }
 }
 
-static QArrayData *allocateData(qsizetype allocSize)
+static QArrayData *allocateData(qsizetype allocSize, QArrayData::ArenaUse arenaUse)
 {
-    QArrayData *header = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
+    QArrayData *header;
+    QArrayData::ArrayOptions flags = {};
+    QScopedArena *arena = arenaUse == QArrayData::MayUseArena ? QScopedArena::current() : nullptr;
+    if (arena) {
+        header = static_cast<QArrayData *>(
+                    arena->allocate(allocSize, alignof(QtPrivate::AlignedQArrayData)));
+        flags = QArrayData::ArenaAllocated;
+    } else {
+        header = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
+    }
     if (header) {
         header->ref_.storeRelaxed(1);
-        header->flags = {};
+        header->flags = flags;
         header->alloc = 0;
     }
     return header;
@@ -155,7 +165,7 @@ using QtPrivate::AlignedQArrayData;
 
 static inline AllocationResult
 allocateHelper(qsizetype objectSize, qsizetype alignment, qsizetype capacity,
-               QArrayData::AllocationOption option) noexcept
+               QArrayData::AllocationOption option, QArrayData::ArenaUse arena) noexcept
 {
     if (capacity == 0)
         return {};
@@ -178,7 +188,7 @@ allocateHelper(qsizetype objectSize, qsizetype alignment, qsizetype capacity,
     if (Q_UNLIKELY(allocSize < 0))      // handle overflow. cannot allocate reliably
         return {};
 
-    QArrayData *header = allocateData(allocSize);
+    QArrayData *header = allocateData(allocSize, arena);
     void *data = nullptr;
     if (header) {
         // find where offset should point to so that data() is aligned to alignment bytes
@@ -191,40 +201,43 @@ allocateHelper(qsizetype objectSize, qsizetype alignment, qsizetype capacity,
 
 // Generic size and alignment allocation function
 void *QArrayData::allocate(QArrayData **dptr, qsizetype objectSize, qsizetype alignment,
-                           qsizetype capacity, AllocationOption option) noexcept
+                           qsizetype capacity, AllocationOption option, ArenaUse arena) noexcept
 {
     Q_ASSERT(dptr);
     // Alignment is a power of two
     Q_ASSERT(alignment >= qsizetype(alignof(QArrayData))
             && !(alignment & (alignment - 1)));
 
-    auto r = allocateHelper(objectSize, alignment, capacity, option);
+    auto r = allocateHelper(objectSize, alignment, capacity, option, arena);
     *dptr = r.header;
     return r.data;
 }
 
 // Fixed size and alignment allocation functions
-void *QArrayData::allocate1(QArrayData **dptr, qsizetype capacity, AllocationOption option) noexcept
+void *QArrayData::allocate1(QArrayData **dptr, qsizetype capacity, AllocationOption option,
+                            ArenaUse arena) noexcept
 {
     Q_ASSERT(dptr);
 
-    auto r = allocateHelper(1, alignof(AlignedQArrayData), capacity, option);
+    auto r = allocateHelper(1, alignof(AlignedQArrayData), capacity, option, arena);
     *dptr = r.header;
     return r.data;
 }
 
-void *QArrayData::allocate2(QArrayData **dptr, qsizetype capacity, AllocationOption option) noexcept
+void *QArrayData::allocate2(QArrayData **dptr, qsizetype capacity, AllocationOption option,
+                            ArenaUse arena) noexcept
 {
     Q_ASSERT(dptr);
 
-    auto r = allocateHelper(2, alignof(AlignedQArrayData), capacity, option);
+    auto r = allocateHelper(2, alignof(AlignedQArrayData), capacity, option, arena);
     *dptr = r.header;
     return r.data;
 }
 
 std::pair<QArrayData *, void *>
 QArrayData::reallocateUnaligned(QArrayData *data, void *dataPointer,
-                                qsizetype objectSize, qsizetype capacity, AllocationOption option) noexcept
+                                qsizetype objectSize, qsizetype capacity, AllocationOption option,
+                                ArenaUse arena) noexcept
 {
     Q_ASSERT(!data || !data->isShared());
 
@@ -241,7 +254,21 @@ QArrayData::reallocateUnaligned(QArrayData *data, void *dataPointer,
     Q_ASSERT(offset > 0);
     Q_ASSERT(offset <= allocSize); // equals when all free space is at the beginning
 
-    QArrayData *header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
+    QArrayData *header;
+    if (data && data->flags & ArenaAllocated) {
+        // arena blocks can't grow in place, so move to a new block from the
+        // current arena or, for callers that may free() it, from the heap
+        header = allocateData(allocSize, arena);
+        if (header) {
+            const ArrayOptions arenaFlag = header->flags;
+            memcpy(static_cast<void *>(header), data,
+                   size_t(qMin(allocSize, QScopedArena::usableSize(data))));
+            header->flags = (data->flags & ~ArrayOptions(ArenaAllocated)) | arenaFlag;
+            QScopedArena::release(data);
+        }
+    } else {
+        header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
+    }
     if (header) {
         header->alloc = capacity;
         dataPointer = reinterpret_cast<char *>(header) + offset;
@@ -260,7 +287,10 @@ void QArrayData::deallocate(QArrayData *data, qsizetype objectSize,
     Q_UNUSED(objectSize);
     Q_UNUSED(alignment);
 
-    ::free(data);
+    if (data && data->flags & ArenaAllocated)
+        QScopedArena::release(data);
+    else
+        ::free(data);
 }
 
 QT_END_NAMESPACE
@@ -35,7 +35,8 @@ struct QArrayData
 
    enum ArrayOption {
         ArrayOptionDefault = 0,
-        CapacityReserved     = 0x1  //!< the capacity was reserved by the user, try to keep it
+        CapacityReserved     = 0x1, //!< the capacity was reserved by the user, try to keep it
+        ArenaAllocated       = 0x2  //!< the block belongs to a QScopedArena
     };
     Q_DECLARE_FLAGS(ArrayOptions, ArrayOption)
 
@@ -86,18 +87,44 @@ struct QArrayData
         return newSize;
     }
 
+#if QT_CORE_REMOVED_SINCE(6, 9)
     Q_DECL_MALLOCLIKE
     static Q_CORE_EXPORT void *allocate(QArrayData **pdata, qsizetype objectSize, qsizetype alignment,
-            qsizetype capacity, AllocationOption option = QArrayData::KeepSize) noexcept;
+            qsizetype capacity, AllocationOption option) noexcept;
     Q_DECL_MALLOCLIKE
     static Q_CORE_EXPORT void *allocate1(QArrayData **pdata, qsizetype capacity,
-                                         AllocationOption option = QArrayData::KeepSize) noexcept;
+                                         AllocationOption option) noexcept;
     Q_DECL_MALLOCLIKE
     static Q_CORE_EXPORT void *allocate2(QArrayData **pdata, qsizetype capacity,
-                                         AllocationOption option = QArrayData::KeepSize) noexcept;
+                                         AllocationOption option) noexcept;
 
     [[nodiscard]] static Q_CORE_EXPORT std::pair<QArrayData *, void *> reallocateUnaligned(QArrayData *data, void *dataPointer,
             qsizetype objectSize, qsizetype newCapacity, AllocationOption option) noexcept;
+#endif
+
+    // Code compiled against older headers frees blocks with ::free(), so only
+    // callers that go through deallocate() may receive blocks from a QScopedArena
+    enum ArenaUse {
+        HeapOnly,
+        MayUseArena
+    };
+
+    Q_DECL_MALLOCLIKE
+    static Q_CORE_EXPORT void *allocate(QArrayData **pdata, qsizetype objectSize, qsizetype alignment,
+            qsizetype capacity, AllocationOption option = QArrayData::KeepSize,
+            ArenaUse arena = QArrayData::HeapOnly) noexcept;
+    Q_DECL_MALLOCLIKE
+    static Q_CORE_EXPORT void *allocate1(QArrayData **pdata, qsizetype capacity,
+                                         AllocationOption option = QArrayData::KeepSize,
+                                         ArenaUse arena = QArrayData::HeapOnly) noexcept;
+    Q_DECL_MALLOCLIKE
+    static Q_CORE_EXPORT void *allocate2(QArrayData **pdata, qsizetype capacity,
+                                         AllocationOption option = QArrayData::KeepSize,
+                                         ArenaUse arena = QArrayData::HeapOnly) noexcept;
+
+    [[nodiscard]] static Q_CORE_EXPORT std::pair<QArrayData *, void *> reallocateUnaligned(QArrayData *data, void *dataPointer,
+            qsizetype objectSize, qsizetype newCapacity, AllocationOption option,
+            ArenaUse arena = QArrayData::HeapOnly) noexcept;
     static Q_CORE_EXPORT void deallocate(QArrayData *data, qsizetype objectSize,
             qsizetype alignment) noexcept;
 };
@@ -133,12 +160,13 @@ struct QTypedArrayData
         void *result;
         if constexpr (sizeof(T) == 1) {
             // necessarily, alignof(T) == 1
-            result = allocate1(&d, capacity, option);
+            result = allocate1(&d, capacity, option, MayUseArena);
         } else if constexpr (sizeof(T) == 2) {
             // alignof(T) may be 1, but that makes no difference
-            result = allocate2(&d, capacity, option);
+            result = allocate2(&d, capacity, option, MayUseArena);
         } else {
-            result = QArrayData::allocate(&d, sizeof(T), alignof(AlignmentDummy), capacity, option);
+            result = QArrayData::allocate(&d, sizeof(T), alignof(AlignmentDummy), capacity, option,
+                                          MayUseArena);
         }
 #if __has_builtin(__builtin_assume_aligned)
         // and yet we do offer results that have stricter alignment
@@ -152,7 +180,8 @@ struct QTypedArrayData
     {
         static_assert(sizeof(QTypedArrayData) == sizeof(QArrayData));
         std::pair<QArrayData *, void *> pair =
-                QArrayData::reallocateUnaligned(data, dataPointer, sizeof(T), capacity, option);
+                QArrayData::reallocateUnaligned(data, dataPointer, sizeof(T), capacity, option,
+                                                MayUseArena);
         return {static_cast<QTypedArrayData *>(pair.first), static_cast<T *>(pair.second)};
     }
 
@@ -107,7 +107,7 @@ public:
     {
         if (!deref()) {
             (*this)->destroyAll();
-            free(d);
+            Data::deallocate(d);
         }
     }
 
@@ -486,7 +486,7 @@ public:
         dataPtr += (position == QArrayData::GrowsAtBeginning)
                 ? n + qMax(0, (header->alloc - from.size - n) / 2)
                 : from.freeSpaceAtBegin();
-        header->flags = from.flags();
+        header->flags |= from.flags() & ~typename Data::ArrayOptions(Data::ArenaAllocated);
         return QArrayDataPointer(header, dataPtr);
     }
 
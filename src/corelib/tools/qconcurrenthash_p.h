@@ -0,0 +1,279 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCONCURRENTHASH_P_H
+#define QCONCURRENTHASH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qepochreclaimer_p.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+
+QT_REQUIRE_CONFIG(thread);
+
+QT_BEGIN_NAMESPACE
+
+// QConcurrentHash is a hash table that can be read from and written to by
+// any number of threads at once. Lookups take no locks: they only enter a
+// QEpochReclaimer guard and follow atomic pointers. Writers lock one of
+// StripeCount mutexes, chosen by the key's hash, so writers of unrelated keys
+// rarely contend.
+//
+// The table is an array of buckets, each a singly linked list of immutable
+// nodes. Changing a value replaces its node, and nodes that are unlinked are
+// handed to QEpochReclaimer, so readers never see a node being modified or
+// freed. Growing the table locks all stripes and publishes a copy of it.
+// Unlinked nodes and tables are only retired once the stripe locks are
+// released, since retiring may run the deleters of earlier ones.
+//
+// Because values are copied out, T should be cheap to copy, like an
+// implicitly shared type or a QSharedPointer.
+template <typename Key, typename T>
+class QConcurrentHash
+{
+    struct Node
+    {
+        Node(size_t h, const Key &k, const T &v) : hash(h), key(k), value(v) {}
+        const size_t hash;
+        const Key key;
+        const T value;
+        QAtomicPointer<Node> next = nullptr;
+    };
+
+    struct Table
+    {
+        explicit Table(size_t n)
+            : numBuckets(n), buckets(new QAtomicPointer<Node>[n]) {}
+        ~Table()
+        {
+            for (size_t i = 0; i < numBuckets; ++i) {
+                Node *n = buckets[i].loadRelaxed();
+                while (n)
+                    delete std::exchange(n, n->next.loadRelaxed());
+            }
+        }
+        QAtomicPointer<Node> &bucket(size_t hash) const noexcept
+        { return buckets[hash & (numBuckets - 1)]; }
+
+        const size_t numBuckets;
+        const std::unique_ptr<QAtomicPointer<Node>[]> buckets;
+    };
+
+public:
+    static constexpr size_t StripeCount = 64;
+
+    QConcurrentHash() : QConcurrentHash(0) {}
+    explicit QConcurrentHash(qsizetype reserve)
+        : table(new Table(bucketsFor(size_t(reserve)))), seed(QHashSeed::globalSeed())
+    {}
+    ~QConcurrentHash()
+    {
+        // no one may be using us anymore
+        delete table.loadRelaxed();
+    }
+    Q_DISABLE_COPY_MOVE(QConcurrentHash)
+
+    qsizetype size() const noexcept { return count.loadRelaxed(); }
+    bool isEmpty() const noexcept { return size() == 0; }
+
+    bool contains(const Key &key) const
+    {
+        QEpochReclaimer::Guard guard;
+        return findNode(key);
+    }
+
+    T value(const Key &key, const T &defaultValue = T()) const
+    {
+        QEpochReclaimer::Guard guard;
+        const Node *n = findNode(key);
+        return n ? n->value : defaultValue;
+    }
+
+    std::optional<T> find(const Key &key) const
+    {
+        QEpochReclaimer::Guard guard;
+        if (const Node *n = findNode(key))
+            return n->value;
+        return std::nullopt;
+    }
+
+    // Returns true if the key was new.
+    bool insert(const Key &key, const T &value)
+    {
+        return update(key, value, true);
+    }
+
+    // Inserts the value only if the key isn't in the hash yet. Returns true
+    // if it was inserted.
+    bool tryInsert(const Key &key, const T &value)
+    {
+        return update(key, value, false);
+    }
+
+    bool remove(const Key &key)
+    {
+        const size_t h = hash(key);
+        Node *removed = nullptr;
+        {
+            QMutexLocker locker(&stripes[h % StripeCount]);
+            QAtomicPointer<Node> *link = &table.loadRelaxed()->bucket(h);
+            for (Node *n = link->loadRelaxed(); n; link = &n->next, n = link->loadRelaxed()) {
+                if (n->hash == h && n->key == key) {
+                    link->storeRelease(n->next.loadRelaxed());
+                    count.fetchAndSubRelaxed(1);
+                    removed = n;
+                    break;
+                }
+            }
+        }
+        if (!removed)
+            return false;
+        QEpochReclaimer::retire(removed);
+        return true;
+    }
+
+    void clear()
+    {
+        Table *old;
+        {
+            const LockAll lock(this);
+            old = table.loadRelaxed();
+            table.storeRelease(new Table(bucketsFor(0)));
+            count.storeRelaxed(0);
+        }
+        QEpochReclaimer::retire(old);
+    }
+
+    void reserve(qsizetype size)
+    {
+        const size_t n = bucketsFor(size_t(size));
+        if (n > table.loadRelaxed()->numBuckets)
+            rehash(n);
+    }
+
+private:
+    struct LockAll
+    {
+        explicit LockAll(QConcurrentHash *h) : d(h)
+        {
+            for (QBasicMutex &m : d->stripes)
+                m.lock();
+        }
+        ~LockAll()
+        {
+            for (QBasicMutex &m : d->stripes)
+                m.unlock();
+        }
+        QConcurrentHash *d;
+    };
+
+    static size_t bucketsFor(size_t size) noexcept
+    {
+        // one bucket per element, and no fewer buckets than stripes so each
+        // bucket is always protected by the same stripe
+        return qMax(QHashPrivate::GrowthPolicy::bucketsForCapacity(size), StripeCount);
+    }
+
+    size_t hash(const Key &key) const
+    {
+        return QHashPrivate::calculateHash(key, seed);
+    }
+
+    const Node *findNode(const Key &key) const
+    {
+        const size_t h = hash(key);
+        const Table *t = table.loadAcquire();
+        for (const Node *n = t->bucket(h).loadAcquire(); n; n = n->next.loadAcquire()) {
+            if (n->hash == h && n->key == key)
+                return n;
+        }
+        return nullptr;
+    }
+
+    bool update(const Key &key, const T &value, bool replace)
+    {
+        const size_t h = hash(key);
+        size_t numBuckets;
+        Node *replaced = nullptr;
+        {
+            QMutexLocker locker(&stripes[h % StripeCount]);
+            Table *t = table.loadRelaxed();
+            QAtomicPointer<Node> &bucket = t->bucket(h);
+            QAtomicPointer<Node> *link = &bucket;
+            for (Node *n = link->loadRelaxed(); n; link = &n->next, n = link->loadRelaxed()) {
+                if (n->hash == h && n->key == key) {
+                    if (!replace)
+                        return false;
+                    Node *node = new Node(h, key, value);
+                    node->next.storeRelaxed(n->next.loadRelaxed());
+                    link->storeRelease(node);
+                    replaced = n;
+                    break;
+                }
+            }
+            if (replaced) {
+                locker.unlock();
+                QEpochReclaimer::retire(replaced);
+                return false;
+            }
+
+            Node *node = new Node(h, key, value);
+            node->next.storeRelaxed(bucket.loadRelaxed());
+            bucket.storeRelease(node);
+            numBuckets = t->numBuckets;
+        }
+
+        if (size_t(count.fetchAndAddRelaxed(1)) + 1 > numBuckets)
+            rehash(numBuckets * 2);
+        return true;
+    }
+
+    void rehash(size_t numBuckets)
+    {
+        Table *old;
+        {
+            const LockAll lock(this);
+            old = table.loadRelaxed();
+            if (old->numBuckets >= numBuckets)
+                return;     // someone else did it
+
+            // readers may be walking the old lists, so copy the nodes instead
+            // of relinking them
+            auto t = std::make_unique<Table>(numBuckets);
+            for (size_t i = 0; i < old->numBuckets; ++i) {
+                for (Node *n = old->buckets[i].loadRelaxed(); n; n = n->next.loadRelaxed()) {
+                    QAtomicPointer<Node> &bucket = t->bucket(n->hash);
+                    Node *node = new Node(n->hash, n->key, n->value);
+                    node->next.storeRelaxed(bucket.loadRelaxed());
+                    bucket.storeRelaxed(node);
+                }
+            }
+            table.storeRelease(t.release());
+        }
+        QEpochReclaimer::retire(old);
+    }
+
+    QAtomicPointer<Table> table;
+    QAtomicInteger<qsizetype> count = 0;
+    const size_t seed;
+    std::array<QBasicMutex, StripeCount> stripes = {};
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTHASH_P_H
@@ -36,7 +36,9 @@ static_assert(sizeof(QHttp1Configuration) == sizeof(void*),
     Default constructs a QHttp1Configuration object.
 */
 QHttp1Configuration::QHttp1Configuration()
-    : u(ShortData{6, {}}) // QHttpNetworkConnectionPrivate::defaultHttpChannelCount
+    : u(ShortData{6,    // QHttpNetworkConnectionPrivate::defaultHttpChannelCount
+                  3,    // QHttpNetworkConnectionPrivate::defaultPipelineLength
+                  {}})
 {
 }
 
@@ -105,6 +107,44 @@ qsizetype QHttp1Configuration::numberOfConnectionsPerHost() const
     return u.data.numConnectionsPerHost;
 }
 
+/*!
+    \since 6.9
+
+    Sets the maximum number of requests that are sent on a connection ahead
+    of the reply currently being received to \a depth (maximum: 255). A
+    \a depth of 0 disables HTTP pipelining. If \a depth is < 0, does nothing.
+
+    Only requests that allow pipelining, see
+    QNetworkRequest::HttpPipeliningAllowedAttribute, are pipelined. The
+    connection starts out pipelining \a depth requests, uses a shorter
+    pipeline if the server closes connections that had requests pipelined,
+    and goes back to \a depth while the server answers pipelined requests.
+    If the server broke so many pipelines that the connection stopped
+    pipelining altogether, it tries again after some replies were received
+    without it.
+
+    \sa maximumPipelineDepth
+*/
+void QHttp1Configuration::setMaximumPipelineDepth(qsizetype depth)
+{
+    if (depth < 0)
+        return;
+    u.data.maxPipelineDepth = qt_saturate<std::uint8_t>(depth);
+}
+
+/*!
+    \since 6.9
+
+    Returns the maximum number of requests that are pipelined on a
+    connection. The default is three (3).
+
+    \sa setMaximumPipelineDepth
+*/
+qsizetype QHttp1Configuration::maximumPipelineDepth() const
+{
+    return u.data.maxPipelineDepth;
+}
+
 /*!
     \fn void QHttp1Configuration::swap(QHttp1Configuration &other)
 
@@ -140,7 +180,8 @@ qsizetype QHttp1Configuration::numberOfConnectionsPerHost() const
 */
 bool QHttp1Configuration::equals(const QHttp1Configuration &other) const noexcept
 {
-    return u.data.numConnectionsPerHost == other.u.data.numConnectionsPerHost;
+    return u.data.numConnectionsPerHost == other.u.data.numConnectionsPerHost
+        && u.data.maxPipelineDepth == other.u.data.maxPipelineDepth;
 }
 
 /*!
@@ -148,7 +189,7 @@ bool QHttp1Configuration::equals(const QHttp1Configuration &other) const noexcep
 */
 size_t QHttp1Configuration::hash(size_t seed) const noexcept
 {
-    return qHash(u.data.numConnectionsPerHost, seed);
+    return qHashMulti(seed, u.data.numConnectionsPerHost, u.data.maxPipelineDepth);
 }
 
 QT_END_NAMESPACE
@@ -30,13 +30,17 @@ public:
     Q_NETWORK_EXPORT void setNumberOfConnectionsPerHost(qsizetype amount);
     Q_NETWORK_EXPORT qsizetype numberOfConnectionsPerHost() const;
 
+    Q_NETWORK_EXPORT void setMaximumPipelineDepth(qsizetype depth);
+    Q_NETWORK_EXPORT qsizetype maximumPipelineDepth() const;
+
     void swap(QHttp1Configuration &other) noexcept
     { std::swap(u, other.u); }
 
 private:
     struct ShortData {
         std::uint8_t numConnectionsPerHost;
-        char reserved[sizeof(void*) - sizeof(numConnectionsPerHost)];
+        std::uint8_t maxPipelineDepth;
+        char reserved[sizeof(void*) - sizeof(numConnectionsPerHost) - sizeof(maxPipelineDepth)];
     };
     union U {
         U(ShortData _data) : data(_data) {}
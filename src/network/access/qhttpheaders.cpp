@@ -4,6 +4,7 @@
 #include "qhttpheaders.h"
 
 #include <private/qoffsetstringarray_p.h>
+#include <private/qstringatom_p.h>
 
 #include <QtCore/qcompare.h>
 #include <QtCore/qhash.h>
@@ -704,7 +705,7 @@ struct HeaderName
         if (auto h = HeaderName::toWellKnownHeader(nname))
             data = *h;
         else
-            data = std::move(nname);
+            data = QByteArrayAtom(nname);
     }
 
     // Returns an enum corresponding with the 'name' if possible. Uses binary search (O(logN)).
@@ -725,8 +726,8 @@ struct HeaderName
     {
         return std::visit([](const auto &arg) -> QByteArrayView {
             using T = decltype(arg);
-            if constexpr (std::is_same_v<T, const QByteArray &>)
-                return arg;
+            if constexpr (std::is_same_v<T, const QByteArrayAtom &>)
+                return arg.view();
             else if constexpr (std::is_same_v<T, const QHttpHeaders::WellKnownHeader &>)
                 return headerNames.viewAt(qToUnderlying(arg));
             else
@@ -738,8 +739,8 @@ struct HeaderName
     {
         return std::visit([](const auto &arg) -> QByteArray {
             using T = decltype(arg);
-            if constexpr (std::is_same_v<T, const QByteArray &>) {
-                return arg;
+            if constexpr (std::is_same_v<T, const QByteArrayAtom &>) {
+                return arg.string();
             } else if constexpr (std::is_same_v<T, const QHttpHeaders::WellKnownHeader &>) {
                 const auto view = headerNames.viewAt(qToUnderlying(arg));
                 return QByteArray::fromRawData(view.constData(), view.size());
@@ -750,8 +751,9 @@ struct HeaderName
     }
 
 private:
-    // Store the data as 'enum' whenever possible; more performant, and comparison relies on that
-    std::variant<QHttpHeaders::WellKnownHeader, QByteArray> data;
+    // Store the data as 'enum' whenever possible; more performant, and comparison relies on that.
+    // Other names are interned, so they are shared between all headers and compare by pointer.
+    std::variant<QHttpHeaders::WellKnownHeader, QByteArrayAtom> data;
 
     friend bool comparesEqual(const HeaderName &lhs, const HeaderName &rhs) noexcept
     {
@@ -21,6 +21,8 @@
 #include <qspan.h>
 #include <qvarlengtharray.h>
 
+#include <algorithm>
+
 #ifndef QT_NO_SSL
 #    include <private/qsslsocket_p.h>
 #    include <QtNetwork/qsslkey.h>
@@ -772,7 +774,12 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QIODevice *socket)
     if (channels[i].reply == nullptr)
         return;
 
-    if (! (defaultPipelineLength - channels[i].alreadyPipelinedRequests.size() >= defaultRePipelineLength)) {
+    // pipelining has been turned off, or the server made us give up on it
+    if (pipelineDepth <= 0)
+        return;
+
+    if (! (pipelineDepth - channels[i].alreadyPipelinedRequests.size()
+           >= qMin(defaultRePipelineLength, pipelineDepth))) {
         return;
     }
 
@@ -811,12 +818,16 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QIODevice *socket)
            || channels[i].state == QHttpNetworkConnectionChannel::ReadingState))
         return;
 
+    // don't queue requests behind a reply that will keep the channel busy
+    if (isHeadOfLineBlocking(channels[i]))
+        return;
+
     int lengthBefore;
     while (!highPriorityQueue.isEmpty()) {
         lengthBefore = channels[i].alreadyPipelinedRequests.size();
         fillPipeline(highPriorityQueue, channels[i]);
 
-        if (channels[i].alreadyPipelinedRequests.size() >= defaultPipelineLength) {
+        if (channels[i].alreadyPipelinedRequests.size() >= pipelineDepth) {
             channels[i].pipelineFlush();
             return;
         }
@@ -829,7 +840,7 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QIODevice *socket)
         lengthBefore = channels[i].alreadyPipelinedRequests.size();
         fillPipeline(lowPriorityQueue, channels[i]);
 
-        if (channels[i].alreadyPipelinedRequests.size() >= defaultPipelineLength) {
+        if (channels[i].alreadyPipelinedRequests.size() >= pipelineDepth) {
             channels[i].pipelineFlush();
             return;
         }
@@ -842,6 +853,54 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QIODevice *socket)
     channels[i].pipelineFlush();
 }
 
+// Requests pipelined behind a reply are only answered after it, so don't
+// pipeline behind a reply with a large or unknown amount of data still to come.
+// The requests will wait for another channel instead.
+bool QHttpNetworkConnectionPrivate::isHeadOfLineBlocking(const QHttpNetworkConnectionChannel &channel) const
+{
+    // limit of how much data we let the pipelined requests wait for
+    static constexpr qint64 MaxBlockingBodySize = 64 * 1024;
+
+    const QHttpNetworkReply *reply = channel.reply;
+    if (!reply)
+        return false;
+    const QHttpNetworkReplyPrivate *replyPrivate = reply->d_func();
+    if (replyPrivate->state < QHttpNetworkReplyPrivate::ReadingDataState)
+        return false; // we know nothing about the body yet
+    if (replyPrivate->chunkedTransferEncoding || replyPrivate->bodyLength < 0)
+        return true;
+    return replyPrivate->bodyLength - replyPrivate->contentRead > MaxBlockingBodySize;
+}
+
+// called when a reply that had been pipelined was received completely
+void QHttpNetworkConnectionPrivate::pipelinedReplyFinished()
+{
+    const int maximumDepth = int(http1Parameters.maximumPipelineDepth());
+    if (pipelineDepth > 0 && pipelineDepth < maximumDepth)
+        ++pipelineDepth;
+}
+
+// called when a reply was received completely on a channel that supports
+// pipelining, but without it
+void QHttpNetworkConnectionPrivate::unpipelinedReplyFinished()
+{
+    if (pipelineDepth == 0 && pipelineRecoveryCountdown > 0 && --pipelineRecoveryCountdown == 0)
+        pipelineDepth = 1;  // give the server another chance
+}
+
+// called when a channel had to requeue its pipelined requests because the
+// server closed the connection or the transfer failed
+void QHttpNetworkConnectionPrivate::pipelineBroken()
+{
+    // once this reaches 0 we stop pipelining to this server for a while
+    pipelineDepth /= 2;
+    if (pipelineDepth == 0 && http1Parameters.maximumPipelineDepth() > 0) {
+        pipelineRecoveryCountdown = pipelineRecoveryInterval;
+        pipelineRecoveryInterval = qMin(2 * pipelineRecoveryInterval,
+                                        maximumPipelineRecoveryInterval);
+    }
+}
+
 // returns true when the processing of a queue has been done
 bool QHttpNetworkConnectionPrivate::fillPipeline(QList<HttpMessagePair> &queue, QHttpNetworkConnectionChannel &channel)
 {
@@ -1117,13 +1176,22 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
     // return fast if there is nothing to pipeline
     if (highPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty())
         return;
+    // fill the shortest pipelines first so the requests are spread over the
+    // connected channels instead of queueing up behind the first one
+    QVarLengthArray<int> channelsToFill;
     for (int i = 0; i < activeChannelCount; i++) {
         if (channels[i].socket
             && QSocketAbstraction::socketState(channels[i].socket)
                     == QAbstractSocket::ConnectedState) {
-            fillPipeline(channels[i].socket);
+            channelsToFill.push_back(i);
         }
     }
+    std::stable_sort(channelsToFill.begin(), channelsToFill.end(), [this](int a, int b) {
+        return channels[a].alreadyPipelinedRequests.size()
+                < channels[b].alreadyPipelinedRequests.size();
+    });
+    for (int i : std::as_const(channelsToFill))
+        fillPipeline(channels[i].socket);
 
     // If there is not already any connected channels we need to connect a new one.
     // We do not pair the channel with the request until we know if it is
@@ -1454,6 +1522,19 @@ void QHttpNetworkConnection::setConnectionType(ConnectionType type)
     d->connectionType = type;
 }
 
+QHttp1Configuration QHttpNetworkConnection::http1Parameters() const
+{
+    Q_D(const QHttpNetworkConnection);
+    return d->http1Parameters;
+}
+
+void QHttpNetworkConnection::setHttp1Parameters(const QHttp1Configuration &params)
+{
+    Q_D(QHttpNetworkConnection);
+    d->http1Parameters = params;
+    d->pipelineDepth = int(params.maximumPipelineDepth());
+}
+
 QHttp2Configuration QHttpNetworkConnection::http2Parameters() const
 {
     Q_D(const QHttpNetworkConnection);
@@ -20,6 +20,7 @@
 #include <QtNetwork/qnetworkreply.h>
 #include <QtNetwork/qabstractsocket.h>
 
+#include <qhttp1configuration.h>
 #include <qhttp2configuration.h>
 
 #include <private/qobject_p.h>
@@ -93,6 +94,8 @@ public:
     ConnectionType connectionType() const;
     void setConnectionType(ConnectionType type);
 
+    QHttp1Configuration http1Parameters() const;
+    void setHttp1Parameters(const QHttp1Configuration &params);
     QHttp2Configuration http2Parameters() const;
     void setHttp2Parameters(const QHttp2Configuration &params);
 
@@ -181,6 +184,10 @@ public:
 
     void fillPipeline(QIODevice *socket);
     bool fillPipeline(QList<HttpMessagePair> &queue, QHttpNetworkConnectionChannel &channel);
+    bool isHeadOfLineBlocking(const QHttpNetworkConnectionChannel &channel) const;
+    void pipelinedReplyFinished();
+    void unpipelinedReplyFinished();
+    void pipelineBroken();
 
     // read more HTTP body after the next event loop spin
     void readMoreLater(QHttpNetworkReply *reply);
@@ -249,8 +256,22 @@ public:
     std::shared_ptr<QSslContext> sslContext;
 #endif
 
+    QHttp1Configuration http1Parameters;
     QHttp2Configuration http2Parameters;
 
+    // How many requests we currently pipeline on a channel. Starts at the
+    // configured maximum, halves whenever the server breaks a pipeline and
+    // grows back by one for every pipelined reply it answers.
+    int pipelineDepth = defaultPipelineLength;
+    // Once the depth has dropped to 0, pipelining is tried again with a depth
+    // of 1 after this many replies were received without it. The interval
+    // doubles every time, so a server that keeps breaking pipelines is only
+    // probed rarely.
+    int pipelineRecoveryCountdown = 0;
+    int pipelineRecoveryInterval = initialPipelineRecoveryInterval;
+    static constexpr int initialPipelineRecoveryInterval = 16;
+    static constexpr int maximumPipelineRecoveryInterval = 1024;
+
     QString peerVerifyName;
     // If network status monitoring is enabled, we activate connectionMonitor
     // as soons as one of channels managed to connect to host (and we
@@ -267,7 +267,7 @@ void QHttpNetworkConnectionChannel::handleUnexpectedEOF()
     Q_ASSERT(reply);
     if (reconnectAttempts <= 0) {
         // too many errors reading/receiving/parsing the status, close the socket and emit error
-        requeueCurrentlyPipelinedRequests();
+        requeueBrokenPipeline();
         close();
         reply->d_func()->errorString = connection->d_func()->errorDetail(QNetworkReply::RemoteHostClosedError, socket);
         emit reply->finishedWithError(QNetworkReply::RemoteHostClosedError, reply->d_func()->errorString);
@@ -499,6 +499,12 @@ void QHttpNetworkConnectionChannel::allDone()
     bool emitFinished = reply->d_func()->shouldEmitSignals();
     bool connectionCloseEnabled = reply->d_func()->isConnectionCloseEnabled();
     detectPipeliningSupport();
+    if (pipeliningSupported == QHttpNetworkConnectionChannel::PipeliningProbablySupported) {
+        if (reply->isPipeliningUsed())
+            connection->d_func()->pipelinedReplyFinished();
+        else
+            connection->d_func()->unpipelinedReplyFinished();
+    }
 
     handleStatus();
     // handleStatus() might have removed the reply because it already called connection->emitReplyError()
@@ -533,7 +539,7 @@ void QHttpNetworkConnectionChannel::allDone()
     if (!alreadyPipelinedRequests.isEmpty()) {
         if (resendCurrent || connectionCloseEnabled || QSocketAbstraction::socketState(socket) != QAbstractSocket::ConnectedState) {
             // move the pipelined ones back to the main queue
-            requeueCurrentlyPipelinedRequests();
+            requeueBrokenPipeline();
             close();
         } else {
             // there were requests pipelined in and we can continue
@@ -610,6 +616,15 @@ void QHttpNetworkConnectionChannel::requeueCurrentlyPipelinedRequests()
         QMetaObject::invokeMethod(connection, "_q_startNextRequest", Qt::QueuedConnection);
 }
 
+// called when the server closed the connection or the transfer failed while
+// requests were pipelined, so we pipeline less from now on
+void QHttpNetworkConnectionChannel::requeueBrokenPipeline()
+{
+    if (!alreadyPipelinedRequests.isEmpty())
+        connection->d_func()->pipelineBroken();
+    requeueCurrentlyPipelinedRequests();
+}
+
 void QHttpNetworkConnectionChannel::handleStatus()
 {
     Q_ASSERT(socket);
@@ -784,7 +799,7 @@ void QHttpNetworkConnectionChannel::pipelineFlush()
 
 void QHttpNetworkConnectionChannel::closeAndResendCurrentRequest()
 {
-    requeueCurrentlyPipelinedRequests();
+    requeueBrokenPipeline();
     close();
     if (reply)
         resendCurrent = true;
@@ -794,7 +809,7 @@ void QHttpNetworkConnectionChannel::closeAndResendCurrentRequest()
 
 void QHttpNetworkConnectionChannel::resendCurrentRequest()
 {
-    requeueCurrentlyPipelinedRequests();
+    requeueBrokenPipeline();
     if (reply)
         resendCurrent = true;
     if (qobject_cast<QHttpNetworkConnection*>(connection))
@@ -858,7 +873,7 @@ void QHttpNetworkConnectionChannel::_q_disconnected()
     if (alreadyPipelinedRequests.size()) {
         // If nothing was in a pipeline, no need in calling
         // _q_startNextRequest (which it does):
-        requeueCurrentlyPipelinedRequests();
+        requeueBrokenPipeline();
     }
 
     pendingEncrypt = false;
@@ -1121,7 +1136,7 @@ void QHttpNetworkConnectionChannel::_q_error(QAbstractSocket::SocketError socket
         // First requeue the already pipelined requests for the current failed reply,
         // then dequeue pending requests so we can also mark them as finished with error
         if (reply)
-            requeueCurrentlyPipelinedRequests();
+            requeueBrokenPipeline();
         else
             connection->d_func()->dequeueRequest(socket);
 
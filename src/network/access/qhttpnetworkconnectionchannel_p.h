@@ -119,6 +119,7 @@ public:
     void pipelineInto(HttpMessagePair &pair);
     void pipelineFlush();
     void requeueCurrentlyPipelinedRequests();
+    void requeueBrokenPipeline();
     void detectPipeliningSupport();
 
     QHttpNetworkConnectionChannel();
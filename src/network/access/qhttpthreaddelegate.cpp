@@ -321,6 +321,7 @@ void QHttpThreadDelegate::startRequest()
         httpConnection = new QNetworkAccessCachedHttpConnection(
                 http1Parameters.numberOfConnectionsPerHost(), host, urlCopy.port(), ssl,
                 isLocalSocket, connectionType);
+        httpConnection->setHttp1Parameters(http1Parameters);
         if (connectionType == QHttpNetworkConnection::ConnectionTypeHTTP2
             || connectionType == QHttpNetworkConnection::ConnectionTypeHTTP2Direct) {
             httpConnection->setHttp2Parameters(http2Parameters);
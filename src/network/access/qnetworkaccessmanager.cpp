@@ -46,6 +46,7 @@
 
 #include "QtCore/qapplicationstatic.h"
 #include "QtCore/qloggingcategory.h"
+#include "QtCore/qmutex.h"
 #include <QtCore/private/qfactoryloader_p.h>
 
 #if defined(Q_OS_MACOS)
@@ -82,6 +83,20 @@ Q_GLOBAL_STATIC(QNetworkAccessDebugPipeBackendFactory, debugpipeBackend)
 
 Q_APPLICATION_STATIC(QFactoryLoader, qnabfLoader, QNetworkAccessBackendFactory_iid, "/networkaccess"_L1)
 
+namespace {
+// The HTTP thread of all managers that use the shared connection pool.
+// QHttpThreadDelegate caches its connections per thread, so the managers
+// using this thread also use the same connections.
+struct SharedHttpThread
+{
+    QMutex mutex;
+    QThread *thread = nullptr;
+    int users = 0;
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(SharedHttpThread, sharedHttpThread)
+
 #if defined(Q_OS_MACOS)
 bool getProxyAuth(const QString& proxyHostname, const QString &scheme, QString& username, QString& password)
 {
@@ -1470,6 +1485,56 @@ void QNetworkAccessManager::setAutoDeleteReplies(bool shouldAutoDelete)
     d_func()->autoDeleteReplies = shouldAutoDelete;
 }
 
+/*!
+    \since 6.9
+
+    Returns \c true if this QNetworkAccessManager shares its HTTP connections
+    with other QNetworkAccessManager objects; otherwise returns \c false. The
+    default is \c false.
+
+    \sa setSharedConnectionPoolEnabled()
+*/
+bool QNetworkAccessManager::isSharedConnectionPoolEnabled() const
+{
+    return d_func()->sharedConnectionPool;
+}
+
+/*!
+    \since 6.9
+
+    Enables or disables the use of a process-wide pool of HTTP connections.
+
+    By default, each QNetworkAccessManager opens its own connections to the
+    servers it talks to. If \a enabled is \c true, this manager uses
+    connections from a pool shared by all QNetworkAccessManager objects
+    that have this enabled, in any thread. An application that creates one
+    manager per thread then needs only as many connections, and TLS
+    handshakes, as a single manager would.
+
+    Connections are reused in the same way as within one manager: HTTP/2
+    connections are shared by all requests to the same host, the number of
+    HTTP/1 connections per host is limited by
+    QHttp1Configuration::numberOfConnectionsPerHost(), and idle connections
+    are closed after the time set by
+    QNetworkRequest::ConnectionCacheExpiryTimeoutSecondsAttribute.
+
+    \note Managers sharing connections also share the HTTP authentication
+    state of those connections, so only enable this for managers that may
+    use each other's credentials.
+
+    \note This setting takes effect when the manager sends its first
+    request, or its first request after clearConnectionCache(). Clearing
+    the connection cache of a manager using the shared pool only stops this
+    manager from using the pool's connections; they are closed once no
+    manager uses the pool anymore.
+
+    \sa isSharedConnectionPoolEnabled()
+*/
+void QNetworkAccessManager::setSharedConnectionPoolEnabled(bool enabled)
+{
+    d_func()->sharedConnectionPool = enabled;
+}
+
 /*!
     \fn int QNetworkAccessManager::transferTimeout() const
     \since 5.15
@@ -1728,7 +1793,18 @@ QNetworkAccessManagerPrivate::~QNetworkAccessManagerPrivate()
 
 QThread * QNetworkAccessManagerPrivate::createThread()
 {
-    if (!thread) {
+    if (!thread && sharedConnectionPool) {
+        SharedHttpThread *shared = sharedHttpThread();
+        QMutexLocker locker(&shared->mutex);
+        if (!shared->thread) {
+            shared->thread = new QThread;
+            shared->thread->setObjectName(QStringLiteral("QNetworkAccessManager shared thread"));
+            shared->thread->start();
+        }
+        ++shared->users;
+        thread = shared->thread;
+        threadIsShared = true;
+    } else if (!thread) {
         thread = new QThread;
         thread->setObjectName(QStringLiteral("QNetworkAccessManager thread"));
         thread->start();
@@ -1739,15 +1815,28 @@ QThread * QNetworkAccessManagerPrivate::createThread()
 
 void QNetworkAccessManagerPrivate::destroyThread()
 {
-    if (thread) {
-        thread->quit();
-        thread->wait(QDeadlineTimer(5000));
-        if (thread->isFinished())
-            delete thread;
-        else
-            QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
-        thread = nullptr;
+    if (!thread)
+        return;
+
+    if (std::exchange(threadIsShared, false)) {
+        SharedHttpThread *shared = sharedHttpThread();
+        QMutexLocker locker(&shared->mutex);
+        Q_ASSERT(shared->thread == thread);
+        if (--shared->users > 0) {
+            // other managers still use it
+            thread = nullptr;
+            return;
+        }
+        shared->thread = nullptr;
     }
+
+    thread->quit();
+    thread->wait(QDeadlineTimer(5000));
+    if (thread->isFinished())
+        delete thread;
+    else
+        QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
+    thread = nullptr;
 }
 
 
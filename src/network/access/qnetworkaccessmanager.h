@@ -121,6 +121,9 @@ public:
     bool autoDeleteReplies() const;
     void setAutoDeleteReplies(bool autoDelete);
 
+    bool isSharedConnectionPoolEnabled() const;
+    void setSharedConnectionPoolEnabled(bool enabled);
+
     QT_NETWORK_INLINE_SINCE(6, 8)
     int transferTimeout() const;
     QT_NETWORK_INLINE_SINCE(6, 8)
@@ -130,6 +130,8 @@ public:
     bool stsEnabled = false;
 
     bool autoDeleteReplies = false;
+    bool sharedConnectionPool = false;
+    bool threadIsShared = false;  // thread is the shared HTTP thread
 
     std::chrono::milliseconds transferTimeout{0};
 
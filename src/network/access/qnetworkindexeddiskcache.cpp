@@ -0,0 +1,811 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qnetworkindexeddiskcache.h"
+#include "qnetworkindexeddiskcache_p.h"
+
+#include <qdatastream.h>
+#include <qdir.h>
+#include <qendian.h>
+#include <qloggingcategory.h>
+#include <qrandom.h>
+#include <qsavefile.h>
+#include <qurl.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+Q_STATIC_LOGGING_CATEGORY(lcIndexedDiskCache, "qt.network.access.indexeddiskcache")
+
+/*!
+    \class QNetworkIndexedDiskCache
+    \since 6.9
+    \inmodule QtNetwork
+
+    \brief The QNetworkIndexedDiskCache class provides a disk cache that
+    stores all entries in a single file.
+
+    QNetworkIndexedDiskCache is a drop-in alternative to QNetworkDiskCache
+    for caches with many entries. Instead of one file per URL, it appends
+    all entries to a single segment file in the cacheDirectory() and keeps
+    an index of them in memory. Looking up an entry does not touch the
+    file system, and the entry's data is read through a memory mapping of
+    the segment file.
+
+    The index is written to disk by flush(), when the cache is destroyed and
+    after compaction, so opening a large cache only reads the index and the
+    entries added since it was written. If the application crashed, the
+    entries are recovered from the segment file, and an entry that was
+    being written when it happened is discarded.
+
+    When cacheSize() exceeds maximumCacheSize(), the least recently used
+    entries are evicted until the cache is below 90% of the maximum.
+    Replaced, removed and evicted entries stay in the segment file until it
+    is compacted, which happens automatically once they take up more space
+    than the cache itself, or when compact() is called. Compaction writes a
+    new segment file and atomically replaces the old one.
+
+    Only one QNetworkIndexedDiskCache may use a cache directory at a time.
+    As the data of an entry is kept in memory until it is inserted, the
+    cache is best suited to many small to medium-sized entries.
+
+    A cache is set up in the same way as a QNetworkDiskCache:
+
+    \code
+    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
+    QNetworkIndexedDiskCache *diskCache = new QNetworkIndexedDiskCache(this);
+    diskCache->setCacheDirectory("cacheDir");
+    manager->setCache(diskCache);
+    \endcode
+
+    \sa QNetworkDiskCache
+*/
+
+namespace {
+// All numbers in the files are little-endian.
+
+constexpr quint32 SegmentMagic = 0x53434e51;    // "QNCS"
+constexpr quint32 IndexMagic = 0x49434e51;      // "QNCI"
+constexpr quint32 RecordMagic = 0x52434e51;     // "QNCR"
+constexpr quint32 FormatVersion = 1;
+constexpr QDataStream::Version StreamVersion = QDataStream::Qt_6_0;
+
+// don't bother compacting for less than this
+constexpr qint64 MinimumCompactionSize = 1024 * 1024;
+
+enum RecordFlag : quint32 {
+    Removed = 0x1,          // the key was removed; there is no meta data or body
+};
+
+struct SegmentHeader
+{
+    quint32_le magic;
+    quint32_le version;
+    quint64_le generation;
+};
+
+// followed by the key, the meta data and the body
+struct RecordHeader
+{
+    quint32_le magic;
+    quint32_le flags;
+    quint32_le keySize;
+    quint32_le metaDataSize;
+    quint64_le dataSize;
+    quint32_le checksum;
+    quint32_le reserved;
+};
+
+// followed by one IndexEntry and key for each entry, least recently used first
+struct IndexHeader
+{
+    quint32_le magic;
+    quint32_le version;
+    quint64_le generation;  // of the segment file this index belongs to
+    quint64_le segmentSize; // the records up to here are in the index
+    quint64_le count;
+};
+
+struct IndexEntry
+{
+    quint64_le offset;
+    quint64_le size;
+    quint32_le keySize;
+    quint32_le reserved;
+};
+} // unnamed namespace
+
+static QString indexFileName(const QString &cacheDirectory)
+{
+    return cacheDirectory + "cache.idx"_L1;
+}
+
+static QString segmentFileName(const QString &cacheDirectory)
+{
+    return cacheDirectory + "cache.dat"_L1;
+}
+
+template <typename T> static QByteArrayView bytesOf(const T &t)
+{
+    return QByteArrayView(reinterpret_cast<const char *>(&t), sizeof(T));
+}
+
+static quint32 recordChecksum(QByteArrayView key, QByteArrayView metaData, QByteArrayView data)
+{
+    return (quint32(qChecksum(data)) << 16) | (qChecksum(key) ^ qChecksum(metaData));
+}
+
+// Parses the record at \a p, of which \a available bytes are mapped. Verifying
+// the checksum reads the whole body, so only do that when recovering.
+static bool parseRecord(const uchar *p, qint64 available, bool verify,
+                        QNetworkIndexedDiskCachePrivate::Record *record)
+{
+    RecordHeader header;
+    if (available < qint64(sizeof header))
+        return false;
+    memcpy(&header, p, sizeof header);
+    if (header.magic != RecordMagic)
+        return false;
+
+    const qint64 payload = available - qint64(sizeof header);
+    const quint64 dataSize = header.dataSize;
+    if (quint64(header.keySize) + header.metaDataSize > quint64(payload)
+            || dataSize > quint64(payload - header.keySize - header.metaDataSize)) {
+        return false;
+    }
+
+    const char *begin = reinterpret_cast<const char *>(p) + sizeof header;
+    record->flags = header.flags;
+    record->key = QByteArrayView(begin, header.keySize);
+    record->metaData = QByteArrayView(begin + header.keySize, header.metaDataSize);
+    record->data = QByteArrayView(begin + header.keySize + header.metaDataSize, qint64(dataSize));
+    record->size = qint64(sizeof header) + header.keySize + header.metaDataSize + qint64(dataSize);
+    return !verify
+            || header.checksum == recordChecksum(record->key, record->metaData, record->data);
+}
+
+static QNetworkCacheMetaData parseMetaData(QByteArrayView bytes)
+{
+    const QByteArray data = QByteArray::fromRawData(bytes.data(), bytes.size());
+    QDataStream stream(data);
+    stream.setVersion(StreamVersion);
+    QNetworkCacheMetaData metaData;
+    stream >> metaData;
+    return stream.status() == QDataStream::Ok ? metaData : QNetworkCacheMetaData();
+}
+
+// Opens or creates the segment file in cacheDirectory and builds the index.
+void QNetworkIndexedDiskCachePrivate::open()
+{
+    QDir().mkpath(cacheDirectory);
+    segment.setFileName(segmentFileName(cacheDirectory));
+    if (!segment.open(QIODevice::ReadWrite | QIODevice::Unbuffered)) {
+        qCWarning(lcIndexedDiskCache) << "Cannot open" << segment.fileName()
+                                      << segment.errorString();
+        return;
+    }
+
+    SegmentHeader header;
+    if (segment.read(reinterpret_cast<char *>(&header), sizeof header) != sizeof header
+            || header.magic != SegmentMagic || header.version != FormatVersion) {
+        createSegment();    // new or unusable
+        return;
+    }
+    generation = header.generation;
+
+    if (!loadIndex()) {
+        entries.clear();
+        lru.clear();
+        liveSize = 0;
+        scanSegment(sizeof(SegmentHeader));
+    }
+}
+
+// Writes the index and closes the segment file.
+void QNetworkIndexedDiskCachePrivate::close()
+{
+    if (!segment.isOpen())
+        return;
+    saveIndex();
+    unmap();
+    segment.close();
+    entries.clear();
+    lru.clear();
+    liveSize = 0;
+}
+
+// Empties the segment file and starts a new generation.
+bool QNetworkIndexedDiskCachePrivate::createSegment()
+{
+    unmap();
+    entries.clear();
+    lru.clear();
+    liveSize = 0;
+    QFile::remove(indexFileName(cacheDirectory));
+
+    generation = QRandomGenerator::global()->generate64();
+    SegmentHeader header;
+    header.magic = SegmentMagic;
+    header.version = FormatVersion;
+    header.generation = generation;
+    const QByteArrayView bytes = bytesOf(header);
+    if (!segment.resize(0) || !segment.seek(0) || segment.write(bytes.data(), bytes.size()) != bytes.size()) {
+        qCWarning(lcIndexedDiskCache) << "Cannot write" << segment.fileName()
+                                      << segment.errorString();
+        segment.close();
+        return false;
+    }
+    return true;
+}
+
+bool QNetworkIndexedDiskCachePrivate::loadIndex()
+{
+    QFile file(indexFileName(cacheDirectory));
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    const QByteArray index = file.readAll();
+
+    IndexHeader header;
+    if (index.size() < qsizetype(sizeof header))
+        return false;
+    memcpy(&header, index.constData(), sizeof header);
+    const quint64 indexedSize = header.segmentSize;
+    if (header.magic != IndexMagic || header.version != FormatVersion
+            || header.generation != generation || indexedSize < sizeof(SegmentHeader)
+            || indexedSize > quint64(segment.size())) {
+        return false;
+    }
+
+    qsizetype pos = sizeof header;
+    for (quint64 i = 0; i < header.count; ++i) {
+        IndexEntry entry;
+        if (index.size() - pos < qsizetype(sizeof entry))
+            return false;
+        memcpy(&entry, index.constData() + pos, sizeof entry);
+        pos += sizeof entry;
+
+        const quint64 offset = entry.offset;
+        const quint64 size = entry.size;
+        if (index.size() - pos < qsizetype(entry.keySize) || offset < sizeof(SegmentHeader)
+                || offset > indexedSize || size > indexedSize - offset) {
+            return false;
+        }
+        addEntry(index.sliced(pos, entry.keySize), qint64(offset), qint64(size));
+        pos += entry.keySize;
+    }
+
+    // pick up what was added after the index was written
+    scanSegment(qint64(indexedSize));
+    return true;
+}
+
+bool QNetworkIndexedDiskCachePrivate::saveIndex()
+{
+    if (!segment.isOpen())
+        return false;
+
+    IndexHeader header;
+    header.magic = IndexMagic;
+    header.version = FormatVersion;
+    header.generation = generation;
+    header.segmentSize = segment.size();
+    header.count = entries.size();
+
+    QByteArray index;
+    index.reserve(sizeof header + entries.size() * (sizeof(IndexEntry) + 64));
+    index.append(bytesOf(header));
+    for (auto it = lru.crbegin(); it != lru.crend(); ++it) {
+        const Entry &entry = *entries.constFind(*it);
+        IndexEntry indexEntry;
+        indexEntry.offset = entry.offset;
+        indexEntry.size = entry.size;
+        indexEntry.keySize = it->size();
+        indexEntry.reserved = 0;
+        index.append(bytesOf(indexEntry)).append(*it);
+    }
+
+    QSaveFile file(indexFileName(cacheDirectory));
+    if (!file.open(QIODevice::WriteOnly) || file.write(index) != index.size() || !file.commit()) {
+        qCWarning(lcIndexedDiskCache) << "Cannot write" << file.fileName() << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+// Adds the records from offset \a from on to the index. Anything following the
+// last complete record is left over from an interrupted write and cut off.
+void QNetworkIndexedDiskCachePrivate::scanSegment(qint64 from)
+{
+    const qint64 fileSize = segment.size();
+    if (from >= fileSize)
+        return;
+    const uchar *base = mapped(0, fileSize);
+    if (!base)
+        return;
+
+    qint64 offset = from;
+    Record record;
+    while (offset < fileSize) {
+        if (!parseRecord(base + offset, fileSize - offset, true, &record)) {
+            qCWarning(lcIndexedDiskCache) << "Discarding" << fileSize - offset
+                                          << "bytes of incomplete data in" << segment.fileName();
+            unmap();    // truncating mapped pages would make them fault
+            segment.resize(offset);
+            return;
+        }
+
+        const QByteArray key = record.key.toByteArray();
+        if (record.flags & Removed) {
+            if (auto it = entries.find(key); it != entries.end())
+                removeEntry(it);
+        } else {
+            addEntry(key, offset, record.size);
+        }
+        offset += record.size;
+    }
+}
+
+// Unmaps the segment file. This must be done before it is truncated.
+void QNetworkIndexedDiskCachePrivate::unmap()
+{
+    if (map)
+        segment.unmap(map);
+    map = nullptr;
+    mapSize = 0;
+}
+
+// Returns a pointer to \a size bytes of the segment file at \a offset, mapping
+// the file again if it has grown.
+const uchar *QNetworkIndexedDiskCachePrivate::mapped(qint64 offset, qint64 size)
+{
+    if (offset < 0 || size < 0)
+        return nullptr;
+    if (offset + size > mapSize) {
+        unmap();
+
+        const qint64 fileSize = segment.size();
+        if (offset + size > fileSize || fileSize == 0)
+            return nullptr;
+        map = segment.map(0, fileSize);
+        if (!map) {
+            qCWarning(lcIndexedDiskCache) << "Cannot map" << segment.fileName()
+                                          << segment.errorString();
+            return nullptr;
+        }
+        mapSize = fileSize;
+    }
+    return map + offset;
+}
+
+bool QNetworkIndexedDiskCachePrivate::readRecord(const Entry &entry, Record *record)
+{
+    const uchar *p = mapped(entry.offset, entry.size);
+    return p && parseRecord(p, entry.size, false, record) && record->size == entry.size;
+}
+
+// Appends a record to the segment file. Records that aren't tombstones are
+// added to the index.
+bool QNetworkIndexedDiskCachePrivate::append(const QByteArray &key,
+                                             const QNetworkCacheMetaData &metaData,
+                                             QByteArrayView data, quint32 flags)
+{
+    if (!segment.isOpen())
+        return false;
+
+    QByteArray meta;
+    if (!(flags & Removed)) {
+        QDataStream stream(&meta, QIODevice::WriteOnly);
+        stream.setVersion(StreamVersion);
+        stream << metaData;
+    }
+
+    RecordHeader header;
+    header.magic = RecordMagic;
+    header.flags = flags;
+    header.keySize = key.size();
+    header.metaDataSize = meta.size();
+    header.dataSize = data.size();
+    header.checksum = recordChecksum(key, meta, data);
+    header.reserved = 0;
+
+    QByteArray head;
+    head.reserve(sizeof header + key.size() + meta.size());
+    head.append(bytesOf(header)).append(key).append(meta);
+
+    // data may point into our own mapping, which is fine as long as we
+    // only write past its end
+    const qint64 offset = segment.size();
+    if (!segment.seek(offset) || segment.write(head) != head.size()
+            || (!data.isEmpty() && segment.write(data.data(), data.size()) != data.size())) {
+        qCWarning(lcIndexedDiskCache) << "Cannot write" << segment.fileName()
+                                      << segment.errorString();
+        unmap();
+        segment.resize(offset);
+        return false;
+    }
+
+    if (!(flags & Removed))
+        addEntry(key, offset, head.size() + data.size());
+    return true;
+}
+
+void QNetworkIndexedDiskCachePrivate::addEntry(const QByteArray &key, qint64 offset, qint64 size)
+{
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        liveSize -= it->size;
+        lru.splice(lru.begin(), lru, it->lru);
+        it->offset = offset;
+        it->size = size;
+    } else {
+        lru.push_front(key);
+        entries.insert(key, Entry{ offset, size, lru.begin() });
+    }
+    liveSize += size;
+}
+
+void QNetworkIndexedDiskCachePrivate::removeEntry(QHash<QByteArray, Entry>::iterator it)
+{
+    liveSize -= it->size;
+    lru.erase(it->lru);
+    entries.erase(it);
+}
+
+// Looks up \a url and marks it as the most recently used entry.
+QNetworkIndexedDiskCachePrivate::Entry *QNetworkIndexedDiskCachePrivate::findEntry(const QUrl &url)
+{
+    auto it = entries.find(keyFor(url));
+    if (it == entries.end())
+        return nullptr;
+    lru.splice(lru.begin(), lru, it->lru);
+    return &*it;
+}
+
+// Evicts the least recently used entries if the cache is too big, and
+// compacts the segment file if it is mostly garbage.
+void QNetworkIndexedDiskCachePrivate::expire()
+{
+    if (liveSize > maximumCacheSize) {
+        const qint64 goal = (maximumCacheSize * 9) / 10;
+        while (liveSize > goal && !lru.empty())
+            removeEntry(entries.find(lru.back()));
+    }
+
+    const qint64 dead = deadSize();
+    if (dead > liveSize && dead > MinimumCompactionSize)
+        compact();
+}
+
+qint64 QNetworkIndexedDiskCachePrivate::deadSize() const
+{
+    if (!segment.isOpen())
+        return 0;
+    return segment.size() - qint64(sizeof(SegmentHeader)) - liveSize;
+}
+
+// Writes the records of all entries to a new segment file, which then replaces
+// the old one. If we crash before that, the old file stays as it was; if we
+// crash after it, the index is outdated and the new file gets scanned.
+bool QNetworkIndexedDiskCachePrivate::compact()
+{
+    if (!segment.isOpen())
+        return false;
+
+    QSaveFile file(segment.fileName());
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(lcIndexedDiskCache) << "Cannot compact" << segment.fileName()
+                                      << file.errorString();
+        return false;
+    }
+
+    const quint64 newGeneration = QRandomGenerator::global()->generate64();
+    SegmentHeader header;
+    header.magic = SegmentMagic;
+    header.version = FormatVersion;
+    header.generation = newGeneration;
+    file.write(bytesOf(header).data(), sizeof header);
+
+    // least recently used first, like the index, so that scanning the new
+    // file restores the same order
+    std::vector<qint64> offsets;
+    offsets.reserve(entries.size());
+    qint64 offset = sizeof header;
+    for (auto it = lru.crbegin(); it != lru.crend(); ++it) {
+        const Entry &entry = *entries.constFind(*it);
+        const uchar *p = mapped(entry.offset, entry.size);
+        if (!p) {
+            file.cancelWriting();
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(p), entry.size);
+        offsets.push_back(offset);
+        offset += entry.size;
+    }
+
+    // the file must be closed to be replaced on Windows
+    unmap();
+    segment.close();
+    const bool committed = file.commit();
+
+    if (!segment.open(QIODevice::ReadWrite | QIODevice::Unbuffered)) {
+        qCWarning(lcIndexedDiskCache) << "Cannot open" << segment.fileName()
+                                      << segment.errorString();
+        entries.clear();
+        lru.clear();
+        liveSize = 0;
+        return false;
+    }
+    if (!committed) {
+        qCWarning(lcIndexedDiskCache) << "Cannot compact" << segment.fileName()
+                                      << file.errorString();
+        return false;
+    }
+
+    generation = newGeneration;
+    auto newOffset = offsets.cbegin();
+    for (auto it = lru.crbegin(); it != lru.crend(); ++it)
+        entries.find(*it)->offset = *newOffset++;
+    saveIndex();
+    return true;
+}
+
+/*!
+    Creates a new disk cache. The \a parent argument is passed to
+    QAbstractNetworkCache's constructor.
+*/
+QNetworkIndexedDiskCache::QNetworkIndexedDiskCache(QObject *parent)
+    : QAbstractNetworkCache(*new QNetworkIndexedDiskCachePrivate, parent)
+{
+}
+
+/*!
+    Destroys the cache object after writing its index to disk. This does not
+    clear the disk cache.
+*/
+QNetworkIndexedDiskCache::~QNetworkIndexedDiskCache()
+{
+    Q_D(QNetworkIndexedDiskCache);
+    qDeleteAll(d->inserting);
+    d->close();
+}
+
+/*!
+    Returns the location where the cache files are stored.
+*/
+QString QNetworkIndexedDiskCache::cacheDirectory() const
+{
+    Q_D(const QNetworkIndexedDiskCache);
+    return d->cacheDirectory;
+}
+
+/*!
+    Sets the directory where the cache files are stored to \a cacheDir.
+
+    QNetworkIndexedDiskCache will create this directory if it does not
+    exist, and reads the entries that are already stored there.
+
+    \sa QStandardPaths::CacheLocation
+*/
+void QNetworkIndexedDiskCache::setCacheDirectory(const QString &cacheDir)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    if (cacheDir.isEmpty())
+        return;
+    QString directory = QDir(cacheDir).absolutePath();
+    if (!directory.endsWith(u'/'))
+        directory += u'/';
+    if (directory == d->cacheDirectory)
+        return;
+
+    d->close();
+    d->cacheDirectory = std::move(directory);
+    d->open();
+    d->expire();
+}
+
+/*!
+    Returns the maximum size of the cache.
+
+    \sa setMaximumCacheSize()
+*/
+qint64 QNetworkIndexedDiskCache::maximumCacheSize() const
+{
+    Q_D(const QNetworkIndexedDiskCache);
+    return d->maximumCacheSize;
+}
+
+/*!
+    Sets the maximum size of the cache to \a size. The default is 50MB.
+
+    If the cache is bigger than \a size, the least recently used entries are
+    evicted until it is below 90% of \a size.
+
+    \sa maximumCacheSize()
+*/
+void QNetworkIndexedDiskCache::setMaximumCacheSize(qint64 size)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    d->maximumCacheSize = size;
+    d->expire();
+}
+
+/*!
+    \reimp
+
+    This does not include the space taken up by entries that were replaced,
+    removed or evicted until the next compaction.
+*/
+qint64 QNetworkIndexedDiskCache::cacheSize() const
+{
+    Q_D(const QNetworkIndexedDiskCache);
+    return d->liveSize;
+}
+
+/*!
+    \reimp
+*/
+QNetworkCacheMetaData QNetworkIndexedDiskCache::metaData(const QUrl &url)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    QNetworkIndexedDiskCachePrivate::Record record;
+    const QNetworkIndexedDiskCachePrivate::Entry *entry = d->findEntry(url);
+    if (!entry || !d->readRecord(*entry, &record))
+        return QNetworkCacheMetaData();
+    return parseMetaData(record.metaData);
+}
+
+/*!
+    \reimp
+*/
+void QNetworkIndexedDiskCache::updateMetaData(const QNetworkCacheMetaData &metaData)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    if (!metaData.isValid() || !metaData.saveToDisk())
+        return;
+
+    QNetworkIndexedDiskCachePrivate::Record record;
+    const QNetworkIndexedDiskCachePrivate::Entry *entry = d->findEntry(metaData.url());
+    if (!entry || !d->readRecord(*entry, &record))
+        return;
+    if (d->append(d->keyFor(metaData.url()), metaData, record.data))
+        d->expire();
+}
+
+/*!
+    \reimp
+*/
+QIODevice *QNetworkIndexedDiskCache::data(const QUrl &url)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    QNetworkIndexedDiskCachePrivate::Record record;
+    const QNetworkIndexedDiskCachePrivate::Entry *entry = d->findEntry(url);
+    if (!entry || !d->readRecord(*entry, &record))
+        return nullptr;
+
+    // copy, as the mapping goes away when the file grows
+    auto buffer = std::make_unique<QBuffer>();
+    buffer->setData(record.data.toByteArray());
+    buffer->open(QBuffer::ReadOnly);
+    return buffer.release();
+}
+
+/*!
+    \reimp
+*/
+bool QNetworkIndexedDiskCache::remove(const QUrl &url)
+{
+    Q_D(QNetworkIndexedDiskCache);
+
+    // remove is also used to cancel insertions, not a common operation
+    for (auto it = d->inserting.cbegin(), end = d->inserting.cend(); it != end; ++it) {
+        if (it.value()->metaData.url() == url) {
+            delete it.value();
+            d->inserting.erase(it);
+            return true;
+        }
+    }
+
+    const QByteArray key = d->keyFor(url);
+    const auto it = d->entries.find(key);
+    if (it == d->entries.end())
+        return false;
+
+    // record the removal, so the entry doesn't come back when recovering
+    d->append(key, QNetworkCacheMetaData(), {}, Removed);
+    d->removeEntry(it);
+    d->expire();
+    return true;
+}
+
+/*!
+    \reimp
+*/
+QIODevice *QNetworkIndexedDiskCache::prepare(const QNetworkCacheMetaData &metaData)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    if (!metaData.isValid() || !metaData.url().isValid() || !metaData.saveToDisk())
+        return nullptr;
+
+    if (d->cacheDirectory.isEmpty()) {
+        qWarning("QNetworkIndexedDiskCache::prepare() The cache directory is not set");
+        return nullptr;
+    }
+
+    const auto sizeValue = metaData.headers().value(QHttpHeaders::WellKnownHeader::ContentLength);
+    const qint64 size = sizeValue.toLongLong();
+    if (size > (maximumCacheSize() * 3) / 4)
+        return nullptr;
+
+    auto item = std::make_unique<QNetworkIndexedDiskCachePrivate::PendingItem>();
+    item->metaData = metaData;
+    item->buffer.open(QBuffer::ReadWrite);
+    QIODevice *device = &item->buffer;
+    d->inserting.insert(device, item.release());
+    return device;
+}
+
+/*!
+    \reimp
+*/
+void QNetworkIndexedDiskCache::insert(QIODevice *device)
+{
+    Q_D(QNetworkIndexedDiskCache);
+    const auto it = d->inserting.constFind(device);
+    if (Q_UNLIKELY(it == d->inserting.cend())) {
+        qWarning() << "QNetworkIndexedDiskCache::insert() called on a device we don't know about"
+                   << device;
+        return;
+    }
+
+    const std::unique_ptr<QNetworkIndexedDiskCachePrivate::PendingItem> item(it.value());
+    d->inserting.erase(it);
+    if (d->append(d->keyFor(item->metaData.url()), item->metaData, item->buffer.data()))
+        d->expire();
+}
+
+/*!
+    Writes a new segment file containing only the current entries, dropping
+    the space used by replaced, removed and evicted ones. Returns \c true if
+    the cache was compacted.
+
+    The cache compacts itself when more than half of the segment file is
+    unused, so calling this function is only needed to reclaim disk space
+    right away.
+*/
+bool QNetworkIndexedDiskCache::compact()
+{
+    Q_D(QNetworkIndexedDiskCache);
+    return d->compact();
+}
+
+/*!
+    Writes the index of the cache to disk. Returns \c true on success.
+
+    The index is also written when the cache is destroyed. Flushing it
+    regularly reduces the amount of data that has to be read when the cache
+    is opened after the application crashed.
+*/
+bool QNetworkIndexedDiskCache::flush()
+{
+    Q_D(QNetworkIndexedDiskCache);
+    return d->saveIndex();
+}
+
+/*!
+    \reimp
+*/
+void QNetworkIndexedDiskCache::clear()
+{
+    Q_D(QNetworkIndexedDiskCache);
+    if (d->segment.isOpen())
+        d->createSegment();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qnetworkindexeddiskcache.cpp"
@@ -0,0 +1,50 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QNETWORKINDEXEDDISKCACHE_H
+#define QNETWORKINDEXEDDISKCACHE_H
+
+#include <QtNetwork/qtnetworkglobal.h>
+#include <QtNetwork/qabstractnetworkcache.h>
+
+QT_REQUIRE_CONFIG(networkdiskcache);
+
+QT_BEGIN_NAMESPACE
+
+class QNetworkIndexedDiskCachePrivate;
+class Q_NETWORK_EXPORT QNetworkIndexedDiskCache : public QAbstractNetworkCache
+{
+    Q_OBJECT
+
+public:
+    explicit QNetworkIndexedDiskCache(QObject *parent = nullptr);
+    ~QNetworkIndexedDiskCache();
+
+    QString cacheDirectory() const;
+    void setCacheDirectory(const QString &cacheDir);
+
+    qint64 maximumCacheSize() const;
+    void setMaximumCacheSize(qint64 size);
+
+    qint64 cacheSize() const override;
+    QNetworkCacheMetaData metaData(const QUrl &url) override;
+    void updateMetaData(const QNetworkCacheMetaData &metaData) override;
+    QIODevice *data(const QUrl &url) override;
+    bool remove(const QUrl &url) override;
+    QIODevice *prepare(const QNetworkCacheMetaData &metaData) override;
+    void insert(QIODevice *device) override;
+
+    bool compact();
+    bool flush();
+
+public Q_SLOTS:
+    void clear() override;
+
+private:
+    Q_DECLARE_PRIVATE(QNetworkIndexedDiskCache)
+    Q_DISABLE_COPY(QNetworkIndexedDiskCache)
+};
+
+QT_END_NAMESPACE
+
+#endif // QNETWORKINDEXEDDISKCACHE_H
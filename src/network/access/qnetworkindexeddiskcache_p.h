@@ -0,0 +1,94 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QNETWORKINDEXEDDISKCACHE_P_H
+#define QNETWORKINDEXEDDISKCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtNetwork/private/qtnetworkglobal_p.h>
+#include "private/qabstractnetworkcache_p.h"
+
+#include <qbuffer.h>
+#include <qfile.h>
+#include <qhash.h>
+
+#include <list>
+
+QT_REQUIRE_CONFIG(networkdiskcache);
+
+QT_BEGIN_NAMESPACE
+
+class QNetworkIndexedDiskCachePrivate : public QAbstractNetworkCachePrivate
+{
+public:
+    struct Entry
+    {
+        qint64 offset;      // of the record in the segment file
+        qint64 size;        // of the whole record
+        std::list<QByteArray>::iterator lru;
+    };
+
+    struct PendingItem
+    {
+        QNetworkCacheMetaData metaData;
+        QBuffer buffer;
+    };
+
+    struct Record
+    {
+        quint32 flags;
+        qint64 size;
+        QByteArrayView key;
+        QByteArrayView metaData;
+        QByteArrayView data;
+    };
+
+    static QByteArray keyFor(const QUrl &url) { return url.toEncoded(); }
+
+    void open();
+    void close();
+    bool createSegment();
+    bool loadIndex();
+    bool saveIndex();
+    void scanSegment(qint64 from);
+    void unmap();
+    const uchar *mapped(qint64 offset, qint64 size);
+    bool readRecord(const Entry &entry, Record *record);
+    bool append(const QByteArray &key, const QNetworkCacheMetaData &metaData,
+                QByteArrayView data, quint32 flags = 0);
+    void addEntry(const QByteArray &key, qint64 offset, qint64 size);
+    void removeEntry(QHash<QByteArray, Entry>::iterator it);
+    Entry *findEntry(const QUrl &url);
+    void expire();
+    bool compact();
+    qint64 deadSize() const;
+
+    QString cacheDirectory;
+    qint64 maximumCacheSize = 1024 * 1024 * 50;
+    qint64 liveSize = 0;        // the size of the records of all entries
+
+    QFile segment;
+    uchar *map = nullptr;
+    qint64 mapSize = 0;
+    quint64 generation = 0;     // changes whenever the segment file is rewritten
+
+    QHash<QByteArray, Entry> entries;
+    std::list<QByteArray> lru;  // most recently used first
+    QHash<QIODevice *, PendingItem *> inserting;
+
+    Q_DECLARE_PUBLIC(QNetworkIndexedDiskCache)
+};
+
+QT_END_NAMESPACE
+
+#endif // QNETWORKINDEXEDDISKCACHE_P_H
@@ -1314,7 +1314,8 @@ void QNetworkReplyHttpImplPrivate::followRedirect()
     decompressHelper.clear();
     clearHeaders();
 
-    if (managerPrivate->thread)
+    // other managers' replies are connected to the shared thread, too
+    if (managerPrivate->thread && !managerPrivate->threadIsShared)
         managerPrivate->thread->disconnect();
 
     QMetaObject::invokeMethod(
@@ -511,6 +511,74 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+void tst_QCoreApplication::lockFreePostedEvents()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    const bool wasLockFree = std::exchange(QCoreApplicationPrivate::lockFreePostedEvents, true);
+    const auto restore = qScopeGuard([wasLockFree] {
+        QCoreApplicationPrivate::lockFreePostedEvents = wasLockFree;
+    });
+
+    // queued calls from several threads arrive in the order each one made them
+    constexpr int Producers = 4;
+    constexpr int Calls = 1000;
+    QObject receiver;
+    QList<int> last(Producers, -1);
+    int received = 0;
+    QList<QThread *> threads;
+    for (int t = 0; t < Producers; ++t) {
+        threads.append(QThread::create([&, t] {
+            for (int i = 0; i < Calls; ++i) {
+                QMetaObject::invokeMethod(&receiver, [&, t, i] {
+                    QCOMPARE(last[t], i - 1);
+                    last[t] = i;
+                    ++received;
+                }, Qt::QueuedConnection);
+            }
+        }));
+        threads.last()->start();
+    }
+    for (QThread *thread : std::as_const(threads))
+        QVERIFY(thread->wait());
+    qDeleteAll(threads);
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(received, Producers * Calls);
+
+    // and in order with the events posted with the lock held
+    EventSpy spy;
+    receiver.installEventFilter(&spy);
+    QMetaObject::invokeMethod(&receiver, [] {}, Qt::QueuedConnection);
+    QCoreApplication::postEvent(&receiver, new QEvent(QEvent::User));
+    QMetaObject::invokeMethod(&receiver, [] {}, Qt::QueuedConnection);
+    QCoreApplication::postEvent(&receiver, new QEvent(QEvent::User), Qt::HighEventPriority);
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(spy.recordedEvents,
+             QList<int>({ QEvent::User, QEvent::MetaCall, QEvent::User, QEvent::MetaCall }));
+
+    // they can be removed
+    bool called = false;
+    QMetaObject::invokeMethod(&receiver, [&called] { called = true; }, Qt::QueuedConnection);
+    QCoreApplication::removePostedEvents(&receiver, QEvent::MetaCall);
+    QCoreApplication::sendPostedEvents();
+    QVERIFY(!called);
+
+    // and follow their receiver to another thread
+    QThread thread;
+    QObject moved;
+    QAtomicPointer<QThread> calledIn;
+    QMetaObject::invokeMethod(&moved, [&calledIn] {
+        calledIn.storeRelease(QThread::currentThread());
+    }, Qt::QueuedConnection);
+    moved.moveToThread(&thread);
+    thread.start();
+    QTRY_COMPARE(calledIn.loadAcquire(), &thread);
+    thread.quit();
+    QVERIFY(thread.wait());
+}
 #endif // QT_CONFIG(thread)
 
 void tst_QCoreApplication::applicationPid()
@@ -151,6 +151,7 @@ private slots:
     void functorReferencesConnection();
     void disconnectDisconnects();
     void singleShotConnection();
+    void coalescedConnection();
     void objectNameBinding();
     void emitToDestroyedClass();
     void declarativeData();
@@ -8545,6 +8546,111 @@ void tst_QObject::singleShotConnection()
     }
 }
 
+class CoalescedReceiver : public QObject
+{
+    Q_OBJECT
+public slots:
+    void setValue(int value) { values.append(value); }
+public:
+    QList<int> values;
+};
+
+void tst_QObject::coalescedConnection()
+{
+    const auto coalescedQueued = Qt::ConnectionType(Qt::QueuedConnection | Qt::CoalescedConnection);
+    {
+        // Only the latest emission is delivered
+        SenderObject sender;
+        QList<std::pair<int, QString>> calls;
+        QVERIFY(connect(&sender, &SenderObject::signal7, this,
+                        [&calls](int i, const QString &s) { calls.append({ i, s }); },
+                        coalescedQueued));
+        for (int i = 0; i < 100; ++i)
+            emit sender.signal7(i, QString::number(i));
+        QVERIFY(calls.isEmpty());
+        QCoreApplication::processEvents();
+        QCOMPARE(calls, (QList<std::pair<int, QString>>{ { 99, u"99"_s } }));
+
+        // Once delivered, the next emission queues a new call
+        emit sender.signal7(100, u"100"_s);
+        emit sender.signal7(101, u"101"_s);
+        QCoreApplication::processEvents();
+        QCOMPARE(calls.size(), 2);
+        QCOMPARE(calls.last(), std::pair(101, u"101"_s));
+    }
+
+    {
+        // String-based connection, next to one that isn't coalesced
+        SenderObject sender;
+        CoalescedReceiver coalesced;
+        CoalescedReceiver queued;
+        QVERIFY(connect(&sender, SIGNAL(signal7(int,QString)), &coalesced, SLOT(setValue(int)),
+                        coalescedQueued));
+        QVERIFY(connect(&sender, SIGNAL(signal7(int,QString)), &queued, SLOT(setValue(int)),
+                        Qt::QueuedConnection));
+        for (int i = 0; i < 5; ++i)
+            emit sender.signal7(i, QString());
+        QCoreApplication::processEvents();
+        QCOMPARE(coalesced.values, QList<int>{ 4 });
+        QCOMPARE(queued.values, QList<int>({ 0, 1, 2, 3, 4 }));
+    }
+
+    {
+        // Direct calls aren't affected
+        SenderObject sender;
+        CoalescedReceiver receiver;
+        QVERIFY(connect(&sender, &SenderObject::signal7, &receiver, &CoalescedReceiver::setValue,
+                        Qt::ConnectionType(Qt::AutoConnection | Qt::CoalescedConnection)));
+        for (int i = 0; i < 3; ++i)
+            emit sender.signal7(i, QString());
+        QCOMPARE(receiver.values, QList<int>({ 0, 1, 2 }));
+    }
+
+    {
+        // A pending call goes away with its receiver
+        SenderObject sender;
+        auto receiver = std::make_unique<CoalescedReceiver>();
+        QVERIFY(connect(&sender, &SenderObject::signal7, receiver.get(),
+                        &CoalescedReceiver::setValue, coalescedQueued));
+        emit sender.signal7(1, QString());
+        emit sender.signal7(2, QString());
+        receiver.reset();
+        emit sender.signal7(3, QString());
+        QCoreApplication::processEvents();
+    }
+
+    {
+        // Emissions after disconnecting don't update the pending call
+        SenderObject sender;
+        CoalescedReceiver receiver;
+        QMetaObject::Connection c = connect(&sender, &SenderObject::signal7, &receiver,
+                                            &CoalescedReceiver::setValue, coalescedQueued);
+        emit sender.signal7(1, QString());
+        QVERIFY(QObject::disconnect(c));
+        emit sender.signal7(2, QString());
+        QCoreApplication::processEvents();
+        QVERIFY(!receiver.values.contains(2));
+    }
+
+#if QT_CONFIG(thread)
+    {
+        // Emitted from another thread while the receiver's is busy
+        SenderObject sender;
+        CoalescedReceiver receiver;
+        QVERIFY(connect(&sender, &SenderObject::signal7, &receiver, &CoalescedReceiver::setValue,
+                        Qt::ConnectionType(Qt::AutoConnection | Qt::CoalescedConnection)));
+        std::unique_ptr<QThread> thread(QThread::create([&sender] {
+            for (int i = 0; i < 10000; ++i)
+                emit sender.signal7(i, QString());
+        }));
+        thread->start();
+        QVERIFY(thread->wait());
+        QCoreApplication::processEvents();
+        QCOMPARE(receiver.values, QList<int>{ 9999 });
+    }
+#endif
+}
+
 void tst_QObject::objectNameBinding()
 {
     QObject obj;
@@ -19,6 +19,13 @@
 #endif
 #include <limits>
 
+#ifdef ENABLE_EPOLL
+static bool epollEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_EPOLL", "1");
+    return true;
+}();
+#endif
+
 #if defined (Q_CC_MSVC) && defined(max)
 #  undef max
 #  undef min
@@ -35,6 +42,8 @@ private slots:
     void mixingWithTimers();
 #ifdef Q_OS_UNIX
     void posixSockets();
+    void closeWithoutDisable();
+    void reusedDescriptor();
 #endif
     void asyncMultipleDatagram();
     void activationReason_data();
@@ -337,6 +346,64 @@ void tst_QSocketNotifier::posixSockets()
     }
     qt_safe_close(posixSocket);
 }
+
+void tst_QSocketNotifier::closeWithoutDisable()
+{
+    int pipes[2];
+    QCOMPARE(qt_safe_pipe(pipes), 0);
+
+    QSocketNotifier notifier(pipes[0], QSocketNotifier::Read);
+    QSignalSpy spy(&notifier, &QSocketNotifier::activated);
+    QCoreApplication::processEvents();
+
+    // the notifier is disabled instead of silently not reporting anything
+    const QByteArray warning = "QSocketNotifier: Invalid socket " + QByteArray::number(pipes[0])
+            + " with type Read, disabling...";
+    QTest::ignoreMessage(QtWarningMsg, warning.constData());
+    qt_safe_close(pipes[0]);
+    QTRY_VERIFY(!notifier.isEnabled());
+    QCOMPARE(spy.size(), 0);
+
+    qt_safe_close(pipes[1]);
+}
+
+void tst_QSocketNotifier::reusedDescriptor()
+{
+    int oldPipes[2];
+    QCOMPARE(qt_safe_pipe(oldPipes), 0);
+    // keeps the old pipe open after its descriptor is closed
+    const int oldReadEnd = qt_safe_dup(oldPipes[0]);
+    QVERIFY(oldReadEnd != -1);
+
+    {
+        QSocketNotifier notifier(oldPipes[0], QSocketNotifier::Read);
+        QCoreApplication::processEvents();
+        // closed before the notifier is disabled
+        qt_safe_close(oldPipes[0]);
+    }
+
+    int newPipes[2];
+    QCOMPARE(qt_safe_pipe(newPipes), 0);
+    if (newPipes[0] != oldPipes[0]) {
+        for (int fd : { oldReadEnd, oldPipes[1], newPipes[0], newPipes[1] })
+            qt_safe_close(fd);
+        QSKIP("The descriptor was not reused");
+    }
+
+    QSocketNotifier notifier(newPipes[0], QSocketNotifier::Read);
+    QSignalSpy spy(&notifier, &QSocketNotifier::activated);
+
+    // data in the old pipe must not activate the notifier for the new one
+    QCOMPARE(qt_safe_write(oldPipes[1], "x", 1), 1);
+    QTest::qWait(100);
+    QCOMPARE(spy.size(), 0);
+
+    QCOMPARE(qt_safe_write(newPipes[1], "y", 1), 1);
+    QTRY_COMPARE(spy.size(), 1);
+
+    for (int fd : { oldReadEnd, oldPipes[1], newPipes[0], newPipes[1] })
+        qt_safe_close(fd);
+}
 #endif
 
 void tst_QSocketNotifier::async_readDatagramSlot()
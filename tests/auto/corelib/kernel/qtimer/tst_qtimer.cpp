@@ -23,6 +23,7 @@
 #include <QSignalSpy>
 #include <QtTest/private/qpropertytesthelper_p.h>
 
+#include <qabstracteventdispatcher.h>
 #include <qtimer.h>
 #include <qthread.h>
 #include <qelapsedtimer.h>
@@ -39,6 +40,13 @@ static bool glibDisabled = []() {
 }();
 #endif
 
+#ifdef ENABLE_TIMER_WHEEL
+static bool timerWheelEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_TIMER_WHEEL", "1");
+    return true;
+}();
+#endif
+
 using namespace std::chrono_literals;
 
 class tst_QTimer : public QObject
@@ -77,6 +85,9 @@ private slots:
     void timerFiresOnlyOncePerProcessEvents();
     void timerIdPersistsAfterThreadExit();
     void cancelLongTimer();
+    void timersAcrossSlots();
+    void farFutureTimers();
+    void cancelAndRestartTimers();
     void singleShotStaticFunctionZeroTimeout();
     void recurseOnTimeoutAndStopTimer();
     void singleShotToFunctors();
@@ -866,6 +877,109 @@ void tst_QTimer::cancelLongTimer()
     QVERIFY(!timer.isActive());
 }
 
+class TimerEventRecorder : public QObject
+{
+public:
+    QList<int> fired;
+    QList<std::chrono::nanoseconds> firedAfter;
+    QElapsedTimer elapsed;
+
+    TimerEventRecorder() { elapsed.start(); }
+
+protected:
+    void timerEvent(QTimerEvent *event) override
+    {
+        fired.append(event->timerId());
+        firedAfter.append(elapsed.durationElapsed());
+        killTimer(event->timerId());
+    }
+};
+
+void tst_QTimer::timersAcrossSlots()
+{
+    // The intervals cross one or more millisecond boundaries of 64 and 4096,
+    // where a timing wheel wraps around
+    const std::chrono::milliseconds intervals[] = { 700ms, 130ms, 30ms, 70ms, 65ms };
+    TimerEventRecorder recorder;
+    QList<int> ids;
+    for (auto interval : intervals)
+        ids.append(recorder.startTimer(interval, Qt::PreciseTimer));
+
+    const QList<int> expected = { ids[2], ids[4], ids[3], ids[1], ids[0] };
+    QTRY_COMPARE_WITH_TIMEOUT(recorder.fired, expected, 5s);
+    for (qsizetype i = 0; i < ids.size(); ++i) {
+        const auto interval = intervals[ids.indexOf(recorder.fired.at(i))];
+        QCOMPARE_GE(recorder.firedAfter.at(i), interval);
+    }
+}
+
+void tst_QTimer::farFutureTimers()
+{
+    // Further away than the last level of a timing wheel of 64^6 milliseconds
+    constexpr auto FarFuture = 1000 * 24h;
+    TimerEventRecorder recorder;
+    const int far = recorder.startTimer(FarFuture);
+    const int month = recorder.startTimer(30 * 24h);
+    const int near = recorder.startTimer(50ms, Qt::PreciseTimer);
+
+    QTRY_COMPARE(recorder.fired, QList<int>{ near });
+    QTest::qWait(50);
+    QCOMPARE(recorder.fired, QList<int>{ near });
+
+    auto dispatcher = QAbstractEventDispatcher::instance();
+    const auto remaining = dispatcher->remainingTime(Qt::TimerId(far));
+    QCOMPARE_GT(remaining, FarFuture - 2s);
+    QCOMPARE_LE(remaining, FarFuture + 1s);
+    const QList<QAbstractEventDispatcher::TimerInfoV2> registered =
+            dispatcher->timersForObject(&recorder);
+    QCOMPARE(registered.size(), 2);
+    QCOMPARE(registered.at(0).timerId, Qt::TimerId(month));
+    QCOMPARE(registered.at(1).timerId, Qt::TimerId(far));
+
+    recorder.killTimer(month);
+    recorder.killTimer(far);
+    QCoreApplication::processEvents();
+    QVERIFY(dispatcher->timersForObject(&recorder).isEmpty());
+}
+
+void tst_QTimer::cancelAndRestartTimers()
+{
+    TimerEventRecorder recorder;
+    QList<int> ids;
+    for (auto interval : { 10ms, 40ms, 70ms, 130ms, 300ms, 600ms })
+        ids.append(recorder.startTimer(interval, Qt::PreciseTimer));
+
+    // Cancel some timers and restart others into slots before or after their
+    // old ones
+    recorder.killTimer(ids[1]);
+    recorder.killTimer(ids[4]);
+    recorder.killTimer(ids[0]);
+    recorder.killTimer(ids[5]);
+    const int earlier = recorder.startTimer(20ms, Qt::PreciseTimer);
+    const int later = recorder.startTimer(200ms, Qt::PreciseTimer);
+
+    const QList<int> expected = { earlier, ids[2], ids[3], later };
+    QTRY_COMPARE(recorder.fired, expected);
+    QTest::qWait(500);
+    QCOMPARE(recorder.fired, expected);
+
+    // Restarting a timer moves it to a later slot every time, so it only
+    // fires after the last restart
+    QTimer restarted;
+    restarted.setSingleShot(true);
+    restarted.setTimerType(Qt::PreciseTimer);
+    QSignalSpy timeoutSpy(&restarted, &QTimer::timeout);
+    QElapsedTimer elapsed;
+    for (int i = 0; i < 5; ++i) {
+        restarted.start(100ms);
+        elapsed.start();
+        QTest::qWait(20);
+        QCOMPARE(timeoutSpy.size(), 0);
+    }
+    QVERIFY(timeoutSpy.wait());
+    QCOMPARE_GE(elapsed.durationElapsed(), 100ms);
+}
+
 void tst_QTimer::testTimerId()
 {
     QTimer timer;
@@ -1020,7 +1134,10 @@ void tst_QTimer::singleShotToFunctors()
     _t->start();
     QCOMPARE(e.exec(), 0);
 
-    QTimer::singleShot(0, &c2, &StaticEventLoop::quitEventLoop);
+    // c2's thread could quit _e before it runs, so only start the timer then
+    QTimer::singleShot(0, _e.data(), [&c2] {
+        QTimer::singleShot(0, &c2, &StaticEventLoop::quitEventLoop);
+    });
     QCOMPARE(_e->exec(), 0);
 
     _t->quit();
@@ -103,6 +103,8 @@ private Q_SLOTS:
 
     void parseEscapes_data();
     void parseEscapes();
+    void parseStringsAcrossBlocks_data();
+    void parseStringsAcrossBlocks();
     void makeEscapes_data();
     void makeEscapes();
 
@@ -2797,6 +2799,47 @@ void tst_QtJson::parseEscapes()
     QCOMPARE(array.first().toString(), result);
 }
 
+void tst_QtJson::parseStringsAcrossBlocks_data()
+{
+    QTest::addColumn<QByteArray>("special");
+    QTest::addColumn<QString>("result");
+
+    QTest::newRow("escaped-quote") << QByteArray(R"(\")") << QStringLiteral("\"");
+    QTest::newRow("escaped-newline") << QByteArray(R"(\n)") << QStringLiteral("\n");
+    QTest::newRow("escaped-unicode") << QByteArray(R"(\u00e9)") << QStringLiteral("\u00e9");
+    QTest::newRow("utf8-2byte") << QByteArray("\xc3\xa9") << QStringLiteral("\u00e9");
+    QTest::newRow("utf8-3byte") << QByteArray("\xe6\x97\xa5") << QStringLiteral("\u65e5");
+    QTest::newRow("delete") << QByteArray("\x7f") << QStringLiteral("\x7f");
+}
+
+void tst_QtJson::parseStringsAcrossBlocks()
+{
+    // the string scanner handles 16- and 32-byte blocks at a time, so move
+    // the interesting character and the end of the string across them
+    QFETCH(QByteArray, special);
+    QFETCH(QString, result);
+
+    for (int prefix = 0; prefix < 70; ++prefix) {
+        for (int suffix : { 0, 1, 15, 16, 17, 31, 32, 33 }) {
+            const QByteArray json = "[\"" + QByteArray(prefix, 'a') + special
+                    + QByteArray(suffix, 'b') + "\"]";
+            const QString expected = QString(prefix, u'a') + result + QString(suffix, u'b');
+
+            QJsonParseError error;
+            QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+            QCOMPARE(error.error, QJsonParseError::NoError);
+            QCOMPARE(doc.array().first().toString(), expected);
+        }
+
+        // invalid UTF-8 and unterminated strings are still diagnosed
+        QJsonParseError error;
+        QJsonDocument::fromJson("[\"" + QByteArray(prefix, 'a') + "\xff\"]", &error);
+        QCOMPARE(error.error, QJsonParseError::IllegalUTF8String);
+        QJsonDocument::fromJson("[\"" + QByteArray(prefix, 'a') + special, &error);
+        QVERIFY(error.error != QJsonParseError::NoError);
+    }
+}
+
 void tst_QtJson::makeEscapes_data()
 {
     QTest::addColumn<QString>("input");
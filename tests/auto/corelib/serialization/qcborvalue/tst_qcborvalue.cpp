@@ -103,8 +103,13 @@ private slots:
     void fromCborStreamReaderByteArray();
     void fromCborStreamReaderIODevice_data() { fromCbor_data(); }
     void fromCborStreamReaderIODevice();
+    void fromRawCbor_data() { fromCbor_data(); }
+    void fromRawCbor();
+    void fromRawCborReferencesData();
     void validation_data();
     void validation();
+    void rawValidation_data() { validation_data(); }
+    void rawValidation();
     void extendedTypeValidation_data();
     void extendedTypeValidation();
     void hugeDeviceValidation_data();
@@ -2481,6 +2486,66 @@ void tst_QCborValue::fromCborStreamReaderIODevice()
     fromCbor_common(doCheck);
 }
 
+void tst_QCborValue::fromRawCbor()
+{
+    auto doCheck = [](const QCborValue &expected, const QByteArray &data) {
+        QCborParserError error;
+        QCborValue decoded = QCborValue::fromRawCbor(data, &error);
+        QVERIFY2(error.error == QCborError(), qPrintable(error.errorString()));
+        QCOMPARE(error.offset, data.size());
+        QVERIFY(decoded == expected);
+        QVERIFY(expected == decoded);
+        QCOMPARE(decoded.toCbor(), expected.toCbor());
+
+        // and from a buffer we don't own
+        QByteArray copy = data;
+        copy.detach();
+        decoded = QCborValue::fromRawCbor(QByteArray::fromRawData(copy.constData(), copy.size()));
+        QVERIFY(decoded == expected);
+    };
+
+    fromCbor_common(doCheck);
+}
+
+void tst_QCborValue::fromRawCborReferencesData()
+{
+    const QCborMap original = {
+        { u"name"_s, u"Hello, World"_s },
+        { u"bytes"_s, QByteArray("\1\2\3\4") },
+        { u"list"_s, QCborArray{ u"one"_s, u"two"_s, u"three"_s } },
+    };
+    QByteArray buffer = original.toCborValue().toCbor();
+    const QByteArray raw = QByteArray::fromRawData(buffer.constData(), buffer.size());
+
+    QCborMap map = QCborValue::fromRawCbor(raw).toMap();
+    QCOMPARE(map, original);
+
+    // the strings are read from the buffer, not copies of it
+    qsizetype pos = buffer.indexOf("World");
+    QVERIFY(pos > 0);
+    buffer.data()[pos] = 'w';
+    QCOMPARE(map[u"name"_s].toString(), u"Hello, world"_s);
+    QCOMPARE(map.value(u"list"_s).toArray().at(2).toString(), u"three"_s);
+
+    // modifying the map or inserting its values elsewhere still works
+    QCborArray other = { map.value(u"bytes"_s), 42 };
+    map[u"name"_s] = u"Goodbye"_s;
+    map.remove(u"bytes"_s);
+    QCborArray list = map.take(u"list"_s).toArray();
+    list.append(u"four"_s);
+    QCOMPARE(map, QCborMap({ { u"name"_s, u"Goodbye"_s } }));
+    QCOMPARE(list, QCborArray({ u"one"_s, u"two"_s, u"three"_s, u"four"_s }));
+    QCOMPARE(other.at(0).toByteArray(), QByteArray("\1\2\3\4"));
+
+    // a buffer that owns its data is kept alive by the values
+    QCborValue value;
+    {
+        QByteArray owned = original.toCborValue().toCbor();
+        value = QCborValue::fromRawCbor(owned);
+    }
+    QCOMPARE(value.toMap(), original);
+}
+
 #include "../cborlargedatavalidation.cpp"
 
 void tst_QCborValue::validation_data()
@@ -2546,6 +2611,17 @@ void tst_QCborValue::validation()
     }
 }
 
+void tst_QCborValue::rawValidation()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(CborError, expectedError);
+    QCborError error = { QCborError::Code(expectedError) };
+
+    QCborParserError parserError;
+    QCborValue decoded = QCborValue::fromRawCbor(data, &parserError);
+    QCOMPARE(parserError.error, error);
+}
+
 void tst_QCborValue::extendedTypeValidation_data()
 {
     QTest::addColumn<QByteArray>("data");
@@ -0,0 +1,602 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonStreamReader>
+#include <QJsonStreamWriter>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonStream : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void tokens_data();
+    void tokens();
+    void incremental_data() { tokens_data(); }
+    void incremental();
+    void device();
+    void text();
+    void textAfterAddData();
+    void numbers();
+    void errors_data();
+    void errors();
+    void premature_data();
+    void premature();
+    void deepNesting();
+    void largeDocument();
+
+    void writer_data();
+    void writer();
+    void writeValue_data() { writer_data(); }
+    void writeValue();
+    void writerToDevice();
+    void roundTrip_data() { writer_data(); }
+    void roundTrip();
+};
+
+template <typename View>
+static bool holds(QAnyStringView text)
+{
+    return text.visit([](auto view) { return std::is_same_v<decltype(view), View>; });
+}
+
+// Describes the current token in a compact notation.
+static QString describeToken(const QJsonStreamReader &reader)
+{
+    switch (reader.tokenType()) {
+    case QJsonStreamReader::NoToken:
+        return QString();
+    case QJsonStreamReader::Invalid:
+        return u"<error>"_s;
+    case QJsonStreamReader::StartObject:
+        return u"{"_s;
+    case QJsonStreamReader::EndObject:
+        return u"}"_s;
+    case QJsonStreamReader::StartArray:
+        return u"["_s;
+    case QJsonStreamReader::EndArray:
+        return u"]"_s;
+    case QJsonStreamReader::Key:
+        return reader.text().toString() + u':';
+    case QJsonStreamReader::String:
+        return u'"' + reader.text().toString() + u'"';
+    case QJsonStreamReader::Number:
+        return QString::number(reader.toDouble());
+    case QJsonStreamReader::Bool:
+        return reader.toBool() ? u"true"_s : u"false"_s;
+    case QJsonStreamReader::Null:
+        return u"null"_s;
+    }
+    Q_UNREACHABLE_RETURN(QString());
+}
+
+// Describes the remaining tokens of the document.
+static QString describe(QJsonStreamReader &reader)
+{
+    QStringList result;
+    while (reader.readNext() != QJsonStreamReader::NoToken) {
+        result << describeToken(reader);
+        if (reader.hasError())
+            break;
+    }
+    return result.join(u' ');
+}
+
+// Builds the value starting at the current token.
+static QJsonValue buildValue(QJsonStreamReader &reader)
+{
+    switch (reader.tokenType()) {
+    case QJsonStreamReader::StartObject: {
+        QJsonObject object;
+        while (reader.readNext() == QJsonStreamReader::Key) {
+            const QString key = reader.text().toString();
+            reader.readNext();
+            object.insert(key, buildValue(reader));
+        }
+        return object;
+    }
+    case QJsonStreamReader::StartArray: {
+        QJsonArray array;
+        while (reader.readNext() != QJsonStreamReader::EndArray && !reader.hasError())
+            array.append(buildValue(reader));
+        return array;
+    }
+    default:
+        return reader.value();
+    }
+}
+
+// Writes value with the individual writer calls.
+static void writeTokens(QJsonStreamWriter &writer, const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Object: {
+        writer.writeStartObject();
+        const QJsonObject object = value.toObject();
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            writer.writeKey(it.key());
+            writeTokens(writer, it.value());
+        }
+        writer.writeEndObject();
+        break;
+    }
+    case QJsonValue::Array:
+        writer.writeStartArray();
+        for (const QJsonValue &element : value.toArray())
+            writeTokens(writer, element);
+        writer.writeEndArray();
+        break;
+    case QJsonValue::String:
+        writer.writeString(value.toString());
+        break;
+    case QJsonValue::Double:
+        if (value.toDouble() == value.toInteger())
+            writer.writeInteger(value.toInteger());
+        else
+            writer.writeDouble(value.toDouble());
+        break;
+    case QJsonValue::Bool:
+        writer.writeBool(value.toBool());
+        break;
+    default:
+        writer.writeNull();
+        break;
+    }
+}
+
+void tst_QJsonStream::tokens_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("empty-object") << QByteArray("{}") << u"{ }"_s;
+    QTest::newRow("empty-array") << QByteArray(" [ ] \n") << u"[ ]"_s;
+    QTest::newRow("bom") << QByteArray("\xef\xbb\xbf[1]") << u"[ 1 ]"_s;
+    QTest::newRow("scalars")
+            << QByteArray("[true, false, null, 1, -2.5, 1e3, \"x\"]")
+            << u"[ true false null 1 -2.5 1000 \"x\" ]"_s;
+    QTest::newRow("object")
+            << QByteArray("{\"a\": 1, \"b\": {\"c\": [null]}, \"d\": \"e\"}")
+            << u"{ a: 1 b: { c: [ null ] } d: \"e\" }"_s;
+    QTest::newRow("nested-arrays")
+            << QByteArray("[[[]], [[1], []]]")
+            << u"[ [ [ ] ] [ [ 1 ] [ ] ] ]"_s;
+    QTest::newRow("escapes")
+            << QByteArray("{\"a\\\"b\": \"\\u00e9\\n\\\\\"}")
+            << u"{ a\"b: \"\u00e9\n\\\" }"_s;
+    QTest::newRow("utf8")
+            << QByteArray("[\"gr\xc3\xbc\xc3\x9f \xe2\x82\xac \xf0\x9f\x98\x80\"]")
+            << u"[ \"gr\u00fc\u00df \u20ac \U0001F600\" ]"_s;
+    QTest::newRow("whitespace")
+            << QByteArray(" \t\r\n{ \t\r\n\"a\" \t\r\n: \t\r\n1 \t\r\n} \t\r\n")
+            << u"{ a: 1 }"_s;
+}
+
+void tst_QJsonStream::tokens()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+
+    QJsonStreamReader reader(json);
+    QCOMPARE(describe(reader), expected);
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.atEnd());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+}
+
+void tst_QJsonStream::incremental()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+
+    // feed the data one byte at a time, so that every token gets split
+    QJsonStreamReader reader;
+    QStringList tokens;
+    qsizetype fed = 0;
+    while (reader.readNext() != QJsonStreamReader::NoToken) {
+        if (reader.tokenType() == QJsonStreamReader::Invalid) {
+            QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+            QVERIFY(reader.atEnd());
+            QVERIFY2(fed < json.size(), qPrintable(reader.errorString()));
+            reader.addData(json.mid(fed++, 1));
+            continue;
+        }
+        tokens << describeToken(reader);
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(tokens.join(u' '), expected);
+}
+
+void tst_QJsonStream::device()
+{
+    const QByteArray json = "{\"list\": [1, 2, 3], \"name\": \"value\"}";
+    QBuffer buffer;
+    buffer.setData(json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+    QCOMPARE(describe(reader), u"{ list: [ 1 2 3 ] name: \"value\" }"_s);
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.offset(), json.size());
+
+    // data arriving in pieces, like on a socket
+    QBuffer pipe;
+    QVERIFY(pipe.open(QIODevice::ReadWrite));
+    reader.setDevice(&pipe);
+    pipe.write(json.left(14));
+    pipe.seek(0);
+    QStringList tokens;
+    while (reader.readNext() != QJsonStreamReader::Invalid)
+        tokens << QString::number(int(reader.tokenType()));
+    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+    QCOMPARE(tokens.size(), 4);    // { list: [ 1
+
+    const qint64 readPos = pipe.pos();
+    pipe.seek(pipe.size());
+    pipe.write(json.mid(14));
+    pipe.seek(readPos);
+    while (reader.readNext() > QJsonStreamReader::Invalid)
+        tokens << QString::number(int(reader.tokenType()));
+    QVERIFY(!reader.hasError());
+    QCOMPARE(tokens.size(), 10);
+}
+
+void tst_QJsonStream::text()
+{
+    QJsonStreamReader reader(QByteArray("[\"plain\", \"caf\xc3\xa9\", \"esc\\tape\", \"\"]"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QVERIFY(reader.text().isNull());
+
+    // strings without escape sequences refer to the input
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QVERIFY(holds<QLatin1StringView>(reader.text()));
+    QCOMPARE(reader.text(), "plain"_L1);
+    QCOMPARE(reader.value(), QJsonValue(u"plain"_s));
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QVERIFY(holds<QUtf8StringView>(reader.text()));
+    QCOMPARE(reader.text().toString(), u"caf\u00e9"_s);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text().toString(), u"esc\tape"_s);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QVERIFY(reader.text().isEmpty());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+}
+
+void tst_QJsonStream::textAfterAddData()
+{
+    // enough consumed input for addData() to drop it from the buffer
+    const QByteArray padding(64 * 1024, ' ');
+    const QByteArray key(100, 'k');
+    QJsonStreamReader reader(padding + "{\"" + key + "\": \"value\"");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    reader.addData(", \"next\": ");
+    QCOMPARE(reader.text(), QLatin1StringView(key));
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    reader.addData(padding);
+    QCOMPARE(reader.text(), "value"_L1);
+    QCOMPARE(reader.value(), QJsonValue(u"value"_s));
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    reader.addData("1}");
+    QCOMPARE(reader.text(), "next"_L1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QVERIFY(!reader.hasError());
+}
+
+void tst_QJsonStream::numbers()
+{
+    QJsonStreamReader reader(QByteArray("[0, -1, 9007199254740993, 1.5, -0.25e2, 1e300, 2.0]"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), 0);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), -1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), Q_INT64_C(9007199254740993));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toDouble(), 1.5);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toDouble(), -25.);
+    QCOMPARE(reader.toInteger(), -25);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toDouble(), 1e300);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.value(), QJsonValue(2));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+}
+
+void tst_QJsonStream::errors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("top-level-string") << QByteArray("\"text\"");
+    QTest::newRow("top-level-number") << QByteArray("1 ");
+    QTest::newRow("missing-value-separator") << QByteArray("[1 2]");
+    QTest::newRow("missing-name-separator") << QByteArray("{\"a\" 1}");
+    QTest::newRow("trailing-comma-object") << QByteArray("{\"a\": 1,}");
+    QTest::newRow("trailing-comma-array") << QByteArray("[1,]");
+    QTest::newRow("non-string-key") << QByteArray("{1: 2}");
+    QTest::newRow("mismatched-end") << QByteArray("[1}");
+    QTest::newRow("bad-literal") << QByteArray("[tru]");
+    QTest::newRow("bad-number") << QByteArray("[-]");
+    QTest::newRow("number-overflow") << QByteArray("[1e400]");
+    QTest::newRow("bad-escape") << QByteArray("[\"\\u12\"]");
+    QTest::newRow("bad-utf8") << QByteArray("[\"\xff\"]");
+    QTest::newRow("garbage-at-end") << QByteArray("[1] x");
+}
+
+void tst_QJsonStream::errors()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    QVERIFY(QJsonDocument::fromJson(json, &expected).isNull());
+
+    QJsonStreamReader reader(json);
+    QVERIFY(describe(reader).endsWith(u"<error>"_s));
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+    QVERIFY(reader.atEnd());
+    QCOMPARE(reader.errorString(), expected.errorString());
+
+    // errors are final
+    reader.addData(" ");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+}
+
+void tst_QJsonStream::premature_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QByteArray>("rest");
+
+    QTest::newRow("empty") << QByteArray() << QByteArray("[]");
+    QTest::newRow("whitespace") << QByteArray("  ") << QByteArray("[]");
+    QTest::newRow("bom") << QByteArray("\xef\xbb") << QByteArray("\xbf{}");
+    QTest::newRow("object") << QByteArray("{\"a\": 1") << QByteArray("}");
+    QTest::newRow("key") << QByteArray("{\"a") << QByteArray("\":1}");
+    QTest::newRow("array") << QByteArray("[1,") << QByteArray("2]");
+    QTest::newRow("string") << QByteArray("[\"abc") << QByteArray("\"]");
+    QTest::newRow("escape") << QByteArray("[\"abc\\") << QByteArray("n\"]");
+    QTest::newRow("utf8") << QByteArray("[\"\xe2\x82") << QByteArray("\xac\"]");
+    QTest::newRow("number") << QByteArray("[12") << QByteArray("]");
+    QTest::newRow("literal") << QByteArray("[fal") << QByteArray("se]");
+}
+
+void tst_QJsonStream::premature()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QByteArray, rest);
+
+    QJsonStreamReader reader(json);
+    QVERIFY(describe(reader).endsWith(u"<error>"_s));
+    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.errorString().isEmpty());
+
+    // nothing was lost, complete the document
+    QJsonStreamReader whole(json + rest);
+    const QString expected = describe(whole);
+    QVERIFY(!whole.hasError());
+
+    reader.clear();
+    reader.addData(json);
+    QString tokens = describe(reader);
+    QVERIFY(tokens.endsWith(u"<error>"_s));
+    tokens.chop(7);
+    reader.addData(rest);
+    tokens += describe(reader);
+    QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+    QCOMPARE(tokens.trimmed(), expected);
+    QCOMPARE(reader.depth(), 0);
+}
+
+void tst_QJsonStream::deepNesting()
+{
+    QJsonStreamReader reader(QByteArray(1024, '[') + QByteArray(1024, ']'));
+    describe(reader);
+    QVERIFY(!reader.hasError());
+
+    QJsonParseError expected;
+    const QByteArray json = QByteArray(1025, '[') + QByteArray(1025, ']');
+    QJsonDocument::fromJson(json, &expected);
+    reader.clear();
+    reader.addData(json);
+    describe(reader);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+    QCOMPARE(reader.errorString(), expected.errorString());
+    QCOMPARE(reader.depth(), 1024);
+}
+
+void tst_QJsonStream::largeDocument()
+{
+    // larger than the reader's buffer, to exercise compaction
+    QJsonArray array;
+    for (int i = 0; i < 20000; ++i) {
+        array.append(QJsonObject{ { u"id"_s, i },
+                                  { u"name"_s, u"element \"%1\""_s.arg(i) },
+                                  { u"ok"_s, i % 3 == 0 } });
+    }
+    const QByteArray json = QJsonDocument(array).toJson();
+
+    QBuffer buffer;
+    buffer.setData(json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(buildValue(reader), QJsonValue(array));
+    QVERIFY(!reader.hasError());
+
+    // the same, arriving in odd-sized chunks
+    reader.setDevice(nullptr);
+    qsizetype ids = 0;
+    for (qsizetype i = 0; i < json.size(); i += 4093) {
+        reader.addData(QByteArrayView(json).sliced(i, qMin(json.size() - i, qsizetype(4093))));
+        while (reader.readNext() > QJsonStreamReader::Invalid) {
+            if (reader.isKey() && reader.text() == "id"_L1)
+                ++ids;
+        }
+        QVERIFY(reader.tokenType() == QJsonStreamReader::NoToken
+                || reader.error() == QJsonStreamReader::PrematureEndOfDocumentError);
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QCOMPARE(ids, array.size());
+}
+
+void tst_QJsonStream::writer_data()
+{
+    QTest::addColumn<QJsonValue>("value");
+
+    QTest::newRow("empty-object") << QJsonValue(QJsonObject());
+    QTest::newRow("empty-array") << QJsonValue(QJsonArray());
+    QTest::newRow("scalars")
+            << QJsonValue(QJsonArray{ true, false, QJsonValue::Null, 1, -2.5, 1e300,
+                                      u"text"_s, u""_s });
+    QTest::newRow("nested")
+            << QJsonValue(QJsonObject{
+                   { u"a"_s, QJsonObject{ { u"b"_s, QJsonArray{ QJsonArray(), QJsonObject() } } } },
+                   { u"c"_s, QJsonArray{ QJsonObject{ { u"d"_s, 1 } }, 2 } } });
+    QTest::newRow("escapes")
+            << QJsonValue(QJsonObject{ { u"key \"quoted\"\n"_s,
+                                         u"\\ \t \u0001 \u00e9 \u20ac \U0001F600"_s } });
+}
+
+void tst_QJsonStream::writer()
+{
+    QFETCH(QJsonValue, value);
+
+    for (QJsonDocument::JsonFormat format : { QJsonDocument::Indented, QJsonDocument::Compact }) {
+        const QJsonDocument doc = value.isObject() ? QJsonDocument(value.toObject())
+                                                   : QJsonDocument(value.toArray());
+        QByteArray output;
+        QJsonStreamWriter writer(&output);
+        writer.setFormat(format);
+        QCOMPARE(writer.format(), format);
+        writeTokens(writer, value);
+        QCOMPARE(output, doc.toJson(format));
+        QVERIFY(!writer.hasError());
+    }
+}
+
+void tst_QJsonStream::writeValue()
+{
+    QFETCH(QJsonValue, value);
+
+    // complete values written in the middle of a document
+    for (QJsonDocument::JsonFormat format : { QJsonDocument::Indented, QJsonDocument::Compact }) {
+        const QJsonObject wrapper{ { u"first"_s, value }, { u"second"_s, QJsonArray{ value } } };
+        QByteArray output;
+        QJsonStreamWriter writer(&output);
+        writer.setFormat(format);
+        writer.writeStartObject();
+        writer.writeKey("first"_L1);
+        writer.writeValue(value);
+        writer.writeKey(u"second");
+        writer.writeStartArray();
+        writer.writeValue(value);
+        writer.writeEndArray();
+        writer.writeEndObject();
+        QCOMPARE(output, QJsonDocument(wrapper).toJson(format));
+    }
+}
+
+void tst_QJsonStream::writerToDevice()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QJsonArray expected;
+    {
+        QJsonStreamWriter writer(&buffer);
+        QCOMPARE(writer.device(), &buffer);
+        writer.setFormat(QJsonDocument::Compact);
+        writer.writeStartArray();
+        for (int i = 0; i < 10000; ++i) {
+            writer.writeInteger(i);
+            expected.append(i);
+        }
+        // flushed while writing large documents
+        QVERIFY(buffer.size() > 0);
+        writer.writeEndArray();
+        // and once the document is complete
+        QCOMPARE(buffer.data(), QJsonDocument(expected).toJson(QJsonDocument::Compact));
+        QVERIFY(!writer.hasError());
+    }
+
+    QBuffer readOnly;
+    QVERIFY(readOnly.open(QIODevice::ReadOnly));
+    QJsonStreamWriter writer(&readOnly);
+    writer.writeStartArray();
+    QTest::ignoreMessage(QtWarningMsg, "QIODevice::write (QBuffer): ReadOnly device");
+    writer.writeEndArray();
+    QVERIFY(writer.hasError());
+}
+
+void tst_QJsonStream::roundTrip()
+{
+    QFETCH(QJsonValue, value);
+
+    const QJsonDocument doc = value.isObject() ? QJsonDocument(value.toObject())
+                                               : QJsonDocument(value.toArray());
+    const QByteArray json = doc.toJson();
+
+    QJsonStreamReader reader(json);
+    QByteArray output;
+    QJsonStreamWriter writer(&output);
+    while (true) {
+        switch (reader.readNext()) {
+        case QJsonStreamReader::StartObject:
+            writer.writeStartObject();
+            continue;
+        case QJsonStreamReader::EndObject:
+            writer.writeEndObject();
+            continue;
+        case QJsonStreamReader::StartArray:
+            writer.writeStartArray();
+            continue;
+        case QJsonStreamReader::EndArray:
+            writer.writeEndArray();
+            continue;
+        case QJsonStreamReader::Key:
+            writer.writeKey(reader.text());
+            continue;
+        case QJsonStreamReader::String:
+            writer.writeString(reader.text());
+            continue;
+        case QJsonStreamReader::Number:
+        case QJsonStreamReader::Bool:
+        case QJsonStreamReader::Null:
+            writer.writeValue(reader.value());
+            continue;
+        case QJsonStreamReader::NoToken:
+        case QJsonStreamReader::Invalid:
+            break;
+        }
+        break;
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(output, json);
+
+    reader.clear();
+    reader.addData(json);
+    QCOMPARE(reader.readNext(), value.isObject() ? QJsonStreamReader::StartObject
+                                                 : QJsonStreamReader::StartArray);
+    QCOMPARE(buildValue(reader), value);
+}
+
+QTEST_MAIN(tst_QJsonStream)
+
+#include "tst_qjsonstream.moc"
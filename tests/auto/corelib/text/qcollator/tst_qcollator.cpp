@@ -7,7 +7,9 @@
 #include <qcollator.h>
 #include <private/qglobal_p.h>
 #include <QScopeGuard>
+#include <QThreadPool>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 
@@ -22,6 +24,9 @@ private Q_SLOTS:
     void compare_data();
     void compare();
 
+    void sort_data();
+    void sort();
+
     void state();
 };
 
@@ -326,6 +331,76 @@ void tst_QCollator::compare()
 #endif
 }
 
+void tst_QCollator::sort_data()
+{
+    QTest::addColumn<QString>("locale");
+    QTest::addColumn<Qt::CaseSensitivity>("caseSensitivity");
+    QTest::addColumn<bool>("numericMode");
+
+    QTest::newRow("C") << QString("C") << Qt::CaseSensitive << false;
+    QTest::newRow("C-insensitive") << QString("C") << Qt::CaseInsensitive << false;
+    QTest::newRow("english") << QString("en_US") << Qt::CaseSensitive << false;
+    QTest::newRow("english-insensitive") << QString("en_US") << Qt::CaseInsensitive << false;
+    QTest::newRow("english-numeric") << QString("en_US") << Qt::CaseSensitive << true;
+    QTest::newRow("german") << QString("de_DE") << Qt::CaseSensitive << false;
+    QTest::newRow("swedish") << QString("sv_SE") << Qt::CaseSensitive << false;
+}
+
+void tst_QCollator::sort()
+{
+    QFETCH(QString, locale);
+    QFETCH(Qt::CaseSensitivity, caseSensitivity);
+    QFETCH(bool, numericMode);
+
+    QCollator collator((QLocale(locale)));
+#if !QT_CONFIG(icu) && !defined(Q_OS_WIN) && !defined(Q_OS_MACOS)
+    if (collator.locale() != QLocale::c() && collator.locale() != QLocale::system().collation())
+        QSKIP("POSIX implementation of collation only supports C and system collation locales");
+#endif
+    collator.setCaseSensitivity(caseSensitivity);
+    collator.setNumericMode(numericMode);
+
+    // enough strings for sortKeys() to split the work between threads
+    const QStringList parts = { "apple", "Apple", "\u00e4pple", "zebra", "\u00c5ngstr\u00f6m",
+                                "angstrom", "10", "9", "item 2", "item 10", "", "stra\u00dfe",
+                                "strasse", "Z", "\u00e9t\u00e9", "ete" };
+    QStringList list;
+    for (int i = 0; i < 5000; ++i)
+        list.append(parts.at(i % parts.size()) + parts.at((i * 7) % parts.size()));
+
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    auto threadCountRestorer = qScopeGuard([threadPool, count = threadPool->maxThreadCount()] {
+        threadPool->setMaxThreadCount(count);
+    });
+    threadPool->setMaxThreadCount(4);
+
+    const QList<QCollatorSortKey> keys = collator.sortKeys(list);
+    QCOMPARE(keys.size(), list.size());
+    for (qsizetype i = 0; i < list.size(); ++i)
+        QCOMPARE(keys.at(i).compare(collator.sortKey(list.at(i))), 0);
+
+    QStringList sorted = list;
+    collator.sort(sorted);
+    QVERIFY(std::is_permutation(sorted.cbegin(), sorted.cend(), list.cbegin()));
+
+    // NOTE: QCollatorSortKey::compare does not always agree with
+    // QCollator::compare without icu, see QTBUG-88704
+#if QT_CONFIG(icu)
+    const bool keysMatchCompare = true;
+#else
+    const bool keysMatchCompare = collator.locale() == QLocale::c();
+#endif
+    if (keysMatchCompare) {
+        QStringList expected = list;
+        std::stable_sort(expected.begin(), expected.end(), collator);
+        QCOMPARE(sorted, expected);
+    } else {
+        QVERIFY(std::is_sorted(sorted.cbegin(), sorted.cend(),
+                               [&](const QString &s1, const QString &s2) {
+            return collator.sortKey(s1) < collator.sortKey(s2);
+        }));
+    }
+}
 
 void tst_QCollator::state()
 {
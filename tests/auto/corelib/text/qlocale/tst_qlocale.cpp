@@ -13,6 +13,7 @@
 #if QT_CONFIG(process)
 #  include <QProcess>
 #endif
+#include <QRandomGenerator>
 #include <QScopedArrayPointer>
 #include <QTimeZone>
 
@@ -93,6 +94,8 @@ private slots:
     void doubleRoundTrip();
     void integerRoundTrip_data();
     void integerRoundTrip();
+    void shortestRoundTrip();
+    void integerToStringAllDigitCounts();
     void negativeNumbers();
     void numberOptions();
     void dayName_data();
@@ -2680,6 +2683,53 @@ void tst_QLocale::integerRoundTrip()
     QCOMPARE(locale.toString(number), numberText);
 }
 
+void tst_QLocale::shortestRoundTrip()
+{
+    QList<double> values = { 0.1, 0.3, 1e23, 5e-324, 2.2250738585072014e-308,
+                             1.7976931348623157e308, 9007199254740993.0, 123456.789 };
+    QRandomGenerator rng(2024);
+    for (int i = 0; i < 10000; ++i) {
+        const quint64 bits = rng.generate64();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if (qIsFinite(d))
+            values.append(d);
+        values.append(double(rng.bounded(10000000)) / 1000);
+    }
+
+    for (double d : std::as_const(values)) {
+        const QByteArray text = QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+        bool ok;
+        const double parsed = text.toDouble(&ok);
+        QVERIFY2(ok, text.constData());
+        QVERIFY2(memcmp(&parsed, &d, sizeof(d)) == 0, text.constData());
+        QCOMPARE(QString::number(d, 'g', QLocale::FloatingPointShortest), QLatin1StringView(text));
+        QCOMPARE(QLocale::c().toDouble(QLatin1StringView(text)), d);
+
+        // and one digit less isn't enough
+        const QByteArray exponentForm = QByteArray::number(d, 'e', QLocale::FloatingPointShortest);
+        const int digits = exponentForm.indexOf('e') - (exponentForm.contains('.') ? 1 : 0)
+                - (d < 0 ? 1 : 0);
+        if (digits > 1)
+            QCOMPARE_NE(QByteArray::number(d, 'g', digits - 1).toDouble(), d);
+    }
+}
+
+void tst_QLocale::integerToStringAllDigitCounts()
+{
+    qulonglong power = 1;
+    for (int digits = 1; digits <= 20; ++digits, power *= 10) {
+        for (qulonglong n : { power - 1, power, power + 1, power * 7 + 3 }) {
+            char expected[24];
+            const int length = qsnprintf(expected, sizeof(expected), "%llu", n);
+            QCOMPARE(QString::number(n), QLatin1StringView(expected, length));
+            QCOMPARE(QByteArray::number(n), QByteArrayView(expected, length));
+        }
+    }
+    QCOMPARE(QString::number(std::numeric_limits<qulonglong>::max()), u"18446744073709551615");
+    QCOMPARE(QString::number(std::numeric_limits<qlonglong>::min()), u"-9223372036854775808");
+}
+
 #ifdef Q_OS_DARWIN
 
 // Format number string according to system locale settings.
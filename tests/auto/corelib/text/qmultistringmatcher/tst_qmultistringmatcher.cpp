@@ -0,0 +1,259 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QMultiStringMatcher>
+#include <QtCore/QRandomGenerator>
+#include <QTest>
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+using ByteMatch = QMultiByteArrayMatcher::Match;
+using StringMatch = QMultiStringMatcher::Match;
+
+QT_BEGIN_NAMESPACE
+static bool operator==(const ByteMatch &lhs, const ByteMatch &rhs)
+{
+    return lhs.position == rhs.position && lhs.length == rhs.length
+            && lhs.patternIndex == rhs.patternIndex;
+}
+
+static bool operator==(const StringMatch &lhs, const StringMatch &rhs)
+{
+    return lhs.position == rhs.position && lhs.length == rhs.length
+            && lhs.patternIndex == rhs.patternIndex;
+}
+
+namespace QTest {
+template <> char *toString(const ByteMatch &m)
+{
+    return qstrdup(QByteArray("Match(%1, %2, %3)").replace("%1", QByteArray::number(m.position))
+                           .replace("%2", QByteArray::number(m.length))
+                           .replace("%3", QByteArray::number(m.patternIndex)).constData());
+}
+template <> char *toString(const StringMatch &m)
+{
+    return toString(ByteMatch{ m.position, m.length, m.patternIndex });
+}
+} // namespace QTest
+QT_END_NAMESPACE
+
+class tst_QMultiStringMatcher : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void empty();
+    void classic();
+    void match();
+    void duplicatesAndEmptyPatterns();
+    void from();
+    void caseInsensitiveLatin1();
+    void caseInsensitiveUtf16();
+    void copy();
+    void bruteForce_data();
+    void bruteForce();
+};
+
+// all matches the slow way, in the order matches() returns them
+static QList<ByteMatch> naiveMatches(const QByteArrayList &patterns, QByteArrayView data)
+{
+    QList<ByteMatch> result;
+    for (qsizetype end = 1; end <= data.size(); ++end) {
+        QList<ByteMatch> here;
+        for (qsizetype i = 0; i < patterns.size(); ++i) {
+            const QByteArray &p = patterns[i];
+            if (!p.isEmpty() && p.size() <= end && data.sliced(end - p.size(), p.size()) == p)
+                here.append(ByteMatch{ end - p.size(), p.size(), i });
+        }
+        std::stable_sort(here.begin(), here.end(), [](const ByteMatch &a, const ByteMatch &b) {
+            return a.length > b.length;
+        });
+        result += here;
+    }
+    return result;
+}
+
+void tst_QMultiStringMatcher::empty()
+{
+    const QMultiByteArrayMatcher bytes;
+    QVERIFY(bytes.patterns().isEmpty());
+    QCOMPARE(bytes.caseSensitivity(), Qt::CaseSensitive);
+    QVERIFY(!bytes.match("anything").isValid());
+    QVERIFY(bytes.matches("anything").isEmpty());
+
+    const QMultiStringMatcher strings(QStringList{});
+    QVERIFY(!strings.match(u"anything").isValid());
+    QVERIFY(strings.matches(u"anything").isEmpty());
+    QVERIFY(!strings.match(u"").isValid());
+}
+
+void tst_QMultiStringMatcher::classic()
+{
+    const QByteArrayList patterns = { "he", "she", "his", "hers" };
+    const QMultiByteArrayMatcher bytes(patterns);
+    QCOMPARE(bytes.patterns(), patterns);
+    const QList<ByteMatch> expected = {
+        { 1, 3, 1 },    // she
+        { 2, 2, 0 },    // he
+        { 2, 4, 3 },    // hers
+    };
+    QCOMPARE(bytes.matches("ushers"), expected);
+
+    QStringList strings;
+    for (const QByteArray &p : patterns)
+        strings.append(QString::fromLatin1(p));
+    const QMultiStringMatcher matcher(strings);
+    const QList<StringMatch> stringMatches = matcher.matches(u"ushers");
+    QCOMPARE(stringMatches.size(), expected.size());
+    for (qsizetype i = 0; i < expected.size(); ++i) {
+        QCOMPARE(stringMatches[i], (StringMatch{ expected[i].position, expected[i].length,
+                                                 expected[i].patternIndex }));
+    }
+}
+
+void tst_QMultiStringMatcher::match()
+{
+    const QMultiByteArrayMatcher matcher({ "abcd", "bc", "b", "abc" });
+    // leftmost, then longest
+    QCOMPARE(matcher.match("xxabcdxx"), (ByteMatch{ 2, 4, 0 }));
+    QCOMPARE(matcher.match("xxabcxx"), (ByteMatch{ 2, 3, 3 }));
+    QCOMPARE(matcher.match("xxbcxx"), (ByteMatch{ 2, 2, 1 }));
+    QCOMPARE(matcher.match("xxbxx"), (ByteMatch{ 2, 1, 2 }));
+    QVERIFY(!matcher.match("xxaxx").isValid());
+
+    // an early short match doesn't hide a longer one starting earlier
+    const QMultiStringMatcher strings({ u"cd"_s, u"abcdef"_s });
+    QCOMPARE(strings.match(u"abcdefg"), (StringMatch{ 0, 6, 1 }));
+    QCOMPARE(strings.match(u"abcdxfg"), (StringMatch{ 2, 2, 0 }));
+}
+
+void tst_QMultiStringMatcher::duplicatesAndEmptyPatterns()
+{
+    const QMultiByteArrayMatcher matcher({ "", "ab", "b", "ab" });
+    const QList<ByteMatch> expected = { { 1, 2, 1 }, { 1, 2, 3 }, { 2, 1, 2 } };
+    QCOMPARE(matcher.matches("xab"), expected);
+    QCOMPARE(matcher.match("xab"), (ByteMatch{ 1, 2, 1 }));
+    QVERIFY(!matcher.match("xyz").isValid());
+}
+
+void tst_QMultiStringMatcher::from()
+{
+    const QMultiByteArrayMatcher matcher({ "ab" });
+    const QByteArray data = "ab ab ab";
+    QCOMPARE(matcher.match(data, 0).position, 0);
+    QCOMPARE(matcher.match(data, 1).position, 3);
+    QCOMPARE(matcher.match(data, -2).position, 6);
+    QCOMPARE(matcher.match(data, -100).position, 0);
+    QVERIFY(!matcher.match(data, 7).isValid());
+    QVERIFY(!matcher.match(data, 100).isValid());
+    QCOMPARE(matcher.matches(data, 2).size(), 2);
+}
+
+void tst_QMultiStringMatcher::caseInsensitiveLatin1()
+{
+    const QMultiByteArrayMatcher matcher({ "error", "\xe4pfel" }, Qt::CaseInsensitive);
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseInsensitive);
+    QCOMPARE(matcher.match("an ERROR occurred"), (ByteMatch{ 3, 5, 0 }));
+    QCOMPARE(matcher.match("ein \xc4PFEL"), (ByteMatch{ 4, 5, 1 }));
+    QCOMPARE(matcher.matches("Error eRRor error").size(), 3);
+
+    const QMultiByteArrayMatcher sensitive({ "error" });
+    QCOMPARE(sensitive.matches("Error eRRor error").size(), 1);
+}
+
+void tst_QMultiStringMatcher::caseInsensitiveUtf16()
+{
+    const QMultiStringMatcher matcher({ u"straße"_s, u"k"_s, u"\U00010428x"_s },
+                                      Qt::CaseInsensitive);
+    QCOMPARE(matcher.match(u"STRAẞE"), (StringMatch{ 0, 6, 0 }));
+    // KELVIN SIGN folds to k
+    QCOMPARE(matcher.match(u"273 K"), (StringMatch{ 4, 1, 1 }));
+    // DESERET CAPITAL LETTER LONG I folds to its small letter
+    QCOMPARE(matcher.match(u"..\U00010400X"), (StringMatch{ 2, 3, 2 }));
+    QVERIFY(!matcher.match(u"strasse").isValid());
+}
+
+void tst_QMultiStringMatcher::copy()
+{
+    QMultiStringMatcher matcher({ u"one"_s });
+    QMultiStringMatcher copy = matcher;
+    matcher.setPatterns({ u"two"_s }, Qt::CaseInsensitive);
+    QCOMPARE(copy.patterns(), QStringList{ u"one"_s });
+    QCOMPARE(copy.caseSensitivity(), Qt::CaseSensitive);
+    QVERIFY(copy.match(u"one two").isValid());
+    QCOMPARE(matcher.match(u"one TWO").position, 4);
+
+    QMultiStringMatcher moved = std::move(matcher);
+    QCOMPARE(moved.match(u"one TWO").position, 4);
+    matcher = moved;
+    QCOMPARE(matcher.match(u"one TWO").position, 4);
+}
+
+void tst_QMultiStringMatcher::bruteForce_data()
+{
+    QTest::addColumn<int>("patternCount");
+    QTest::addColumn<int>("maxLength");
+    QTest::addColumn<int>("alphabet");
+
+    // few first characters: uses the SIMD filter
+    QTest::newRow("small-set") << 3 << 4 << 4;
+    QTest::newRow("keywords") << 500 << 8 << 8;
+    // too many states and classes for a DFA
+    QTest::newRow("sparse") << 3000 << 24 << 256;
+}
+
+void tst_QMultiStringMatcher::bruteForce()
+{
+    QFETCH(int, patternCount);
+    QFETCH(int, maxLength);
+    QFETCH(int, alphabet);
+
+    QRandomGenerator rng(patternCount);
+    const auto randomBytes = [&](qsizetype length) {
+        QByteArray result(length, Qt::Uninitialized);
+        for (char &c : result)
+            c = char('a' + rng.bounded(alphabet));
+        return result;
+    };
+
+    QByteArrayList patterns;
+    for (int i = 0; i < patternCount; ++i)
+        patterns.append(randomBytes(1 + rng.bounded(maxLength)));
+    const QMultiByteArrayMatcher matcher(patterns);
+
+    QStringList stringPatterns;
+    for (const QByteArray &p : std::as_const(patterns))
+        stringPatterns.append(QString::fromLatin1(p));
+    const QMultiStringMatcher stringMatcher(stringPatterns);
+
+    for (int round = 0; round < 20; ++round) {
+        QByteArray data = randomBytes(rng.bounded(200));
+        // make sure some patterns occur, also across SIMD chunk boundaries
+        for (int k = 0; k < 3; ++k)
+            data.insert(rng.bounded(data.size() + 1), patterns[rng.bounded(patterns.size())]);
+
+        const QList<ByteMatch> expected = naiveMatches(patterns, data);
+        QCOMPARE(matcher.matches(data), expected);
+
+        const QList<StringMatch> stringMatches = stringMatcher.matches(QString::fromLatin1(data));
+        QCOMPARE(stringMatches.size(), expected.size());
+        for (qsizetype i = 0; i < expected.size(); ++i)
+            QCOMPARE(stringMatches[i].position, expected[i].position);
+
+        // the leftmost-longest one
+        ByteMatch first;
+        for (const ByteMatch &m : expected) {
+            if (!first.isValid() || m.position < first.position
+                    || (m.position == first.position && m.length > first.length)) {
+                first = m;
+            }
+        }
+        QCOMPARE(matcher.match(data), first);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QMultiStringMatcher)
+
+#include "tst_qmultistringmatcher.moc"
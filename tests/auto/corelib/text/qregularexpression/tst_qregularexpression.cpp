@@ -69,6 +69,9 @@ private slots:
     void QStringAndQStringViewEquivalence();
     void threadSafety_data();
     void threadSafety();
+    void compiledPatternCache();
+    void matchOffsets_data();
+    void matchOffsets();
 
     void returnsViewsIntoOriginalString();
     void wildcard_data();
@@ -2404,6 +2407,131 @@ void tst_QRegularExpression::threadSafety()
     }
 }
 
+void tst_QRegularExpression::compiledPatternCache()
+{
+    // independently constructed objects share the compiled pattern, which
+    // must not be observable
+    {
+        const QRegularExpression re1("(\\d+)-(\\d+)");
+        const QRegularExpression re2("(\\d+)-(\\d+)");
+        QVERIFY(re1.isValid());
+        QVERIFY(re2.isValid());
+        QCOMPARE(re2.captureCount(), 2);
+        QCOMPARE(re2.matchView(u"x 12-34").captured(2), u"34");
+    }
+
+    // the options are part of the key
+    {
+        const QRegularExpression sensitive("abc");
+        const QRegularExpression insensitive("abc", QRegularExpression::CaseInsensitiveOption);
+        QVERIFY(!sensitive.matchView(u"ABC").hasMatch());
+        QVERIFY(insensitive.matchView(u"ABC").hasMatch());
+        QVERIFY(!QRegularExpression("abc").matchView(u"ABC").hasMatch());
+    }
+
+    // so are errors
+    for (int i = 0; i < 2; ++i) {
+        const QRegularExpression re("a(b");
+        QVERIFY(!re.isValid());
+        QCOMPARE(re.patternErrorOffset(), 3);
+        QCOMPARE(re.errorString(), QRegularExpression("a(b").errorString());
+    }
+
+    // and every object using (?J) still warns
+    const char warning[] = "QRegularExpressionPrivate::getPatternInfo(): the pattern '(?J)(?<n>a)|(?<n>b)'\n"
+                           "    is using the (?J) option; duplicate capturing group names are not supported by Qt";
+    for (int i = 0; i < 2; ++i) {
+        QTest::ignoreMessage(QtWarningMsg, warning);
+        QVERIFY(QRegularExpression("(?J)(?<n>a)|(?<n>b)").isValid());
+    }
+
+    // many threads racing to compile the same patterns
+    const int threadCount = qMax(QThread::idealThreadCount(), 4);
+    QAtomicInt failures;
+    QList<QThread *> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.append(QThread::create([&failures] {
+            for (int j = 0; j < 500; ++j) {
+                const QString number = QString::number(j % 300);
+                const QRegularExpression re("^x" + number + "(y*)$");
+                if (re.matchView(QString("x" + number + "yy")).capturedLength(1) != 2)
+                    failures.ref();
+            }
+        }));
+        threads.last()->start();
+    }
+    for (QThread *thread : std::as_const(threads))
+        QVERIFY(thread->wait());
+    qDeleteAll(threads);
+    QCOMPARE(failures.loadRelaxed(), 0);
+}
+
+void tst_QRegularExpression::matchOffsets_data()
+{
+    QTest::addColumn<QString>("pattern");
+    QTest::addColumn<QStringList>("subjects");
+
+    const QStringList subjects = {
+        "", "abc", "key=value", "key=", "=value", "a1b22c333", "über=größe",
+        "no match at all", "line\nkey=value",
+    };
+    QTest::newRow("empty") << QString() << subjects;
+    QTest::newRow("literal") << "abc" << subjects;
+    QTest::newRow("groups") << "(\\w+)=(\\w*)" << subjects;
+    QTest::newRow("optional-groups") << "(\\d)|([a-z])(x)?" << subjects;
+    QTest::newRow("anchored") << "^(\\w+)=" << subjects;
+    QTest::newRow("multiline") << "(?m)^(\\w+)=" << subjects;
+    QTest::newRow("no-subjects") << "abc" << QStringList();
+}
+
+void tst_QRegularExpression::matchOffsets()
+{
+    QFETCH(QString, pattern);
+    QFETCH(QStringList, subjects);
+
+    const QRegularExpression re(pattern);
+    QList<QStringView> views;
+    for (const QString &subject : std::as_const(subjects))
+        views.append(subject);
+
+    const QList<qsizetype> offsets = re.matchOffsets(views);
+    const qsizetype stride = 2 * (re.captureCount() + 1);
+    QCOMPARE(offsets.size(), stride * subjects.size());
+
+    for (qsizetype i = 0; i < views.size(); ++i) {
+        const QRegularExpressionMatch match = re.matchView(views[i]);
+        for (int group = 0; group <= re.captureCount(); ++group) {
+            const qsizetype start = offsets[i * stride + 2 * group];
+            const qsizetype end = offsets[i * stride + 2 * group + 1];
+            if (match.hasCaptured(group)) {
+                QCOMPARE(start, match.capturedStart(group));
+                QCOMPARE(end, match.capturedEnd(group));
+            } else {
+                QCOMPARE(start, -1);
+                QCOMPARE(end, -1);
+            }
+        }
+    }
+
+    // anchoring works as with matchView()
+    const QList<qsizetype> anchored = re.matchOffsets(views, QRegularExpression::AnchorAtOffsetMatchOption);
+    for (qsizetype i = 0; i < views.size(); ++i) {
+        const auto match = re.matchView(views[i], 0, QRegularExpression::NormalMatch,
+                                        QRegularExpression::AnchorAtOffsetMatchOption);
+        QCOMPARE(anchored[i * stride], match.hasMatch() ? match.capturedStart() : -1);
+    }
+
+    // a null view matches like an empty one
+    const QStringView null;
+    QCOMPARE(re.matchOffsets({ &null, 1 }).first() == 0, re.matchView(u"").hasMatch());
+
+    // invalid regular expressions
+    const QRegularExpression invalid("a(b");
+    QTest::ignoreMessage(QtWarningMsg, "QRegularExpression::matchOffsets(): called on an invalid "
+                                       "QRegularExpression object (pattern is 'a(b')");
+    QVERIFY(invalid.matchOffsets(views).isEmpty());
+}
+
 void tst_QRegularExpression::returnsViewsIntoOriginalString()
 {
     // https://bugreports.qt.io/browse/QTBUG-98653
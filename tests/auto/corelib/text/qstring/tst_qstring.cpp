@@ -559,6 +559,8 @@ private slots:
     void isLower_isUpper_data();
     void isLower_isUpper();
     void toCaseFolded();
+    void caseConversionLongStrings();
+    void compareCaseInsensitiveLongStrings();
     void rightJustified();
     void leftJustified();
     void mid();
@@ -3019,6 +3021,91 @@ void tst_QString::toCaseFolded()
     }
 }
 
+// Strings long enough for the vectorized US-ASCII code paths, with a
+// non-ASCII character or surrogate pair at various positions
+static QList<QStringList> mixedCaseStrings()
+{
+    const QString ascii = u"Hello World_ABCxyz0123-ZAaz@[`{"_s;
+    const QString others[] = {
+        QString(QChar(0xc4)),           // Latin-1
+        QString(QChar(0xdf)),           // grows when uppercased
+        QString(QChar(0x212a)),         // KELVIN SIGN, folds to 'k'
+        QString(QChar(0xfb03)),         // grows when uppercased or case folded
+        QString::fromUcs4(U"\U00010400"),
+        QString::fromUcs4(U"\U00010428"),
+    };
+
+    QList<QStringList> result;
+    for (qsizetype size = 0; size <= ascii.size(); ++size) {
+        QStringList atoms;
+        for (QChar ch : QStringView(ascii).first(size))
+            atoms.append(QString(ch));
+        result.append(atoms);
+        for (const QString &other : others) {
+            for (qsizetype pos = 0; pos <= size; pos += 3) {
+                QStringList copy = atoms;
+                copy.insert(pos, other);
+                result.append(copy);
+            }
+        }
+    }
+    return result;
+}
+
+void tst_QString::caseConversionLongStrings()
+{
+    for (const QStringList &atoms : mixedCaseStrings()) {
+        QString lower, upper, folded;
+        for (const QString &atom : atoms) {
+            lower += atom.toLower();
+            upper += atom.toUpper();
+            folded += atom.toCaseFolded();
+        }
+
+        const QString s = atoms.join(QString());
+        QCOMPARE(s.toLower(), lower);
+        QCOMPARE(s.toUpper(), upper);
+        QCOMPARE(s.toCaseFolded(), folded);
+        QCOMPARE(QString(s).toLower(), lower); // in-place
+        QCOMPARE(QString(s).toUpper(), upper);
+        QCOMPARE(QString(s).toCaseFolded(), folded);
+    }
+}
+
+void tst_QString::compareCaseInsensitiveLongStrings()
+{
+    const auto sign = [](int value) { return (value > 0) - (value < 0); };
+
+    for (const QStringList &atoms : mixedCaseStrings()) {
+        const QString s = atoms.join(QString());
+        const QString lower = s.toLower();
+        QCOMPARE(lower.size(), s.size());
+        QCOMPARE(s.compare(lower, Qt::CaseInsensitive), 0);
+        QCOMPARE(lower.compare(s, Qt::CaseInsensitive), 0);
+
+        // the first difference decides the result
+        for (qsizetype i = 0; i < lower.size(); ++i) {
+            if (lower.at(i).unicode() >= 0x7f)
+                continue;
+            QString other = lower;
+            other[i] = QChar(other.at(i).unicode() + 1);
+            const int expected = sign(lower.at(i).toCaseFolded().unicode()
+                                      - other.at(i).toCaseFolded().unicode());
+            QCOMPARE(sign(s.compare(other, Qt::CaseInsensitive)), expected);
+            QCOMPARE(sign(other.compare(s, Qt::CaseInsensitive)), -expected);
+            QCOMPARE(sign(s.compare(QStringView(lower).first(i), Qt::CaseInsensitive)), 1);
+
+            if (QtPrivate::isLatin1(other)) {
+                const QByteArray latin1 = other.toLatin1();
+                QCOMPARE(sign(s.compare(QLatin1StringView(latin1), Qt::CaseInsensitive)), expected);
+            }
+        }
+
+        if (QtPrivate::isLatin1(lower))
+            QCOMPARE(s.compare(QLatin1StringView(lower.toLatin1()), Qt::CaseInsensitive), 0);
+    }
+}
+
 void tst_QString::trimmed_data()
 {
     QTest::addColumn<QString>("full" );
@@ -0,0 +1,148 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <private/qstringatom_p.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Qt::StringLiterals;
+
+class tst_QStringAtom : public QObject
+{
+    Q_OBJECT
+private slots:
+    void null();
+    void string();
+    void byteArray();
+    void hash();
+    void unusedEntriesAreDropped();
+    void threads();
+};
+
+void tst_QStringAtom::null()
+{
+    QStringAtom atom;
+    QVERIFY(atom.isNull());
+    QVERIFY(atom.isEmpty());
+    QCOMPARE(atom.size(), 0);
+    QCOMPARE(atom, QStringAtom(u""));
+    QCOMPARE(QByteArrayAtom(), QByteArrayAtom(""));
+
+    // atoms that compare equal must hash equally
+    QVERIFY(QStringAtom(u"").isNull());
+    QCOMPARE(QStringAtom(u"").hash(), atom.hash());
+    QCOMPARE(qHash(QStringAtom(u""), 42), qHash(atom, 42));
+    QCOMPARE(QByteArrayAtom("").hash(), QByteArrayAtom().hash());
+
+    QHash<QStringAtom, int> hash;
+    hash[atom] = 1;
+    QCOMPARE(hash.value(QStringAtom(QString(u""_s)), -1), 1);
+}
+
+void tst_QStringAtom::string()
+{
+    const QString text = u"objectName"_s;
+    QStringAtom a(text);
+    QStringAtom b{QString(text)}; // a different allocation with the same contents
+    QStringAtom c(u"objectname");
+
+    QVERIFY(!a.isNull());
+    QCOMPARE(a.string(), text);
+    QCOMPARE(a.view(), text);
+    QCOMPARE(a.size(), text.size());
+    QCOMPARE(a, b);
+    QCOMPARE_NE(a, c);
+    QCOMPARE(a.string().constData(), b.string().constData());
+    QCOMPARE_NE(a.string().constData(), text.constData());
+
+    QStringAtom copy = a;
+    QCOMPARE(copy, a);
+    QStringAtom moved = std::move(copy);
+    QCOMPARE(moved, a);
+    moved.swap(c);
+    QCOMPARE(c, a);
+    QCOMPARE(moved.string(), u"objectname");
+}
+
+void tst_QStringAtom::byteArray()
+{
+    QByteArrayAtom a("x-request-id");
+    QByteArrayAtom b(QByteArray("x-request-") + "id");
+    QCOMPARE(a, b);
+    QCOMPARE(a.string(), "x-request-id");
+    QCOMPARE(a.string().constData(), b.string().constData());
+    QCOMPARE_NE(a, QByteArrayAtom("x-request-ID"));
+
+    // strings and byte arrays are interned separately
+    QStringAtom s(u"x-request-id");
+    QCOMPARE(s.string(), QString::fromLatin1(a.string()));
+}
+
+void tst_QStringAtom::hash()
+{
+    QStringAtom a(u"key");
+    QCOMPARE(a.hash(), QStringAtom(u"key"_s).hash());
+    QCOMPARE(a.hash(), qHash(u"key"_s, QHashSeed::globalSeed()));
+    QCOMPARE(qHash(a, 42), qHash(QStringAtom(u"key"), 42));
+
+    QHash<QStringAtom, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash[QStringAtom(QString::number(i))] = i;
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.value(QStringAtom(QString::number(i)), -1), i);
+    QVERIFY(!hash.contains(QStringAtom(u"100")));
+}
+
+void tst_QStringAtom::unusedEntriesAreDropped()
+{
+    QStringAtom kept(u"kept");
+    const QChar *keptData = kept.string().constData();
+
+    // intern lots of short-lived strings, forcing the table to sweep a few times
+    for (int i = 0; i < 10000; ++i)
+        QCOMPARE(QStringAtom(u"temporary-"_s + QString::number(i)).size(),
+                 10 + QString::number(i).size());
+
+    QCOMPARE(QStringAtom(u"kept").string().constData(), keptData);
+
+    // a string still referenced elsewhere keeps its entry alive
+    QString survivor = QStringAtom(u"survivor").string();
+    for (int i = 0; i < 10000; ++i)
+        QStringAtom(u"temporary-"_s + QString::number(i));
+    QCOMPARE(QStringAtom(u"survivor").string().constData(), survivor.constData());
+}
+
+void tst_QStringAtom::threads()
+{
+    constexpr int ThreadCount = 4;
+    constexpr int Names = 500;
+    std::vector<QList<QStringAtom>> results(ThreadCount);
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&results, t] {
+            for (int round = 0; round < 20; ++round) {
+                QList<QStringAtom> atoms;
+                for (int i = 0; i < Names; ++i)
+                    atoms.append(QStringAtom(u"name-"_s + QString::number((i + t * 7) % Names)));
+                results[t] = std::move(atoms);
+            }
+        }));
+        threads.back()->start();
+    }
+    for (auto &thread : threads)
+        QVERIFY(thread->wait());
+
+    for (int t = 1; t < ThreadCount; ++t) {
+        for (int i = 0; i < Names; ++i)
+            QCOMPARE(results[t].at(i), results[0].at((i + t * 7) % Names));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QStringAtom)
+
+#include "tst_qstringatom.moc"
@@ -144,6 +144,8 @@ private slots:
     void convertUtf8();
     void convertUtf8CharByChar_data() { convertUtf8_data(); }
     void convertUtf8CharByChar();
+    void convertUtf8LongMixed_data();
+    void convertUtf8LongMixed();
     void roundtrip_data();
     void roundtrip();
 
@@ -384,6 +386,104 @@ void tst_QStringConverter::convertUtf8CharByChar()
     QCOMPARE(reencoded, ba);
 }
 
+// Scalar conversions, for comparing with the vectorized code paths
+static QString referenceFromUtf8(QByteArrayView in, char16_t replacement, bool *ok = nullptr)
+{
+    QString result(in.size(), Qt::Uninitialized);
+    char16_t *dst = reinterpret_cast<char16_t *>(result.data());
+    const uchar *src = reinterpret_cast<const uchar *>(in.data());
+    const uchar *const end = src + in.size();
+    if (ok)
+        *ok = true;
+    while (src < end) {
+        const uchar b = *src++;
+        if (QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, dst, src, end) < 0) {
+            *dst++ = replacement;
+            if (ok)
+                *ok = false;
+        }
+    }
+    result.truncate(dst - reinterpret_cast<char16_t *>(result.data()));
+    return result;
+}
+
+static QByteArray referenceToUtf8(QStringView in, QByteArrayView replacement)
+{
+    QByteArray result(in.size() * 3, Qt::Uninitialized);
+    uchar *dst = reinterpret_cast<uchar *>(result.data());
+    const char16_t *src = in.utf16();
+    const char16_t *const end = src + in.size();
+    while (src < end) {
+        const char16_t uc = *src++;
+        if (QUtf8Functions::toUtf8<QUtf8BaseTraits>(uc, dst, src, end) < 0) {
+            memcpy(dst, replacement.data(), replacement.size());
+            dst += replacement.size();
+        }
+    }
+    result.truncate(dst - reinterpret_cast<uchar *>(result.data()));
+    return result;
+}
+
+void tst_QStringConverter::convertUtf8LongMixed_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+
+    // long enough for the vectorized code to run over several blocks
+    const QByteArray text = "Grüße, Καλημέρα, Здравствуйте, 你好，世界 — "
+                            "مرحبا, こんにちは, €100; ";
+    const struct {
+        const char *description;
+        QByteArrayView insert;
+    } inserts[] = {
+        { "none", "" },
+        { "four-byte", "\xf0\x9f\x98\x80" },
+        { "overlong-2", "\xc0\x80" },
+        { "overlong-2b", "\xc1\xbf" },
+        { "overlong-3", "\xe0\x80\x80" },
+        { "overlong-3b", "\xe0\x9f\xbf" },
+        { "surrogate", "\xed\xa0\x80" },
+        { "last-bmp", "\xef\xbf\xbf" },
+        { "too-large", "\xf5\x80\x80\x80" },
+        { "lone-continuation", "\x80" },
+        { "truncated-2", "\xc3" },
+        { "truncated-3", "\xe4\xb8" },
+        { "invalid-byte", "\xff" },
+    };
+    for (const auto &insert : inserts) {
+        for (int offset = 0; offset < 20; ++offset) {
+            QByteArray utf8 = QByteArray(offset, 'x') + text + text;
+            utf8.insert(utf8.size() / 2 + offset, insert.insert);
+            utf8 += text;
+            QTest::addRow("%s-%d", insert.description, offset) << utf8;
+        }
+    }
+}
+
+void tst_QStringConverter::convertUtf8LongMixed()
+{
+    QFETCH(const QByteArray, utf8);
+
+    bool ok;
+    const QString expected = referenceFromUtf8(utf8, QChar::ReplacementCharacter, &ok);
+    QCOMPARE(QString::fromUtf8(utf8), expected);
+    QCOMPARE(QStringDecoder(QStringDecoder::Utf8)(utf8), expected);
+    QCOMPARE(QStringDecoder(QStringDecoder::Utf8, QStringDecoder::Flag::ConvertInvalidToNull)(utf8),
+             referenceFromUtf8(utf8, QChar::Null));
+    QCOMPARE(QUtf8StringView(utf8).isValidUtf8(), ok);
+
+    QCOMPARE(expected.toUtf8(), referenceToUtf8(expected, "?"));
+    if (ok)
+        QCOMPARE(expected.toUtf8(), utf8);
+
+    // unpaired surrogates in the middle of the text
+    QString withSurrogates = expected;
+    withSurrogates.insert(withSurrogates.size() / 2, QChar(0xdc00));
+    withSurrogates.insert(withSurrogates.size() / 3, QChar(0xd800));
+    QCOMPARE(withSurrogates.toUtf8(), referenceToUtf8(withSurrogates, "?"));
+    QCOMPARE(QStringEncoder(QStringEncoder::Utf8)(withSurrogates),
+             referenceToUtf8(withSurrogates, "\xef\xbf\xbd"));
+}
+
 void tst_QStringConverter::convertL1U16()
 {
     const QLatin1StringView latin1("some plain latin1 text");
@@ -499,6 +599,17 @@ void tst_QStringConverter::convertL1U8()
         QCOMPARE(QString::fromLatin1(latin1.data(), latin1.size()),
                  QString::fromUtf8(utf8.data(), out - utf8.data()));
     }
+    {
+        // mixed text at every alignment
+        const QLatin1StringView text("Hyv\xe4\xe4 p\xe4iv\xe4\xe4, k\xe4yh\xe4n ett\xe4 tuon "
+                                     "kannettavani saunaan? \xc0\xc9\xce\xd5\xdc \xdf \xff");
+        std::array<char, 256> utf8;
+        for (qsizetype i = 0; i < text.size(); ++i) {
+            const QLatin1StringView latin1 = text.sliced(i);
+            auto out = QUtf8::convertFromLatin1(utf8.data(), latin1);
+            QCOMPARE(QByteArrayView(utf8.data(), out - utf8.data()), QString(latin1).toUtf8());
+        }
+    }
 }
 
 #if QT_CONFIG(icu)
@@ -0,0 +1,211 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QtCore/QBuffer>
+#include <QtCore/QString>
+#include <private/qstringformat_p.h>
+
+#include <limits>
+
+using namespace Qt::StringLiterals;
+
+class tst_QStringFormat : public QObject
+{
+    Q_OBJECT
+private slots:
+    void parse();
+    void strings();
+    void placeholders();
+    void integers_data();
+    void integers();
+    void doubles_data();
+    void doubles();
+    void utf8();
+    void append();
+    void device();
+};
+
+void tst_QStringFormat::parse()
+{
+    static constexpr QFormatString none(u"no placeholders, 100%");
+    static_assert(none.argumentCount() == 0);
+    static constexpr QFormatString two(u"%1: %2");
+    static_assert(two.argumentCount() == 2);
+    static constexpr QFormatString repeated("%2 %1 %2 %L1");
+    static_assert(repeated.argumentCount() == 2);
+    static constexpr QFormatString gaps(u"%3 and %10 and %99");
+    static_assert(gaps.argumentCount() == 3);
+    static constexpr QFormatString empty(u"");
+    static_assert(empty.argumentCount() == 0);
+
+    QCOMPARE(qFormat(none), u"no placeholders, 100%");
+    QCOMPARE(qFormat(empty), QString());
+}
+
+void tst_QStringFormat::strings()
+{
+    static constexpr QFormatString format(u"[%1|%2|%3|%4|%5|%6|%7]");
+    const QString string = u"string"_s;
+    const QByteArray bytes = "bytes";
+    QCOMPARE(qFormat(format, string, QStringView(u"view"), "latin1"_L1, QUtf8StringView("utf8"),
+                     bytes, "chars", u'c'),
+             u"[string|view|latin1|utf8|bytes|chars|c]");
+    QCOMPARE(qFormat(format, QChar(u'a'), 'b', u"", QString(), QByteArray(), "", string),
+             u"[a|b|||||string]");
+    // temporaries live long enough
+    QCOMPARE(qFormat(format, string + u'!', QString(3, u'x'), u"a"_s + u"b"_s, 1, 2, 3, 4),
+             u"[string!|xxx|ab|1|2|3|4]");
+}
+
+void tst_QStringFormat::placeholders()
+{
+    // the lowest placeholder gets the first argument, like QString::arg()
+    static constexpr QFormatString swapped(u"%2 before %1");
+    QCOMPARE(qFormat(swapped, u"first", u"second"), u"second before first");
+    QCOMPARE(qFormat(swapped, u"first", u"second"),
+             u"%2 before %1"_s.arg(u"first"_s, u"second"_s));
+
+    static constexpr QFormatString gaps(u"%3-%10-%3-%L99");
+    QCOMPARE(qFormat(gaps, 1, 2, 3), u"1-2-1-3");
+
+    // missing arguments leave the placeholders alone
+    QCOMPARE(qFormat(gaps, 1), u"1-%10-1-%L99");
+    QCOMPARE(qFormat(gaps), u"%3-%10-%3-%L99");
+
+    // not placeholders
+    static constexpr QFormatString notPlaceholders(u"%a %L %% %");
+    QCOMPARE(qFormat(notPlaceholders), u"%a %L %% %");
+    static constexpr QFormatString threeDigits(u"%123");
+    QCOMPARE(qFormat(threeDigits, u"x"), u"x3");
+
+    QTest::ignoreMessage(QtWarningMsg, "qFormat: 1 argument(s) missing in %1");
+    static constexpr QFormatString one(u"%1");
+    QCOMPARE(qFormat(one, 1, 2), u"1");
+}
+
+void tst_QStringFormat::integers_data()
+{
+    QTest::addColumn<qlonglong>("value");
+    QTest::addColumn<int>("fieldWidth");
+    QTest::addColumn<int>("base");
+    QTest::addColumn<char>("fill");
+
+    QTest::newRow("zero") << 0LL << 0 << 10 << ' ';
+    QTest::newRow("positive") << 1234LL << 0 << 10 << ' ';
+    QTest::newRow("negative") << -1234LL << 0 << 10 << ' ';
+    QTest::newRow("min") << std::numeric_limits<qlonglong>::min() << 0 << 10 << ' ';
+    QTest::newRow("max") << std::numeric_limits<qlonglong>::max() << 0 << 10 << ' ';
+    QTest::newRow("hex") << 0xbeefLL << 0 << 16 << ' ';
+    QTest::newRow("binary") << 5LL << 0 << 2 << ' ';
+    QTest::newRow("base36") << 123456789LL << 0 << 36 << ' ';
+    QTest::newRow("right-aligned") << 42LL << 6 << 10 << ' ';
+    QTest::newRow("left-aligned") << 42LL << -6 << 10 << '.';
+    QTest::newRow("zero-padded") << 7LL << 3 << 10 << '0';
+    QTest::newRow("zero-padded-negative") << -7LL << 4 << 10 << '0';
+    QTest::newRow("too-narrow") << 123456LL << 3 << 10 << '0';
+    QTest::newRow("left-aligned-zeros") << -7LL << -4 << 10 << '0';
+}
+
+void tst_QStringFormat::integers()
+{
+    QFETCH(qlonglong, value);
+    QFETCH(int, fieldWidth);
+    QFETCH(int, base);
+    QFETCH(char, fill);
+
+    static constexpr QFormatString format(u"<%1>");
+    const QString expected = u"<%1>"_s.arg(value, fieldWidth, base, QLatin1Char(fill));
+    QCOMPARE(qFormat(format, qFormatNumber(value, fieldWidth, base, fill)), expected);
+    if (fieldWidth == 0 && base == 10)
+        QCOMPARE(qFormat(format, value), expected);
+    if (value >= 0) {
+        QCOMPARE(qFormat(format, qFormatNumber(qulonglong(value), fieldWidth, base, fill)),
+                 expected);
+    }
+}
+
+void tst_QStringFormat::doubles_data()
+{
+    QTest::addColumn<double>("value");
+
+    QTest::newRow("zero") << 0.0;
+    QTest::newRow("negative-zero") << -0.0;
+    QTest::newRow("one") << 1.0;
+    QTest::newRow("fraction") << 0.1;
+    QTest::newRow("pi") << 3.14159265358979;
+    QTest::newRow("negative") << -2.5;
+    QTest::newRow("million") << 1e6;
+    QTest::newRow("large") << 1.5e100;
+    QTest::newRow("small") << 0.0001;
+    QTest::newRow("smaller") << 0.00001234;
+    QTest::newRow("max") << std::numeric_limits<double>::max();
+    QTest::newRow("denormal") << std::numeric_limits<double>::denorm_min();
+    QTest::newRow("inf") << qInf();
+    QTest::newRow("-inf") << -qInf();
+    QTest::newRow("nan") << qQNaN();
+}
+
+void tst_QStringFormat::doubles()
+{
+    QFETCH(double, value);
+
+    static constexpr QFormatString format(u"%1");
+    QCOMPARE(qFormat(format, value), QString::number(value));
+    QCOMPARE(qFormat(format, float(value)), QString::number(float(value)));
+}
+
+void tst_QStringFormat::utf8()
+{
+    const QString text = u"gr\u00fc\u00dfe \u4e16\u754c \U0001f600"_s;
+    const QByteArray utf8 = text.toUtf8();
+
+    static constexpr QFormatString format(u"%1|%2|%3");
+    QCOMPARE(qFormat(format, text, utf8, "\xe9t\xe9"_L1), text + u'|' + text + u"|\u00e9t\u00e9"_s);
+    QCOMPARE(qFormatUtf8(format, text, utf8, "\xe9t\xe9"_L1),
+             utf8 + '|' + utf8 + "|\xc3\xa9t\xc3\xa9");
+
+    // UTF-8 and UTF-16 format strings give the same results
+    static constexpr QFormatString utf8Format("\xc3\xa9 %1");
+    static constexpr QFormatString utf16Format(u"\u00e9 %1");
+    QCOMPARE(qFormat(utf8Format, 42), u"\u00e9 42");
+    QCOMPARE(qFormat(utf16Format, 42), u"\u00e9 42");
+    QCOMPARE(qFormatUtf8(utf8Format, text), "\xc3\xa9 " + utf8);
+    QCOMPARE(qFormatUtf8(utf16Format, text), "\xc3\xa9 " + utf8);
+}
+
+void tst_QStringFormat::append()
+{
+    static constexpr QFormatString line(u"%1=%2\n");
+    QString text;
+    QByteArray bytes;
+    QString expected;
+    for (int i = 0; i < 100; ++i) {
+        qFormatTo(text, line, i, QString(i, u'x'));
+        qFormatTo(bytes, line, i, QString(i, u'x'));
+        expected += QString::number(i) + u'=' + QString(i, u'x') + u'\n';
+    }
+    QCOMPARE(text, expected);
+    QCOMPARE(bytes, expected.toUtf8());
+
+    // appending to a shared string doesn't modify the copies
+    QString copy = text;
+    qFormatTo(text, line, u"a", u"b");
+    QCOMPARE(copy, expected);
+    QCOMPARE(text, expected + u"a=b\n"_s);
+}
+
+void tst_QStringFormat::device()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    static constexpr QFormatString format("%1 %2 %3\n");
+    QCOMPARE(qFormatTo(&buffer, format, u"\u00e9", 1.5, -3), qint64(10));
+    const QString large(10000, u'y');
+    QCOMPARE(qFormatTo(&buffer, format, large, large, large), qint64(30003));
+    QCOMPARE(buffer.data(), "\xc3\xa9 1.5 -3\n" + (large + u' ' + large + u' ' + large + u'\n').toUtf8());
+}
+
+QTEST_APPLESS_MAIN(tst_QStringFormat)
+
+#include "tst_qstringformat.moc"
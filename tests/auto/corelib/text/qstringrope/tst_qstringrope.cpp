@@ -0,0 +1,221 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QString>
+#include <private/qstringrope_p.h>
+
+using namespace Qt::StringLiterals;
+
+class tst_QStringRope : public QObject
+{
+    Q_OBJECT
+private slots:
+    void empty();
+    void construct();
+    void insertRemove();
+    void chunks();
+    void mid();
+    void implicitSharing();
+    void randomEdits_data();
+    void randomEdits();
+    void appendAndTrim();
+};
+
+static QString chunksToString(const QStringRope &rope)
+{
+    QString result;
+    for (QStringView chunk : rope.chunks()) {
+        if (chunk.isEmpty())
+            return u"<empty chunk>"_s;
+        result += chunk;
+    }
+    return result;
+}
+
+void tst_QStringRope::empty()
+{
+    QStringRope rope;
+    QVERIFY(rope.isEmpty());
+    QCOMPARE(rope.size(), 0);
+    QCOMPARE(rope.chunkCount(), 0);
+    QCOMPARE(rope.toString(), QString());
+    QCOMPARE(rope.mid(0), QString());
+    QVERIFY(rope.chunkBegin() == rope.chunkEnd());
+
+    rope.insert(0, QStringView());
+    QVERIFY(rope.isEmpty());
+
+    rope.append(u"abc");
+    rope.remove(0, 3);
+    QVERIFY(rope.isEmpty());
+    QVERIFY(rope.chunkBegin() == rope.chunkEnd());
+}
+
+void tst_QStringRope::construct()
+{
+    const QString text = u"Hello, World"_s;
+    QStringRope rope(text);
+    QCOMPARE(rope.size(), text.size());
+    QCOMPARE(rope.toString(), text);
+    for (qsizetype i = 0; i < text.size(); ++i)
+        QCOMPARE(rope.at(i), text.at(i));
+
+    // large texts get cut into several chunks
+    const QString large(100000, u'x');
+    QStringRope largeRope(large);
+    QCOMPARE(largeRope.size(), large.size());
+    QVERIFY(largeRope.chunkCount() > 1);
+    QCOMPARE(largeRope.toString(), large);
+    QCOMPARE(chunksToString(largeRope), large);
+}
+
+void tst_QStringRope::insertRemove()
+{
+    QStringRope rope;
+    rope.append(u"world");
+    rope.prepend(u"Hello ");
+    rope.insert(5, u",");
+    rope.append(u"!");
+    QCOMPARE(rope.toString(), u"Hello, world!");
+
+    rope.remove(5, 1);
+    QCOMPARE(rope.toString(), u"Hello world!");
+    rope.chop(1);
+    QCOMPARE(rope.toString(), u"Hello world");
+    rope.truncate(5);
+    QCOMPARE(rope.toString(), u"Hello");
+    rope.remove(0, 0);
+    QCOMPARE(rope.toString(), u"Hello");
+    rope.clear();
+    QVERIFY(rope.isEmpty());
+
+    // inserting a large text in the middle of another one
+    const QString a(10000, u'a');
+    const QString b(20000, u'b');
+    rope.append(a);
+    rope.insert(5000, b);
+    QCOMPARE(rope.toString(), QString(a).insert(5000, b));
+    rope.remove(4000, 22000);
+    QCOMPARE(rope.toString(), QString(8000, u'a'));
+}
+
+void tst_QStringRope::chunks()
+{
+    QStringRope rope;
+    QString expected;
+    for (int i = 0; i < 1000; ++i) {
+        const QString line = QString::number(i) + u'\n';
+        rope.append(line);
+        expected += line;
+    }
+    QCOMPARE(chunksToString(rope), expected);
+    // short appends are merged into existing chunks
+    QCOMPARE(rope.chunkCount(), 1);
+
+    qsizetype total = 0;
+    for (auto it = rope.chunkBegin(); it != rope.chunkEnd(); it++)
+        total += (*it).size();
+    QCOMPARE(total, expected.size());
+}
+
+void tst_QStringRope::mid()
+{
+    QString text;
+    for (int i = 0; i < 5000; ++i)
+        text += QString::number(i);
+    QStringRope rope;
+    // build it out of order so that chunk boundaries are all over the place
+    for (qsizetype pos = 0; pos < text.size(); pos += 7)
+        rope.insert(rope.size(), QStringView(text).sliced(pos, qMin<qsizetype>(7, text.size() - pos)));
+    rope.insert(1234, QString(5000, u'-'));
+    text.insert(1234, QString(5000, u'-'));
+    QCOMPARE(rope.toString(), text);
+
+    for (qsizetype pos : { 0, 1, 1233, 1234, 4095, 4096, 6234, 6235, 9000 }) {
+        for (qsizetype n : { -1, 0, 1, 10, 4096, 10000 })
+            QCOMPARE(rope.mid(pos, n), text.mid(pos, n));
+    }
+    QCOMPARE(rope.mid(text.size()), QString());
+}
+
+void tst_QStringRope::implicitSharing()
+{
+    QStringRope rope(QString(10000, u'a'));
+    QStringRope copy = rope;
+    copy.insert(5000, u"b");
+    rope.remove(0, 1);
+    QCOMPARE(copy.size(), 10001);
+    QCOMPARE(copy.at(5000), u'b');
+    QCOMPARE(rope.size(), 9999);
+    QCOMPARE(rope.toString(), QString(9999, u'a'));
+
+    QStringRope moved = std::move(copy);
+    QCOMPARE(moved.size(), 10001);
+    copy = moved;
+    QCOMPARE(copy.toString(), moved.toString());
+    moved.clear();
+    QCOMPARE(copy.size(), 10001);
+}
+
+void tst_QStringRope::randomEdits_data()
+{
+    QTest::addColumn<int>("maxInsert");
+    QTest::newRow("short") << 16;
+    QTest::newRow("medium") << 1000;
+    QTest::newRow("long") << 10000;
+}
+
+void tst_QStringRope::randomEdits()
+{
+    QFETCH(int, maxInsert);
+    QRandomGenerator rng(maxInsert);
+    QString reference;
+    QStringRope rope;
+    for (int round = 0; round < 2000; ++round) {
+        const qsizetype pos = rng.bounded(int(reference.size() + 1));
+        if (reference.size() < 20000 && rng.bounded(3) != 0) {
+            const QString text(rng.bounded(1, maxInsert + 1), QChar(u'a' + round % 26));
+            reference.insert(pos, text);
+            rope.insert(pos, text);
+        } else {
+            const qsizetype n = rng.bounded(int(reference.size() - pos + 1));
+            reference.remove(pos, n);
+            rope.remove(pos, n);
+        }
+        QCOMPARE(rope.size(), reference.size());
+        if (!reference.isEmpty()) {
+            const qsizetype i = rng.bounded(int(reference.size()));
+            QCOMPARE(rope.at(i), reference.at(i));
+        }
+    }
+    QCOMPARE(rope.toString(), reference);
+    QCOMPARE(chunksToString(rope), reference);
+    // chunks are coalesced, so there can't be many more than needed
+    QVERIFY2(rope.chunkCount() <= 2 * (reference.size() / 4096 + 1) + 1,
+             QByteArray::number(rope.chunkCount()));
+}
+
+void tst_QStringRope::appendAndTrim()
+{
+    // the log viewer use case: append lines at the end, drop them at the front
+    QStringRope rope;
+    QString reference;
+    for (int i = 0; i < 20000; ++i) {
+        const QString line = u"line "_s + QString::number(i) + u'\n';
+        rope.append(line);
+        reference.append(line);
+        if (rope.size() > 50000) {
+            const qsizetype n = rope.size() - 40000;
+            rope.remove(0, n);
+            reference.remove(0, n);
+        }
+    }
+    QCOMPARE(rope.toString(), reference);
+    QVERIFY(rope.chunkCount() <= 2 * (reference.size() / 4096 + 1));
+}
+
+QTEST_APPLESS_MAIN(tst_QStringRope)
+
+#include "tst_qstringrope.moc"
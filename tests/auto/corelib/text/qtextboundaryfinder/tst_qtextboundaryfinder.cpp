@@ -3,6 +3,7 @@
 
 #include <QTest>
 #include <QScopedValueRollback>
+#include <QRandomGenerator>
 
 #include <qtextboundaryfinder.h>
 #include <qfile.h>
@@ -43,6 +44,8 @@ private slots:
     void emptyText();
     void fastConstructor();
     void assignmentOperator();
+    void longText_data();
+    void longText();
     void isAtSoftHyphen_data();
     void isAtSoftHyphen();
 };
@@ -687,6 +690,19 @@ void tst_QTextBoundaryFinder::lineBoundaries_manual_data()
         QTest::newRow("data2") << testString << expectedBreakPositions
                                << expectedMandatoryBreakPositions;
     }
+    {
+        // LB25: the space ends the number; otherwise, the breaks after it
+        // would be cleared up to the "e", including the mandatory one.
+        // The number at the start of the text is only seen from its second
+        // digit on, since the text starts as if after a line feed.
+        QString testString(QString::fromUtf8("3.14 \r\n e.g."));
+        QList<int> expectedBreakPositions, expectedMandatoryBreakPositions;
+        expectedBreakPositions << 0 << 2 << 7 << 8 << 12;
+        expectedMandatoryBreakPositions << 0 << 7 << 12;
+
+        QTest::newRow("number-before-crlf") << testString << expectedBreakPositions
+                                            << expectedMandatoryBreakPositions;
+    }
 
     {
         QChar s[] = { QChar(0x000D), QChar(0x0308), QChar(0x000A), QChar(0x000A), QChar(0x0020) };
@@ -829,6 +845,73 @@ void tst_QTextBoundaryFinder::assignmentOperator()
     QCOMPARE(finder.string(), text);
 }
 
+void tst_QTextBoundaryFinder::longText_data()
+{
+    QTest::addColumn<QTextBoundaryFinder::BoundaryType>("type");
+    QTest::newRow("grapheme") << QTextBoundaryFinder::Grapheme;
+    QTest::newRow("word") << QTextBoundaryFinder::Word;
+    QTest::newRow("sentence") << QTextBoundaryFinder::Sentence;
+    QTest::newRow("line") << QTextBoundaryFinder::Line;
+}
+
+void tst_QTextBoundaryFinder::longText()
+{
+    // Long strings are segmented a window at a time; that must give the same
+    // result as segmenting all of it in one go, which happens when the finder
+    // is given a large enough buffer.
+    QFETCH(QTextBoundaryFinder::BoundaryType, type);
+
+    static const char16_t *const pieces[] = {
+        u"word ", u"Word ", u"etc. ", u"Mr. Smith ", u"e.g. this ", u"3.14 ", u"1,000 ",
+        u"end. ", u"What? ", u"Stop! ", u"(quoted) ", u"\"Hey you?\" I did. ", u"'a' ",
+        u"\n", u"\r\n", u"\r", u" ", u"  ", u"\t", u"co-op ", u"soft\u00adhyphen ",
+        u"e\u0301 ", u"\u0e20\u0e32\u0e29\u0e32\u0e44\u0e17\u0e22 ", u"\u4e2d\u6587\u5b57",
+        u"\u3002", u"\U0001F468\u200d\U0001F469\u200d\U0001F467 ", u"\U0001F1E9\U0001F1EA",
+        u"\u05d0\u05d1 ", u"a.b ", u"x", u"\u00ab quote \u00bb ",
+    };
+    QRandomGenerator rng(int(type) + 1);
+    QString text;
+    while (text.size() < 50000)
+        text += QStringView(pieces[rng.bounded(int(std::size(pieces)))]);
+
+    QTextBoundaryFinder windowed(type, text);
+    QList<uchar> buffer((text.size() + 1) * 8);
+    QTextBoundaryFinder whole(type, QStringView(text), buffer.data(), buffer.size());
+    QVERIFY(windowed.isValid());
+    QVERIFY(whole.isValid());
+
+    for (qsizetype i = 0; i <= text.size(); ++i) {
+        windowed.setPosition(i);
+        whole.setPosition(i);
+        QCOMPARE(windowed.isAtBoundary(), whole.isAtBoundary());
+        QCOMPARE(windowed.boundaryReasons(), whole.boundaryReasons());
+    }
+
+    windowed.toEnd();
+    whole.toEnd();
+    qsizetype count = 0;
+    do {
+        QCOMPARE(windowed.toPreviousBoundary(), whole.toPreviousBoundary());
+        ++count;
+    } while (whole.position() > 0);
+    QVERIFY(count > 1);
+
+    // copies compute their own windows
+    QTextBoundaryFinder copy = windowed;
+    QTextBoundaryFinder assigned(type, u"short"_s);
+    assigned = windowed;
+    copy.toStart();
+    assigned.toStart();
+    whole.toStart();
+    while (whole.toNextBoundary() != -1) {
+        QCOMPARE(copy.toNextBoundary(), whole.position());
+        QCOMPARE(assigned.toNextBoundary(), whole.position());
+    }
+    QCOMPARE(copy.toNextBoundary(), -1);
+    assigned = QTextBoundaryFinder();
+    QVERIFY(!assigned.isValid());
+}
+
 void tst_QTextBoundaryFinder::isAtSoftHyphen_data()
 {
     QTest::addColumn<QString>("testString");
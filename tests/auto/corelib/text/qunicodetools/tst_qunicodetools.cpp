@@ -4,10 +4,13 @@
 #include <QTest>
 #include <qchar.h>
 #include <qfile.h>
+#include <qrandom.h>
 #include <qstringlist.h>
 #include <private/qunicodetables_p.h>
 #include <private/qunicodetools_p.h>
 
+using namespace Qt::StringLiterals;
+
 class tst_QUnicodeTools : public QObject
 {
     Q_OBJECT
@@ -19,6 +22,7 @@ private slots:
     void wordBreakClass();
     void sentenceBreakClass_data();
     void sentenceBreakClass();
+    void incrementalCharAttributes();
 };
 
 void tst_QUnicodeTools::lineBreakClass()
@@ -195,5 +199,68 @@ void tst_QUnicodeTools::sentenceBreakClass()
     verifyCharClassPattern(str, pattern, QUnicodeTools::SentenceBreaks);
 }
 
+static QList<QCharAttributes> fullCharAttributes(QStringView str,
+                                                 QUnicodeTools::CharAttributeOptions options)
+{
+    QUnicodeTools::ScriptItemArray scriptItems;
+    QUnicodeTools::initScripts(str, &scriptItems);
+    QCharAttributes cleared;
+    memset(&cleared, 0, sizeof(QCharAttributes));
+    QList<QCharAttributes> attributes(str.size() + 1, cleared);
+    QUnicodeTools::initCharAttributes(str, scriptItems.data(), scriptItems.size(),
+                                      attributes.data(), options);
+    return attributes;
+}
+
+void tst_QUnicodeTools::incrementalCharAttributes()
+{
+    const QUnicodeTools::CharAttributeOptions options = {
+        QUnicodeTools::GraphemeBreaks, QUnicodeTools::WordBreaks, QUnicodeTools::SentenceBreaks,
+        QUnicodeTools::LineBreaks, QUnicodeTools::WhiteSpaces
+    };
+    const QStringList pieces = {
+        u"The "_s, u"quick. "_s, u"Brown? "_s, u"(fox) "_s, u"jumps!\n"_s, u"e.g. "_s,
+        u"3.14 "_s, u"\r\n"_s, u"over "_s, u"\"lazy\" "_s, u"dogs "_s, u"  "_s,
+        QString(QChar(0xe9)) + u' ', u"x"_s,
+    };
+    QRandomGenerator rng(42);
+    QString text;
+    while (text.size() < 5000)
+        text += pieces.at(rng.bounded(int(pieces.size())));
+
+    // a small window, so that there are many of them
+    QUnicodeTools::IncrementalCharAttributes incremental(options, 64);
+    incremental.setText(text);
+    auto verify = [&] {
+        const QList<QCharAttributes> expected = fullCharAttributes(text, options);
+        for (qsizetype i = 0; i <= text.size(); ++i) {
+            const QCharAttributes actual = incremental.at(i);
+            if (memcmp(&actual, &expected.at(i), sizeof(QCharAttributes)) != 0)
+                return i;
+        }
+        return qsizetype(-1);
+    };
+    QCOMPARE(verify(), -1);
+
+    for (int round = 0; round < 200; ++round) {
+        // look somewhere, so that there's a window to keep or to drop
+        incremental.at(rng.bounded(int(text.size() + 1)));
+        const qsizetype position = rng.bounded(int(text.size() + 1));
+        const qsizetype removed = rng.bounded(int(qMin<qsizetype>(text.size() - position, 20) + 1));
+        const QString added = pieces.at(rng.bounded(int(pieces.size())));
+        text.replace(position, removed, added);
+        incremental.textChanged(text, position, removed, added.size());
+
+        // whatever window was kept must still be right
+        const QList<QCharAttributes> expected = fullCharAttributes(text, options);
+        for (qsizetype i = incremental.windowStart(); i < incremental.windowEnd(); ++i) {
+            const QCharAttributes actual = incremental.at(i);
+            QVERIFY2(memcmp(&actual, &expected.at(i), sizeof(QCharAttributes)) == 0,
+                     QByteArray::number(i));
+        }
+    }
+    QCOMPARE(verify(), -1);
+}
+
 QTEST_APPLESS_MAIN(tst_QUnicodeTools)
 #include "tst_qunicodetools.moc"
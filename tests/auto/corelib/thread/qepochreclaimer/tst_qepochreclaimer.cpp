@@ -0,0 +1,186 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QAtomicPointer>
+#include <QtCore/QList>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/private/qepochreclaimer_p.h>
+#include <QTest>
+
+struct Counted
+{
+    Counted() { instances.ref(); }
+    ~Counted() { instances.deref(); }
+    int value = 42;
+    static QAtomicInt instances;
+};
+QAtomicInt Counted::instances;
+
+class tst_QEpochReclaimer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void retireWithoutReaders();
+    void guardDelaysDeletion();
+    void nestedGuards();
+    void guardInOtherThread();
+    void retireInExitedThread();
+    void retireFromDeleter();
+    void readersAndWriter();
+};
+
+void tst_QEpochReclaimer::init()
+{
+    // get rid of leftovers from earlier tests
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(QEpochReclaimer::pendingCount(), 0);
+}
+
+void tst_QEpochReclaimer::retireWithoutReaders()
+{
+    QEpochReclaimer::retire(new Counted);
+    QEpochReclaimer::retire(new Counted);
+    QCOMPARE(QEpochReclaimer::pendingCount(), 2);
+
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(QEpochReclaimer::pendingCount(), 0);
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QEpochReclaimer::guardDelaysDeletion()
+{
+    {
+        QEpochReclaimer::Guard guard;
+        QEpochReclaimer::retire(new Counted);
+        for (int i = 0; i < 5; ++i)
+            QEpochReclaimer::collect();
+        QCOMPARE(Counted::instances.loadRelaxed(), 1);
+    }
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QEpochReclaimer::nestedGuards()
+{
+    {
+        QEpochReclaimer::Guard outer;
+        {
+            QEpochReclaimer::Guard inner;
+            QEpochReclaimer::retire(new Counted);
+        }
+        for (int i = 0; i < 5; ++i)
+            QEpochReclaimer::collect();
+        QCOMPARE(Counted::instances.loadRelaxed(), 1);
+    }
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QEpochReclaimer::guardInOtherThread()
+{
+    QSemaphore entered, done;
+    QScopedPointer<QThread> thread(QThread::create([&] {
+        QEpochReclaimer::Guard guard;
+        entered.release();
+        done.acquire();
+    }));
+    thread->start();
+    entered.acquire();
+
+    QEpochReclaimer::retire(new Counted);
+    for (int i = 0; i < 5; ++i)
+        QEpochReclaimer::collect();
+    QCOMPARE(Counted::instances.loadRelaxed(), 1);
+
+    done.release();
+    QVERIFY(thread->wait());
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QEpochReclaimer::retireInExitedThread()
+{
+    // the objects are kept by the thread that retired them, but must still
+    // be collected after it is gone
+    QScopedPointer<QThread> thread(QThread::create([] {
+        for (int i = 0; i < 10; ++i)
+            QEpochReclaimer::retire(new Counted);
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QCOMPARE(QEpochReclaimer::pendingCount(), 10);
+
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(QEpochReclaimer::pendingCount(), 0);
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QEpochReclaimer::retireFromDeleter()
+{
+    // deleters run without the reclaimer's locks held, so they may retire
+    // objects themselves
+    QEpochReclaimer::retire(new Counted, [](void *p) {
+        delete static_cast<Counted *>(p);
+        QEpochReclaimer::retire(new Counted);
+    });
+
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(QEpochReclaimer::pendingCount(), 1);
+    QCOMPARE(Counted::instances.loadRelaxed(), 1);
+
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(QEpochReclaimer::pendingCount(), 0);
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QEpochReclaimer::readersAndWriter()
+{
+    // the writer keeps replacing the object while the readers read it; if
+    // an object got deleted too early, value would be garbage (and ASan
+    // would complain)
+    QAtomicPointer<Counted> current(new Counted);
+    QAtomicInt stop;
+    QAtomicInt errors;
+
+    QList<QThread *> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.append(QThread::create([&] {
+            while (!stop.loadRelaxed()) {
+                QEpochReclaimer::Guard guard;
+                if (current.loadAcquire()->value != 42)
+                    errors.ref();
+            }
+        }));
+        readers.last()->start();
+    }
+
+    for (int i = 0; i < 20000; ++i)
+        QEpochReclaimer::retire(current.fetchAndStoreOrdered(new Counted));
+
+    stop.storeRelaxed(1);
+    for (QThread *t : std::as_const(readers)) {
+        QVERIFY(t->wait());
+        delete t;
+    }
+    QCOMPARE(errors.loadRelaxed(), 0);
+
+    delete current.loadRelaxed();
+    QEpochReclaimer::collect();
+    QEpochReclaimer::collect();
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QEpochReclaimer)
+
+#include "tst_qepochreclaimer.moc"
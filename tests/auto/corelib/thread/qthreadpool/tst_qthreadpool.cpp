@@ -76,6 +76,8 @@ private slots:
     void tryStartCount();
     void priorityStart_data();
     void priorityStart();
+    void workStealing_data();
+    void workStealing();
     void waitForDone();
     void clear();
     void clearWithAutoDelete();
@@ -983,9 +985,13 @@ void tst_QThreadPool::tryStartCount()
 void tst_QThreadPool::priorityStart_data()
 {
     QTest::addColumn<int>("otherCount");
-    QTest::newRow("0") << 0;
-    QTest::newRow("1") << 1;
-    QTest::newRow("2") << 2;
+    QTest::addColumn<bool>("workStealing");
+    QTest::newRow("0") << 0 << false;
+    QTest::newRow("1") << 1 << false;
+    QTest::newRow("2") << 2 << false;
+    QTest::newRow("0, work stealing") << 0 << true;
+    QTest::newRow("1, work stealing") << 1 << true;
+    QTest::newRow("2, work stealing") << 2 << true;
 }
 
 void tst_QThreadPool::priorityStart()
@@ -1012,11 +1018,13 @@ void tst_QThreadPool::priorityStart()
     };
 
     QFETCH(int, otherCount);
+    QFETCH(bool, workStealing);
     QSemaphore sem;
     QAtomicPointer<QRunnable> firstStarted;
     QRunnable *expected;
     TestThreadPool threadPool;
     threadPool.setMaxThreadCount(1); // start only one thread at a time
+    threadPool.setWorkStealingEnabled(workStealing);
 
     // queue the holder first
     // We need to be sure that all threads are active when we
@@ -1031,6 +1039,63 @@ void tst_QThreadPool::priorityStart()
     QCOMPARE(firstStarted.loadRelaxed(), expected);
 }
 
+void tst_QThreadPool::workStealing_data()
+{
+    QTest::addColumn<int>("maxThreadCount");
+    QTest::newRow("1") << 1;
+    QTest::newRow("2") << 2;
+    QTest::newRow("8") << 8;
+}
+
+void tst_QThreadPool::workStealing()
+{
+    QFETCH(int, maxThreadCount);
+    constexpr int TaskCount = 10000;
+
+    QAtomicInt counter;
+    QAtomicInt lowPriorityRun;
+    QAtomicInt lowPriorityRanEarly;
+    TestThreadPool threadPool;
+    threadPool.setMaxThreadCount(maxThreadCount);
+    threadPool.setWorkStealingEnabled(true);
+    QVERIFY(threadPool.isWorkStealingEnabled());
+
+    // block all threads, so that everything below ends up queued
+    QSemaphore sem;
+    for (int i = 0; i < maxThreadCount; ++i)
+        threadPool.start([&sem] { sem.acquire(); });
+
+    threadPool.start([&] {
+        lowPriorityRun.storeRelaxed(1);
+        if (counter.loadRelaxed() != TaskCount)
+            lowPriorityRanEarly.storeRelaxed(1);
+    }, -1);
+    for (int i = 0; i < TaskCount; ++i)
+        threadPool.start([&counter] { counter.ref(); });
+
+    sem.release(maxThreadCount);
+    WAIT_FOR_DONE(threadPool);
+    QCOMPARE(counter.loadRelaxed(), TaskCount);
+    QCOMPARE(lowPriorityRun.loadRelaxed(), 1);
+    if (maxThreadCount == 1)
+        QCOMPARE(lowPriorityRanEarly.loadRelaxed(), 0);
+
+    // clear() and tryTake() see the runnables in the local queues
+    for (int i = 0; i < maxThreadCount; ++i)
+        threadPool.start([&sem] { sem.acquire(); });
+    for (int i = 0; i < 100; ++i)
+        threadPool.start([&counter] { counter.ref(); });
+    QRunnable *takeable = QRunnable::create([&counter] { counter.ref(); });
+    takeable->setAutoDelete(false);
+    threadPool.start(takeable);
+    QVERIFY(threadPool.tryTake(takeable));
+    delete takeable;
+    threadPool.clear();
+    sem.release(maxThreadCount);
+    WAIT_FOR_DONE(threadPool);
+    QCOMPARE(counter.loadRelaxed(), TaskCount);
+}
+
 void tst_QThreadPool::waitForDone()
 {
     QElapsedTimer total, pass;
@@ -0,0 +1,170 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/private/qconcurrenthash_p.h>
+#include <QTest>
+
+using namespace Qt::StringLiterals;
+
+class tst_QConcurrentHash : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void basics();
+    void tryInsert();
+    void grow();
+    void clear();
+    void concurrentWriters();
+    void readersAndWriters();
+};
+
+void tst_QConcurrentHash::basics()
+{
+    QConcurrentHash<QString, int> hash;
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(u"one"_s));
+    QCOMPARE(hash.value(u"one"_s), 0);
+    QCOMPARE(hash.value(u"one"_s, -1), -1);
+    QVERIFY(!hash.find(u"one"_s));
+
+    QVERIFY(hash.insert(u"one"_s, 1));
+    QVERIFY(hash.insert(u"two"_s, 2));
+    QCOMPARE(hash.size(), 2);
+    QVERIFY(hash.contains(u"one"_s));
+    QCOMPARE(hash.value(u"two"_s), 2);
+    QCOMPARE(hash.find(u"two"_s).value_or(-1), 2);
+
+    QVERIFY(!hash.insert(u"two"_s, 22));
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(hash.value(u"two"_s), 22);
+
+    QVERIFY(hash.remove(u"one"_s));
+    QVERIFY(!hash.remove(u"one"_s));
+    QCOMPARE(hash.size(), 1);
+    QVERIFY(!hash.contains(u"one"_s));
+    QCOMPARE(hash.value(u"two"_s), 22);
+}
+
+void tst_QConcurrentHash::tryInsert()
+{
+    QConcurrentHash<int, QString> hash;
+    QVERIFY(hash.tryInsert(1, u"one"_s));
+    QVERIFY(!hash.tryInsert(1, u"uno"_s));
+    QCOMPARE(hash.value(1), u"one"_s);
+    QCOMPARE(hash.size(), 1);
+}
+
+void tst_QConcurrentHash::grow()
+{
+    QConcurrentHash<int, int> hash;
+    for (int i = 0; i < 10000; ++i)
+        hash.insert(i, i * 2);
+    QCOMPARE(hash.size(), 10000);
+    for (int i = 0; i < 10000; ++i)
+        QCOMPARE(hash.value(i, -1), i * 2);
+
+    for (int i = 0; i < 10000; i += 2)
+        QVERIFY(hash.remove(i));
+    QCOMPARE(hash.size(), 5000);
+    for (int i = 0; i < 10000; ++i)
+        QCOMPARE(hash.contains(i), bool(i % 2));
+
+    QConcurrentHash<int, int> reserved(1000);
+    reserved.reserve(100000);
+    reserved.insert(1, 1);
+    QCOMPARE(reserved.value(1), 1);
+}
+
+void tst_QConcurrentHash::clear()
+{
+    QConcurrentHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(1));
+    hash.insert(1, 1);
+    QCOMPARE(hash.value(1), 1);
+}
+
+void tst_QConcurrentHash::concurrentWriters()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int PerThread = 5000;
+    QConcurrentHash<int, int> hash;
+
+    QList<QThread *> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.append(QThread::create([&hash, t] {
+            for (int i = 0; i < PerThread; ++i)
+                hash.insert(t * PerThread + i, t);
+            for (int i = 0; i < PerThread; i += 2)
+                hash.remove(t * PerThread + i);
+        }));
+        threads.last()->start();
+    }
+    for (QThread *t : std::as_const(threads)) {
+        QVERIFY(t->wait());
+        delete t;
+    }
+
+    QCOMPARE(hash.size(), ThreadCount * PerThread / 2);
+    for (int i = 0; i < ThreadCount * PerThread; ++i) {
+        if (i % 2)
+            QCOMPARE(hash.value(i, -1), i / PerThread);
+        else
+            QVERIFY(!hash.contains(i));
+    }
+}
+
+void tst_QConcurrentHash::readersAndWriters()
+{
+    // keys 0..999 are always present while the writer updates their values
+    // and adds and removes other keys, forcing the table to grow
+    QConcurrentHash<int, QString> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, QString::number(i));
+
+    QAtomicInt stop;
+    QAtomicInt errors;
+    QList<QThread *> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.append(QThread::create([&] {
+            while (!stop.loadRelaxed()) {
+                for (int i = 0; i < 1000; ++i) {
+                    std::optional<QString> v = hash.find(i);
+                    if (!v || v->toInt() % 1000 != i)
+                        errors.ref();
+                }
+            }
+        }));
+        readers.last()->start();
+    }
+
+    for (int round = 1; round < 20; ++round) {
+        for (int i = 0; i < 1000; ++i)
+            hash.insert(i, QString::number(i + round * 1000));
+        for (int i = 0; i < 1000; ++i)
+            hash.insert(round * 1000 + i, QString());
+    }
+    for (int round = 1; round < 20; ++round) {
+        for (int i = 0; i < 1000; ++i)
+            hash.remove(round * 1000 + i);
+    }
+
+    stop.storeRelaxed(1);
+    for (QThread *t : std::as_const(readers)) {
+        QVERIFY(t->wait());
+        delete t;
+    }
+    QCOMPARE(errors.loadRelaxed(), 0);
+    QCOMPARE(hash.size(), 1000);
+}
+
+QTEST_APPLESS_MAIN(tst_QConcurrentHash)
+
+#include "tst_qconcurrenthash.moc"
@@ -42,6 +42,8 @@ private Q_SLOTS:
     void floatingPointConsistency();
     void stringConsistency_data();
     void stringConsistency();
+    void caseFoldedStringConsistency_data();
+    void caseFoldedStringConsistency();
     void qhash();
     void qhash_of_empty_and_null_qstring();
     void qhash_of_empty_and_null_qbytearray();
@@ -339,6 +341,29 @@ void tst_QHashFunctions::stringConsistency()
     }
 }
 
+void tst_QHashFunctions::caseFoldedStringConsistency_data()
+{
+    stringConsistency_data();
+    QTest::newRow("short-mixed-case") << "HeLLo";
+    QTest::newRow("long-mixed-case") << QStringLiteral("AbCdEfGhIjKlMnOpQrStUvXyZ").repeated(16);
+    QTest::newRow("upper-latin1") << "DET GÅR BRA!";
+    QTest::newRow("upper-nonlatin1") << "ΕΛΛΗΝΙΚΆ";
+    QTest::newRow("kelvin-sign") << QStringView(u"\u212Aelvin and KELVIN").toString();
+    QTest::newRow("growing") << QStringView(u"Stra\u00DFe \uFB03CE").toString();
+    QTest::newRow("surrogates") << QString::fromUcs4(U"\U00010400\U00010428 DESERET \U00010401");
+    QTest::newRow("trailing-high-surrogate") << QStringView(u"ABC\xD801").toString();
+}
+
+void tst_QHashFunctions::caseFoldedStringConsistency()
+{
+    QFETCH(QString, value);
+    const QString folded = value.toCaseFolded();
+
+    QCOMPARE(qHashCaseFolded(value, seed), qHash(folded, seed));
+    QCOMPARE(qHashCaseFolded(folded, seed), qHash(folded, seed));
+    QCOMPARE(qHashCaseFolded(value.toLower(), seed), qHash(value.toLower().toCaseFolded(), seed));
+}
+
 void tst_QHashFunctions::qhash()
 {
     {
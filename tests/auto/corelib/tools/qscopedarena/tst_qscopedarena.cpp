@@ -0,0 +1,210 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/private/qarena_p.h>
+#include <QTest>
+
+using namespace Qt::StringLiterals;
+
+class tst_QScopedArena : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void current();
+    void allocate();
+    void containersUseArena();
+    void heapOnlyAllocations();
+    void growAndShrink();
+    void escapingData();
+    void releaseInOtherThread();
+    void hash();
+};
+
+void tst_QScopedArena::current()
+{
+    QCOMPARE(QScopedArena::current(), nullptr);
+    {
+        QScopedArena outer;
+        QCOMPARE(QScopedArena::current(), &outer);
+        {
+            QScopedArena inner;
+            QCOMPARE(QScopedArena::current(), &inner);
+        }
+        QCOMPARE(QScopedArena::current(), &outer);
+    }
+    QCOMPARE(QScopedArena::current(), nullptr);
+}
+
+void tst_QScopedArena::allocate()
+{
+    QScopedArena arena(4096);
+    QCOMPARE(arena.chunkCount(), 0);
+
+    void *p1 = arena.allocate(10, 1);
+    void *p2 = arena.allocate(100, 64);
+    QVERIFY(p1);
+    QVERIFY(p2);
+    QCOMPARE(quintptr(p2) % 64, 0u);
+    QCOMPARE(QScopedArena::usableSize(p1), 10);
+    QCOMPARE(QScopedArena::usableSize(p2), 100);
+    QCOMPARE(arena.chunkCount(), 1);
+
+    // fill the chunk
+    for (int i = 0; i < 100; ++i)
+        QScopedArena::release(arena.allocate(100, 8));
+    QVERIFY(arena.chunkCount() > 1);
+
+    // big blocks get their own chunk
+    const qsizetype chunks = arena.chunkCount();
+    void *big = arena.allocate(16384, 16);
+    QVERIFY(big);
+    memset(big, 0, 16384);
+    QCOMPARE(arena.chunkCount(), chunks + 1);
+
+    QScopedArena::release(big);
+    QScopedArena::release(p1);
+    QScopedArena::release(p2);
+}
+
+void tst_QScopedArena::containersUseArena()
+{
+    QScopedArena arena;
+    QCOMPARE(arena.chunkCount(), 0);
+
+    QString s = u"Hello, World"_s;
+    s.detach();
+    QList<int> list = { 1, 2, 3 };
+    QByteArray ba(100, 'x');
+    QCOMPARE(arena.chunkCount(), 1);
+
+    QCOMPARE(s, u"Hello, World"_s);
+    QCOMPARE(list, QList<int>({ 1, 2, 3 }));
+    QCOMPARE(ba.count('x'), 100);
+}
+
+void tst_QScopedArena::heapOnlyAllocations()
+{
+    QScopedArena arena;
+
+    // direct callers, like code compiled against older headers, free() the
+    // block themselves, so they only get arena memory when they ask for it
+    QArrayData *d;
+    void *p = QArrayData::allocate(&d, sizeof(int), alignof(QtPrivate::AlignedQArrayData), 10);
+    QVERIFY(p);
+    QVERIFY(!(d->flags & QArrayData::ArenaAllocated));
+    QCOMPARE(arena.chunkCount(), 0);
+    ::free(d);
+
+    p = QArrayData::allocate1(&d, 10, QArrayData::KeepSize, QArrayData::MayUseArena);
+    QVERIFY(p);
+    QVERIFY(d->flags & QArrayData::ArenaAllocated);
+    QCOMPARE(arena.chunkCount(), 1);
+
+    // growing an arena block for such a caller moves it to the heap
+    memcpy(p, "arena", 6);
+    auto pair = QArrayData::reallocateUnaligned(d, p, 1, 100, QArrayData::Grow);
+    QVERIFY(pair.first);
+    QVERIFY(!(pair.first->flags & QArrayData::ArenaAllocated));
+    QCOMPARE(static_cast<const char *>(pair.second), "arena");
+    ::free(pair.first);
+}
+
+void tst_QScopedArena::growAndShrink()
+{
+    QScopedArena arena;
+    QString s;
+    QList<QString> list;
+    for (int i = 0; i < 1000; ++i) {
+        s += QString::number(i);
+        list.append(s);
+    }
+    QCOMPARE(list.size(), 1000);
+    QVERIFY(s.startsWith(u"0123456789101112"));
+    QVERIFY(s.endsWith(u"997998999"));
+    QCOMPARE(list.at(10), u"012345678910"_s);
+
+    list.remove(1, 998);
+    list.squeeze();
+    s.squeeze();
+    QCOMPARE(list.size(), 2);
+    QCOMPARE(list.last(), s);
+}
+
+void tst_QScopedArena::escapingData()
+{
+    QString escaped;
+    QList<int> heap;
+    {
+        QScopedArena arena;
+        QString s = u"Hello"_s;
+        s += u", World";
+        escaped = s;
+        heap.append(42);
+    }
+    QCOMPARE(QScopedArena::current(), nullptr);
+    QCOMPARE(escaped, u"Hello, World"_s);
+
+    // growing it outside of the arena moves it to the heap
+    for (int i = 0; i < 100; ++i)
+        escaped += u'!';
+    QCOMPARE(escaped.size(), 112);
+    QVERIFY(escaped.startsWith(u"Hello, World!!!"));
+    heap.append(43);
+    QCOMPARE(heap, QList<int>({ 42, 43 }));
+}
+
+void tst_QScopedArena::releaseInOtherThread()
+{
+    QList<QString> strings;
+    {
+        QScopedArena arena;
+        for (int i = 0; i < 100; ++i)
+            strings.append(QString::number(i).repeated(10));
+    }
+
+    QScopedPointer<QThread> thread(QThread::create([&strings] {
+        QCOMPARE(QScopedArena::current(), nullptr);
+        QCOMPARE(strings.at(99), u"99"_s.repeated(10));
+        strings.clear();
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QVERIFY(strings.isEmpty());
+}
+
+void tst_QScopedArena::hash()
+{
+    // the hash's own storage is on the heap, but its keys are in the arena
+    QHash<QString, int> escaped;
+    {
+        QScopedArena arena;
+        QHash<QString, int> hash;
+        for (int i = 0; i < 1000; ++i)
+            hash.insert(QString::number(i), i);
+        QVERIFY(arena.chunkCount() > 0);
+        QCOMPARE(hash.size(), 1000);
+        QCOMPARE(hash.value(u"500"_s), 500);
+
+        for (int i = 0; i < 1000; i += 2)
+            hash.remove(QString::number(i));
+        hash.squeeze();
+        QCOMPARE(hash.size(), 500);
+        escaped = hash;
+    }
+
+    // the keys stay valid after the arena is gone
+    escaped.insert(u"-1"_s, -1);
+    QCOMPARE(escaped.size(), 501);
+    QCOMPARE(escaped.value(u"999"_s), 999);
+    QCOMPARE(escaped.value(u"-1"_s), -1);
+    QVERIFY(!escaped.contains(u"0"_s));
+}
+
+QTEST_APPLESS_MAIN(tst_QScopedArena)
+
+#include "tst_qscopedarena.moc"
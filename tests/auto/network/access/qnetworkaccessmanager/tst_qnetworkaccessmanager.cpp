@@ -5,9 +5,15 @@
 
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
 
 #include <QtCore/QDebug>
 
+#include <memory>
+
+using namespace Qt::StringLiterals;
+
 class tst_QNetworkAccessManager : public QObject
 {
     Q_OBJECT
@@ -17,6 +23,10 @@ public:
 
 private slots:
     void alwaysCacheRequest();
+#if QT_CONFIG(http)
+    void sharedConnectionPool_data();
+    void sharedConnectionPool();
+#endif
 };
 
 tst_QNetworkAccessManager::tst_QNetworkAccessManager()
@@ -34,5 +44,51 @@ void tst_QNetworkAccessManager::alwaysCacheRequest()
     delete reply;
 }
 
+#if QT_CONFIG(http)
+void tst_QNetworkAccessManager::sharedConnectionPool_data()
+{
+    QTest::addColumn<bool>("shared");
+    QTest::addColumn<int>("expectedConnections");
+
+    QTest::newRow("separate") << false << 2;
+    QTest::newRow("shared") << true << 1;
+}
+
+void tst_QNetworkAccessManager::sharedConnectionPool()
+{
+    QFETCH(bool, shared);
+    QFETCH(int, expectedConnections);
+
+    // a keep-alive server that counts the connections made to it
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+    int connections = 0;
+    connect(&server, &QTcpServer::newConnection, this, [&] {
+        while (QTcpSocket *socket = server.nextPendingConnection()) {
+            ++connections;
+            connect(socket, &QTcpSocket::readyRead, socket, [socket] {
+                if (socket->readAll().contains("\r\n\r\n"))
+                    socket->write("HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+            });
+        }
+    });
+
+    const QUrl url(u"http://127.0.0.1:%1/"_s.arg(server.serverPort()));
+    QNetworkAccessManager first;
+    QNetworkAccessManager second;
+    first.setSharedConnectionPoolEnabled(shared);
+    second.setSharedConnectionPoolEnabled(shared);
+    QCOMPARE(first.isSharedConnectionPoolEnabled(), shared);
+
+    for (QNetworkAccessManager *manager : { &first, &second, &first }) {
+        std::unique_ptr<QNetworkReply> reply(manager->get(QNetworkRequest(url)));
+        QTRY_VERIFY(reply->isFinished());
+        QCOMPARE(reply->error(), QNetworkReply::NoError);
+        QCOMPARE(reply->readAll(), QByteArray("ok"));
+    }
+    QCOMPARE(connections, expectedConnections);
+}
+#endif
+
 QTEST_MAIN(tst_QNetworkAccessManager)
 #include "tst_qnetworkaccessmanager.moc"
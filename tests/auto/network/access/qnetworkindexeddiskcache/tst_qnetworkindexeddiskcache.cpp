@@ -0,0 +1,322 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtNetwork/QNetworkIndexedDiskCache>
+#include <QtNetwork/QNetworkCacheMetaData>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QTemporaryDir>
+#include <QTest>
+
+#include <memory>
+
+using namespace Qt::StringLiterals;
+
+class tst_QNetworkIndexedDiskCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void insertAndLookup();
+    void prepare();
+    void remove();
+    void updateMetaData();
+    void reopen_data();
+    void reopen();
+    void expire();
+    void compact();
+    void recoverTruncatedTail();
+    void recoverGarbage();
+    void clear();
+
+private:
+    QString cacheDir() const { return tempDir->path() + "/cache"_L1; }
+    std::unique_ptr<QNetworkIndexedDiskCache> openCache() const;
+
+    std::unique_ptr<QTemporaryDir> tempDir;
+};
+
+static QUrl urlFor(int i)
+{
+    return QUrl(u"http://example.com/%1"_s.arg(i));
+}
+
+static bool insertEntry(QAbstractNetworkCache *cache, const QUrl &url, const QByteArray &data)
+{
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    QIODevice *device = cache->prepare(metaData);
+    if (!device)
+        return false;
+    device->write(data);
+    cache->insert(device);
+    return true;
+}
+
+static QByteArray readEntry(QAbstractNetworkCache *cache, const QUrl &url)
+{
+    std::unique_ptr<QIODevice> device(cache->data(url));
+    return device ? device->readAll() : QByteArray();
+}
+
+std::unique_ptr<QNetworkIndexedDiskCache> tst_QNetworkIndexedDiskCache::openCache() const
+{
+    auto cache = std::make_unique<QNetworkIndexedDiskCache>();
+    cache->setCacheDirectory(cacheDir());
+    return cache;
+}
+
+void tst_QNetworkIndexedDiskCache::init()
+{
+    tempDir = std::make_unique<QTemporaryDir>();
+    QVERIFY2(tempDir->isValid(), qPrintable(tempDir->errorString()));
+}
+
+void tst_QNetworkIndexedDiskCache::insertAndLookup()
+{
+    auto cache = openCache();
+    QCOMPARE(cache->cacheDirectory(), cacheDir() + u'/');
+    QCOMPARE(cache->cacheSize(), 0);
+    QVERIFY(!cache->data(urlFor(1)));
+    QVERIFY(!cache->metaData(urlFor(1)).isValid());
+
+    QVERIFY(insertEntry(cache.get(), urlFor(1), "one"));
+    QVERIFY(insertEntry(cache.get(), urlFor(2), "two"));
+    QVERIFY(cache->cacheSize() > 0);
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "one");
+    QCOMPARE(readEntry(cache.get(), urlFor(2)), "two");
+    QCOMPARE(cache->metaData(urlFor(2)).url(), urlFor(2));
+
+    // replacing an entry
+    QVERIFY(insertEntry(cache.get(), urlFor(1), "uno"));
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "uno");
+}
+
+void tst_QNetworkIndexedDiskCache::prepare()
+{
+    QNetworkIndexedDiskCache cache;
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(urlFor(1));
+    QTest::ignoreMessage(QtWarningMsg,
+                         "QNetworkIndexedDiskCache::prepare() The cache directory is not set");
+    QVERIFY(!cache.prepare(metaData));
+
+    cache.setCacheDirectory(cacheDir());
+    QVERIFY(!cache.prepare(QNetworkCacheMetaData()));
+    metaData.setSaveToDisk(false);
+    QVERIFY(!cache.prepare(metaData));
+    metaData.setSaveToDisk(true);
+
+    // too big
+    QHttpHeaders headers;
+    headers.append(QHttpHeaders::WellKnownHeader::ContentLength,
+                   QByteArray::number(cache.maximumCacheSize()));
+    metaData.setHeaders(headers);
+    QVERIFY(!cache.prepare(metaData));
+}
+
+void tst_QNetworkIndexedDiskCache::remove()
+{
+    {
+        auto cache = openCache();
+        QVERIFY(insertEntry(cache.get(), urlFor(1), "one"));
+        QVERIFY(insertEntry(cache.get(), urlFor(2), "two"));
+        QVERIFY(cache->remove(urlFor(1)));
+        QVERIFY(!cache->remove(urlFor(1)));
+        QVERIFY(!cache->data(urlFor(1)));
+        QCOMPARE(readEntry(cache.get(), urlFor(2)), "two");
+
+        // cancelling an insertion
+        QNetworkCacheMetaData metaData;
+        metaData.setUrl(urlFor(3));
+        QIODevice *device = cache->prepare(metaData);
+        QVERIFY(device);
+        QVERIFY(cache->remove(urlFor(3)));
+        QVERIFY(!cache->data(urlFor(3)));
+    }
+
+    // the removal has to be durable even if the index wasn't written
+    QVERIFY(QFile::remove(cacheDir() + "/cache.idx"_L1));
+    auto cache = openCache();
+    QVERIFY(!cache->data(urlFor(1)));
+    QCOMPARE(readEntry(cache.get(), urlFor(2)), "two");
+}
+
+void tst_QNetworkIndexedDiskCache::updateMetaData()
+{
+    auto cache = openCache();
+    QVERIFY(insertEntry(cache.get(), urlFor(1), "one"));
+
+    QNetworkCacheMetaData metaData = cache->metaData(urlFor(1));
+    const QDateTime expiration(QDate(2030, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    metaData.setExpirationDate(expiration);
+    cache->updateMetaData(metaData);
+    QCOMPARE(cache->metaData(urlFor(1)).expirationDate(), expiration);
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "one");
+}
+
+void tst_QNetworkIndexedDiskCache::reopen_data()
+{
+    QTest::addColumn<bool>("withIndex");
+    QTest::newRow("index") << true;
+    QTest::newRow("scan") << false;
+}
+
+void tst_QNetworkIndexedDiskCache::reopen()
+{
+    QFETCH(bool, withIndex);
+
+    qint64 size;
+    {
+        auto cache = openCache();
+        for (int i = 0; i < 100; ++i)
+            QVERIFY(insertEntry(cache.get(), urlFor(i), QByteArray::number(i)));
+        QVERIFY(cache->flush());
+        // after the index was written
+        QVERIFY(insertEntry(cache.get(), urlFor(5), "five"));
+        QVERIFY(insertEntry(cache.get(), urlFor(100), "hundred"));
+        size = cache->cacheSize();
+    }
+    if (!withIndex)
+        QVERIFY(QFile::remove(cacheDir() + "/cache.idx"_L1));
+
+    auto cache = openCache();
+    QCOMPARE(cache->cacheSize(), size);
+    for (int i = 0; i < 100; ++i) {
+        if (i != 5)
+            QCOMPARE(readEntry(cache.get(), urlFor(i)), QByteArray::number(i));
+    }
+    QCOMPARE(readEntry(cache.get(), urlFor(5)), "five");
+    QCOMPARE(readEntry(cache.get(), urlFor(100)), "hundred");
+}
+
+void tst_QNetworkIndexedDiskCache::expire()
+{
+    auto cache = openCache();
+    const QByteArray data(1000, 'x');
+    QVERIFY(insertEntry(cache.get(), urlFor(0), data));
+    const qint64 entrySize = cache->cacheSize();
+
+    // room for four entries
+    cache->setMaximumCacheSize(entrySize * 9 / 2);
+    for (int i = 1; i < 4; ++i)
+        QVERIFY(insertEntry(cache.get(), urlFor(i), data));
+    QCOMPARE(cache->cacheSize(), entrySize * 4);
+
+    // 1 is the least recently used entry after this
+    QCOMPARE(readEntry(cache.get(), urlFor(0)), data);
+    QVERIFY(insertEntry(cache.get(), urlFor(4), data));
+    QCOMPARE(cache->cacheSize(), entrySize * 4);
+    QVERIFY(!cache->data(urlFor(1)));
+    for (int i : { 0, 2, 3, 4 })
+        QCOMPARE(readEntry(cache.get(), urlFor(i)), data);
+
+    // shrinking the cache evicts down to 90% of the new size
+    cache->setMaximumCacheSize(entrySize * 2);
+    QCOMPARE(cache->cacheSize(), entrySize);
+    QCOMPARE(readEntry(cache.get(), urlFor(4)), data);
+}
+
+void tst_QNetworkIndexedDiskCache::compact()
+{
+    const QString segmentFile = cacheDir() + "/cache.dat"_L1;
+    {
+        auto cache = openCache();
+        const QByteArray data(10000, 'x');
+        for (int round = 0; round < 10; ++round) {
+            for (int i = 0; i < 10; ++i)
+                QVERIFY(insertEntry(cache.get(), urlFor(i), data + QByteArray::number(round)));
+        }
+        const qint64 before = QFileInfo(segmentFile).size();
+        QVERIFY(before > cache->cacheSize() * 5);
+
+        QVERIFY(cache->compact());
+        QVERIFY(QFileInfo(segmentFile).size() < before / 5);
+        for (int i = 0; i < 10; ++i)
+            QCOMPARE(readEntry(cache.get(), urlFor(i)), data + '9');
+
+        // still usable afterwards
+        QVERIFY(insertEntry(cache.get(), urlFor(10), "ten"));
+    }
+
+    for (bool withIndex : { true, false }) {
+        if (!withIndex)
+            QVERIFY(QFile::remove(cacheDir() + "/cache.idx"_L1));
+        auto cache = openCache();
+        for (int i = 0; i < 10; ++i)
+            QCOMPARE(readEntry(cache.get(), urlFor(i)), QByteArray(10000, 'x') + '9');
+        QCOMPARE(readEntry(cache.get(), urlFor(10)), "ten");
+    }
+}
+
+void tst_QNetworkIndexedDiskCache::recoverTruncatedTail()
+{
+    const QString segmentFile = cacheDir() + "/cache.dat"_L1;
+    {
+        auto cache = openCache();
+        QVERIFY(insertEntry(cache.get(), urlFor(1), "one"));
+        QVERIFY(cache->flush());
+        QVERIFY(insertEntry(cache.get(), urlFor(2), QByteArray(100, 'x')));
+    }
+
+    // as if we had crashed while writing the second entry
+    QFile file(segmentFile);
+    QVERIFY(file.resize(file.size() - 10));
+    const qint64 truncatedSize = file.size();
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Discarding \\d+ bytes"));
+    auto cache = openCache();
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "one");
+    QVERIFY(!cache->data(urlFor(2)));
+    QVERIFY(QFileInfo(segmentFile).size() < truncatedSize);
+
+    QVERIFY(insertEntry(cache.get(), urlFor(3), "three"));
+    QCOMPARE(readEntry(cache.get(), urlFor(3)), "three");
+}
+
+void tst_QNetworkIndexedDiskCache::recoverGarbage()
+{
+    const QString segmentFile = cacheDir() + "/cache.dat"_L1;
+    {
+        auto cache = openCache();
+        QVERIFY(insertEntry(cache.get(), urlFor(1), "one"));
+    }
+    QFile file(segmentFile);
+    QVERIFY(file.open(QIODevice::Append));
+    file.write(QByteArray(64, 'g'));
+    file.close();
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Discarding 64 bytes"));
+    auto cache = openCache();
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "one");
+    QVERIFY(insertEntry(cache.get(), urlFor(2), "two"));
+    cache.reset();
+
+    cache = openCache();
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "one");
+    QCOMPARE(readEntry(cache.get(), urlFor(2)), "two");
+}
+
+void tst_QNetworkIndexedDiskCache::clear()
+{
+    {
+        auto cache = openCache();
+        for (int i = 0; i < 10; ++i)
+            QVERIFY(insertEntry(cache.get(), urlFor(i), "data"));
+        cache->clear();
+        QCOMPARE(cache->cacheSize(), 0);
+        QVERIFY(!cache->data(urlFor(1)));
+        QVERIFY(insertEntry(cache.get(), urlFor(1), "new"));
+    }
+
+    auto cache = openCache();
+    QCOMPARE(readEntry(cache.get(), urlFor(1)), "new");
+    QVERIFY(!cache->data(urlFor(2)));
+}
+
+QTEST_MAIN(tst_QNetworkIndexedDiskCache)
+
+#include "tst_qnetworkindexeddiskcache.moc"
@@ -7,10 +7,18 @@
 
 #include <QtNetwork/qnetworkreply.h>
 #include <QtNetwork/qnetworkaccessmanager.h>
+#include <QtNetwork/qhttp1configuration.h>
+
+#include <QtCore/qtimer.h>
 
 #include "minihttpserver.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 using namespace Qt::StringLiterals;
+using namespace std::chrono_literals;
 
 /*
     The tests here are meant to be self-contained, using servers in the same
@@ -25,6 +33,8 @@ private slots:
     void get();
     void post();
 
+    void pipeliningRecoversAfterStall();
+
 #if QT_CONFIG(localserver)
     void fullServerName_data();
     void fullServerName();
@@ -113,6 +123,117 @@ void tst_QNetworkReply_local::post()
     QCOMPARE(firstRequest.receivedData.last(payload.size() + 4), "\r\n\r\n" + payload);
 }
 
+// Answers each request after a short delay, in order. The first time a
+// request arrives while the previous one on its connection is still
+// unanswered, that is, pipelined, the server stalls: it answers nothing more
+// on that connection and drops it a bit later.
+class StallingPipelineServer : public QTcpServer
+{
+    Q_OBJECT
+public:
+    StallingPipelineServer() { listen(QHostAddress::LocalHost); }
+
+    int pipelinedRequests = 0;
+    bool stalled = false;
+
+protected:
+    void incomingConnection(qintptr socketDescriptor) override
+    {
+        auto socket = new QTcpSocket(this);
+        socket->setSocketDescriptor(socketDescriptor);
+        auto buffer = std::make_shared<QByteArray>();
+        auto unanswered = std::make_shared<int>(0);
+        auto stalling = std::make_shared<bool>(false);
+        connect(socket, &QTcpSocket::readyRead, this, [=] {
+            *buffer += socket->readAll();
+            qsizetype end;
+            while (!*stalling && (end = buffer->indexOf("\r\n\r\n")) >= 0) {
+                buffer->remove(0, end + 4);
+                if ((*unanswered)++ > 0) {
+                    ++pipelinedRequests;
+                    if (!stalled) {
+                        stalled = *stalling = true;
+                        QTimer::singleShot(100ms, socket, [socket] { socket->close(); });
+                        return;
+                    }
+                }
+                QTimer::singleShot(20ms, socket, [=] {
+                    if (*stalling)
+                        return;
+                    --*unanswered;
+                    socket->write("HTTP/1.1 200 OK\r\n"
+                                  "Content-Type: text/plain\r\n"
+                                  "Content-Length: 2\r\n"
+                                  "\r\n"
+                                  "ok");
+                });
+            }
+        });
+        connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+    }
+};
+
+void tst_QNetworkReply_local::pipeliningRecoversAfterStall()
+{
+    QFETCH_GLOBAL(QString, scheme);
+    if (scheme != "http"_L1)
+        QSKIP("Only tested over TCP");
+
+    StallingPipelineServer server;
+    QVERIFY(server.isListening());
+
+    QHttp1Configuration config;
+    config.setNumberOfConnectionsPerHost(1);
+    config.setMaximumPipelineDepth(1);
+    QNetworkAccessManager manager;
+    int requestCount = 0;
+
+    // Sends \a count requests at once and returns how many of the replies
+    // were pipelined, or -1 on failure.
+    const auto sendBatch = [&](int count) {
+        std::vector<std::unique_ptr<QNetworkReply>> replies;
+        for (int i = 0; i < count; ++i) {
+            QNetworkRequest request(QUrl(u"http://127.0.0.1:%1/%2"_s.arg(server.serverPort())
+                                                 .arg(requestCount++)));
+            request.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, true);
+            request.setHttp1Configuration(config);
+            replies.emplace_back(manager.get(request));
+        }
+        const bool finished = QTest::qWaitFor([&] {
+            return std::all_of(replies.cbegin(), replies.cend(),
+                               [](const auto &reply) { return reply->isFinished(); });
+        }, 10s);
+        if (!finished)
+            return -1;
+        int pipelined = 0;
+        for (const auto &reply : replies) {
+            if (reply->error() != QNetworkReply::NoError || reply->readAll() != "ok")
+                return -1;
+            if (reply->attribute(QNetworkRequest::HttpPipeliningWasUsedAttribute).toBool())
+                ++pipelined;
+        }
+        return pipelined;
+    };
+
+    // The first reply tells the connection that the server supports
+    // pipelining, so the third request is pipelined behind the second. The
+    // server stalls, which makes the connection give up on pipelining, but
+    // both requests are sent again.
+    QVERIFY(sendBatch(3) >= 0);
+    QVERIFY(server.stalled);
+    QCOMPARE(server.pipelinedRequests, 1);
+
+    // for a while, requests are not pipelined anymore
+    QCOMPARE(sendBatch(3), 0);
+    QCOMPARE(server.pipelinedRequests, 1);
+
+    // but after enough replies without it, pipelining is tried again
+    for (int i = 0; i < 16; ++i)
+        QCOMPARE(sendBatch(1), 0);
+    QCOMPARE_GT(sendBatch(3), 0);
+    QCOMPARE_GT(server.pipelinedRequests, 1);
+}
+
 #if QT_CONFIG(localserver)
 void tst_QNetworkReply_local::fullServerName_data()
 {
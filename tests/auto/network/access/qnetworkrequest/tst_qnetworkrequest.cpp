@@ -654,6 +654,10 @@ void tst_QNetworkRequest::operatorEqual_data()
     QTest::newRow("http1Config-7-6") << data7 << data4 << false;
     QTest::newRow("http1Config-7-7") << data7 << data5 << false;
     QTest::newRow("http1Config-7-8") << data7 << data6 << false;
+    QNetworkRequest data7Pipelining = data7;
+    http1Configuration.setMaximumPipelineDepth(8);
+    data7Pipelining.setHttp1Configuration(http1Configuration);
+    QTest::newRow("http1Config-7-9") << data7 << data7Pipelining << false;
 
     QNetworkRequest data8;
     QHttp2Configuration http2Configuration;
@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QTest>
+#include <QElapsedTimer>
 #include <QVariantMap>
 #include <qjsondocument.h>
 #include <qjsonobject.h>
+#include <qjsonarray.h>
+
+using namespace Qt::StringLiterals;
 
 class BenchmarkQtJson: public QObject
 {
@@ -21,6 +25,8 @@ private Q_SLOTS:
     void parseNumbers();
     void parseJson();
     void parseJsonToVariant();
+    void parseThroughput_data();
+    void parseThroughput();
 
     void jsonObjectInsert();
     void variantMapInsert();
@@ -93,6 +99,57 @@ void BenchmarkQtJson::parseJsonToVariant()
     }
 }
 
+void BenchmarkQtJson::parseThroughput_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    // an array of event records, about 16 MB each
+    const auto makeEvents = [](QByteArrayView text, QJsonDocument::JsonFormat format) {
+        QJsonArray events;
+        for (int i = 0; i < 60000; ++i) {
+            QJsonObject event;
+            event["id"_L1] = i;
+            event["source"_L1] = "host-%1.example.com"_L1.arg(i % 97);
+            event["message"_L1] = QString::fromUtf8(text);
+            event["tags"_L1] = QJsonArray{ "alpha"_L1, "beta"_L1, "gamma"_L1 };
+            events.append(event);
+        }
+        return QJsonDocument(events).toJson(format);
+    };
+
+    const QByteArrayView ascii = "Connection from 192.168.0.1 accepted after handshake, "
+                                 "negotiated protocol version 1.3 and cipher suite "
+                                 "TLS_AES_256_GCM_SHA384 for the session";
+    const QByteArrayView escaped = "Request \"GET /index.html\" returned\n\tstatus 200 "
+                                   "with path C:\\logs\\access.log and user agent \"curl\"";
+    const QByteArrayView cjk = "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae"
+                               "\xe3\x83\xad\xe3\x82\xb0 connection accepted "
+                               "\xe6\x8e\xa5\xe7\xb6\x9a\xe3\x81\x8c\xe8\xa8\xb1"
+                               "\xe5\x8f\xaf\xe3\x81\x95\xe3\x82\x8c\xe3\x81\xbe";
+
+    QTest::newRow("ascii, compact") << makeEvents(ascii, QJsonDocument::Compact);
+    QTest::newRow("ascii, indented") << makeEvents(ascii, QJsonDocument::Indented);
+    QTest::newRow("escapes, compact") << makeEvents(escaped, QJsonDocument::Compact);
+    QTest::newRow("utf-8, compact") << makeEvents(cjk, QJsonDocument::Compact);
+}
+
+void BenchmarkQtJson::parseThroughput()
+{
+    QFETCH(QByteArray, json);
+    constexpr int Iterations = 10;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < Iterations; ++i) {
+        QJsonParseError error;
+        QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+        QCOMPARE(error.error, QJsonParseError::NoError);
+    }
+    const qint64 nsecs = qMax(timer.nsecsElapsed(), qint64(1));
+    QTest::setBenchmarkResult(qreal(json.size()) * Iterations * 1e9 / nsecs,
+                              QTest::BytesPerSecond);
+}
+
 void BenchmarkQtJson::jsonObjectInsert()
 {
     QJsonObject object;
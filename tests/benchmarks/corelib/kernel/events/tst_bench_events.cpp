@@ -5,6 +5,11 @@
 #include <qtest.h>
 #include <qtesteventloop.h>
 
+#include <private/qcoreapplication_p.h>
+
+#include <memory>
+#include <vector>
+
 class PingPong : public QObject
 {
 public:
@@ -71,6 +76,8 @@ private slots:
     void sendEvent();
     void postEvent_data();
     void postEvent();
+    void multiProducer_data();
+    void multiProducer();
 };
 
 void EventsBench::initTestCase()
@@ -145,6 +152,52 @@ void EventsBench::postEvent()
     }
 }
 
+void EventsBench::multiProducer_data()
+{
+    QTest::addColumn<int>("producers");
+    QTest::addColumn<bool>("lockFree");
+
+    for (int producers : {1, 2, 4, 8}) {
+        QTest::addRow("%d-producers-locked", producers) << producers << false;
+        QTest::addRow("%d-producers-lockfree", producers) << producers << true;
+    }
+}
+
+void EventsBench::multiProducer()
+{
+    QFETCH(int, producers);
+    QFETCH(bool, lockFree);
+
+    // queued calls from several threads to an object of the main thread
+    constexpr int CallsPerProducer = 100000;
+    const bool wasLockFree = std::exchange(QCoreApplicationPrivate::lockFreePostedEvents, lockFree);
+    const auto restore = qScopeGuard([&] {
+        QCoreApplicationPrivate::lockFreePostedEvents = wasLockFree;
+    });
+
+    QObject receiver;
+    QBENCHMARK {
+        int received = 0;
+        const int expected = producers * CallsPerProducer;
+        std::vector<std::unique_ptr<QThread>> threads;
+        for (int i = 0; i < producers; ++i) {
+            threads.emplace_back(QThread::create([&receiver, &received, expected] {
+                for (int call = 0; call < CallsPerProducer; ++call) {
+                    QMetaObject::invokeMethod(&receiver, [&received, expected] {
+                        if (++received == expected)
+                            QTestEventLoop::instance().exitLoop();
+                    }, Qt::QueuedConnection);
+                }
+            }));
+            threads.back()->start();
+        }
+        QTestEventLoop::instance().enterLoop(60);
+        for (auto &thread : threads)
+            QVERIFY(thread->wait());
+        QCOMPARE(received, expected);
+    }
+}
+
 QTEST_MAIN(EventsBench)
 
 #include "tst_bench_events.moc"
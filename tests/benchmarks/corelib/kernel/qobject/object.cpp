@@ -28,3 +28,5 @@ void Object::slot8()
 { }
 void Object::slot9()
 { }
+void Object::setValue(int)
+{ }
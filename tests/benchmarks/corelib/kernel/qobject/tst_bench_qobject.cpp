@@ -7,6 +7,9 @@
 #include <qcoreapplication.h>
 #include <qdatetime.h>
 
+#include <memory>
+#include <vector>
+
 enum {
     CreationDeletionBenckmarkConstant = 34567,
     SignalsAndSlotsBenchmarkConstant = 456789
@@ -26,6 +29,12 @@ private slots:
     void connect_disconnect_benchmark_data();
     void connect_disconnect_benchmark();
     void receiver_destroyed_benchmark();
+    void multithreaded_connect_disconnect_data();
+    void multithreaded_connect_disconnect();
+    void multithreaded_emit_data();
+    void multithreaded_emit();
+    void queued_signal_data();
+    void queued_signal();
 
     void stdAllocator();
 };
@@ -280,6 +289,98 @@ void tst_QObject::receiver_destroyed_benchmark()
     }
 }
 
+template <typename Function>
+static void runInThreads(int threadCount, Function function)
+{
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back(QThread::create(function, t));
+        threads.back()->start();
+    }
+    for (auto &thread : threads)
+        thread->wait();
+}
+
+static void addThreadCounts()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+void tst_QObject::multithreaded_connect_disconnect_data()
+{
+    addThreadCounts();
+}
+
+void tst_QObject::multithreaded_connect_disconnect()
+{
+    // Every thread connects and disconnects its own objects, so that
+    // any slowdown comes from the locks shared between unrelated objects.
+    QFETCH(int, threadCount);
+    const int iterations = 20000 / threadCount;
+    QBENCHMARK {
+        runInThreads(threadCount, [iterations](int) {
+            Object sender;
+            Object receiver;
+            for (int i = 0; i < iterations; ++i) {
+                QObject::connect(&sender, &Object::signal0, &receiver, &Object::slot0);
+                sender.emitSignal0();
+                QObject::disconnect(&sender, &Object::signal0, &receiver, &Object::slot0);
+            }
+        });
+    }
+}
+
+void tst_QObject::multithreaded_emit_data()
+{
+    addThreadCounts();
+}
+
+void tst_QObject::multithreaded_emit()
+{
+    // Objects of the main thread emitted from other threads, which
+    // have to find out which thread each receiver lives in.
+    QFETCH(int, threadCount);
+    const int iterations = 100000 / threadCount;
+    std::vector<Object> senders(threadCount);
+    std::vector<Object> receivers(threadCount);
+    for (int t = 0; t < threadCount; ++t) {
+        QObject::connect(&senders[t], &Object::signal0, &receivers[t], &Object::slot0,
+                         Qt::DirectConnection);
+    }
+    QBENCHMARK {
+        runInThreads(threadCount, [&senders, iterations](int t) {
+            for (int i = 0; i < iterations; ++i)
+                senders[t].emitSignal0();
+        });
+    }
+}
+
+void tst_QObject::queued_signal_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::newRow("queued") << int(Qt::QueuedConnection);
+    QTest::newRow("coalesced") << int(Qt::QueuedConnection | Qt::CoalescedConnection);
+}
+
+void tst_QObject::queued_signal()
+{
+    // A burst of emissions, delivered by the next round of the event loop
+    QFETCH(int, type);
+    Object sender;
+    Object receiver;
+    QObject::connect(&sender, &Object::valueChanged, &receiver, &Object::setValue,
+                     Qt::ConnectionType(type));
+    QBENCHMARK {
+        for (int i = 0; i < 10000; ++i)
+            emit sender.valueChanged(i);
+        QCoreApplication::processEvents();
+    }
+}
+
 QTEST_MAIN(tst_QObject)
 
 #include "tst_bench_qobject.moc"
@@ -0,0 +1,93 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qsocketnotifier.h>
+
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+// Measures the cost of one event dispatcher wake-up while a large number of
+// idle socket notifiers is registered. Run once as is (with QT_NO_GLIB=1 for
+// the plain poll() dispatcher) and once with QT_EVENT_DISPATCHER_EPOLL=1 to
+// compare the two QEventDispatcherUNIX backends.
+
+class tst_QSocketNotifier : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void idleNotifiers_data();
+    void idleNotifiers();
+};
+
+void tst_QSocketNotifier::initTestCase()
+{
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+void tst_QSocketNotifier::idleNotifiers_data()
+{
+    QTest::addColumn<int>("idleCount");
+
+    QTest::newRow("0") << 0;
+    QTest::newRow("100") << 100;
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+}
+
+void tst_QSocketNotifier::idleNotifiers()
+{
+    QFETCH(int, idleCount);
+
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && rlim_t(idleCount + 64) > limit.rlim_cur)
+        QSKIP("Not enough file descriptors available");
+
+    QList<int> fds;
+    QList<QSocketNotifier *> notifiers;
+    auto cleanup = qScopeGuard([&] {
+        qDeleteAll(notifiers);
+        for (int fd : std::as_const(fds))
+            ::close(fd);
+    });
+
+    for (int i = 0; i < idleCount; ++i) {
+        const int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        QVERIFY(fd != -1);
+        fds << fd;
+        notifiers << new QSocketNotifier(fd, QSocketNotifier::Read);
+    }
+
+    const int activeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    QVERIFY(activeFd != -1);
+    fds << activeFd;
+
+    qint64 activations = 0;
+    QSocketNotifier *active = new QSocketNotifier(activeFd, QSocketNotifier::Read);
+    notifiers << active;
+    connect(active, &QSocketNotifier::activated, this, [&] {
+        eventfd_t value;
+        eventfd_read(activeFd, &value);
+        ++activations;
+    });
+
+    QBENCHMARK {
+        eventfd_write(activeFd, 1);
+        QCoreApplication::processEvents();
+    }
+
+    QVERIFY(activations > 0);
+}
+
+QTEST_MAIN(tst_QSocketNotifier)
+
+#include "tst_bench_qsocketnotifier.moc"
@@ -0,0 +1,106 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTest>
+#include <QTimer>
+
+#include <memory>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// Like the idle and keepalive timers of a server with many connections
+static constexpr int TimerCount = 100'000;
+
+class tst_QTimer : public QObject
+{
+    Q_OBJECT
+private slots:
+    void restart_data();
+    void restart();
+    void startStop_data() { restart_data(); }
+    void startStop();
+    void processEvents_data() { restart_data(); }
+    void processEvents();
+
+private:
+    void createTimers(std::vector<std::unique_ptr<QTimer>> &timers);
+};
+
+void tst_QTimer::restart_data()
+{
+    QTest::addColumn<Qt::TimerType>("type");
+    QTest::addColumn<int>("interval");
+
+    QTest::newRow("precise-100ms") << Qt::PreciseTimer << 100;
+    QTest::newRow("precise-30s") << Qt::PreciseTimer << 30'000;
+    QTest::newRow("coarse-5s") << Qt::CoarseTimer << 5'000;
+    QTest::newRow("verycoarse-60s") << Qt::VeryCoarseTimer << 60'000;
+}
+
+void tst_QTimer::createTimers(std::vector<std::unique_ptr<QTimer>> &timers)
+{
+    QFETCH(Qt::TimerType, type);
+    QFETCH(int, interval);
+
+    timers.reserve(TimerCount);
+    for (int i = 0; i < TimerCount; ++i) {
+        auto timer = std::make_unique<QTimer>();
+        timer->setTimerType(type);
+        // spread the timeouts a little, as connections don't start at once
+        timer->setInterval(interval + i % 1000);
+        timer->start();
+        timers.push_back(std::move(timer));
+    }
+}
+
+void tst_QTimer::restart()
+{
+    std::vector<std::unique_ptr<QTimer>> timers;
+    createTimers(timers);
+
+    // restart every timer, as if each connection had received a packet
+    QBENCHMARK {
+        for (const auto &timer : timers)
+            timer->start();
+    }
+}
+
+void tst_QTimer::startStop()
+{
+    std::vector<std::unique_ptr<QTimer>> timers;
+    createTimers(timers);
+
+    QBENCHMARK {
+        for (const auto &timer : timers)
+            timer->stop();
+        for (const auto &timer : timers)
+            timer->start();
+    }
+}
+
+void tst_QTimer::processEvents()
+{
+    std::vector<std::unique_ptr<QTimer>> timers;
+    createTimers(timers);
+
+    // a short timer firing among all the idle ones
+    int fired = 0;
+    QTimer ticker;
+    ticker.setTimerType(Qt::PreciseTimer);
+    ticker.setInterval(1ms);
+    connect(&ticker, &QTimer::timeout, this, [&fired] { ++fired; });
+    ticker.start();
+
+    QBENCHMARK {
+        const int target = fired + 10;
+        while (fired < target)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+}
+
+QTEST_MAIN(tst_QTimer)
+
+#include "tst_bench_qtimer.moc"
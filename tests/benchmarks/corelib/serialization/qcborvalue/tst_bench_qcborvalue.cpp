@@ -1,6 +1,7 @@
 // Copyright (C) 2023 The Qt Company Ltd.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
+#include <QCborArray>
 #include <QCborMap>
 #include <QCborValue>
 
@@ -51,6 +52,11 @@ private slots:
     void constructString() { doConstruct<QString>(); }
     void constructStringView() { doConstruct<QStringView>(); }
     void constructConstCharPtr() { doConstruct<char>(); }
+
+    void fromCbor_data();
+    void fromCbor();
+    void fromRawCbor_data() { fromCbor_data(); }
+    void fromRawCbor();
 };
 
 template <typename Type>
@@ -90,6 +96,47 @@ void tst_QCborValue::doConstruct()
     }
 }
 
+void tst_QCborValue::fromCbor_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    // an array of records, each carrying one string of the given size
+    auto document = [](qsizetype count, qsizetype stringSize) {
+        QCborArray array;
+        for (qsizetype i = 0; i < count; ++i) {
+            array.append(QCborMap{
+                { "id", i },
+                { "name", QString::number(i) },
+                { "payload", QByteArray(stringSize, 'a' + i % 26) },
+            });
+        }
+        return QCborValue(array).toCbor();
+    };
+
+    QTest::newRow("10000x16") << document(10000, 16);
+    QTest::newRow("10000x1024") << document(10000, 1024);
+    QTest::newRow("100x1048576") << document(100, 1024 * 1024);
+}
+
+void tst_QCborValue::fromCbor()
+{
+    QFETCH(QByteArray, data);
+
+    QBENCHMARK {
+        [[maybe_unused]] const QCborValue v = QCborValue::fromCbor(data);
+    }
+}
+
+void tst_QCborValue::fromRawCbor()
+{
+    QFETCH(QByteArray, data);
+    const QByteArray raw = QByteArray::fromRawData(data.constData(), data.size());
+
+    QBENCHMARK {
+        [[maybe_unused]] const QCborValue v = QCborValue::fromRawCbor(raw);
+    }
+}
+
 QTEST_MAIN(tst_QCborValue)
 
 #include "tst_bench_qcborvalue.moc"
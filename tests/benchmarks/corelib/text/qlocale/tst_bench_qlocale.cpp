@@ -1,9 +1,13 @@
 // Copyright (C) 2020 The Qt Company Ltd.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
+#include <QCollator>
 #include <QLocale>
+#include <QRandomGenerator>
 #include <QTest>
 
+#include <algorithm>
+
 using namespace Qt::StringLiterals;
 
 class tst_QLocale : public QObject
@@ -37,6 +41,16 @@ private Q_SLOTS:
     void toULongLong();
     void toDouble_data();
     void toDouble();
+    void doubleToShortest_data() { doubles_data(); }
+    void doubleToShortest();
+    void shortestToDouble_data() { doubles_data(); }
+    void shortestToDouble();
+    void integerToString();
+    void collatorSort_data();
+    void collatorSort();
+
+private:
+    void doubles_data();
 };
 
 static QString data()
@@ -588,6 +602,106 @@ void tst_QLocale::toDouble()
     QCOMPARE(actual, expected);
 }
 
+void tst_QLocale::doubles_data()
+{
+    QTest::addColumn<QList<double>>("values");
+
+    // a JSON or CSV export's worth of numbers
+    constexpr int Count = 1000;
+    QRandomGenerator rng(42);
+    QList<double> integral, prices, fractions;
+    for (int i = 0; i < Count; ++i) {
+        integral.append(double(rng.bounded(1000000)));
+        prices.append(rng.bounded(1000000) / 100.0);
+        fractions.append(rng.generateDouble() * 1e-3);
+    }
+    QTest::newRow("integral") << integral;
+    QTest::newRow("prices") << prices;
+    QTest::newRow("fractions") << fractions;
+}
+
+void tst_QLocale::doubleToShortest()
+{
+    QFETCH(QList<double>, values);
+
+    QByteArray text;
+    QBENCHMARK {
+        for (double value : values)
+            text = QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+    }
+    QCOMPARE(text.toDouble(), values.last());
+}
+
+void tst_QLocale::shortestToDouble()
+{
+    QFETCH(QList<double>, values);
+
+    QByteArrayList texts;
+    for (double value : values)
+        texts.append(QByteArray::number(value, 'g', QLocale::FloatingPointShortest));
+
+    double sum = 0;
+    QBENCHMARK {
+        sum = 0;
+        for (const QByteArray &text : std::as_const(texts))
+            sum += text.toDouble();
+    }
+    QVERIFY(sum != 0);
+}
+
+void tst_QLocale::integerToString()
+{
+    QString s;
+    QBENCHMARK {
+        for (qlonglong value = 1; value < Q_INT64_C(1) << 62; value = value * 3 + 1)
+            s = QString::number(value);
+    }
+}
+
+void tst_QLocale::collatorSort_data()
+{
+    QTest::addColumn<QString>("locale");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("useSortKeys");
+
+    for (const char *locale : { "en_US", "de_DE" }) {
+        for (int count : { 100, 10000, 100000 }) {
+            QTest::addRow("%s-%d-compare", locale, count) << QString(locale) << count << false;
+            QTest::addRow("%s-%d-sort", locale, count) << QString(locale) << count << true;
+        }
+    }
+}
+
+void tst_QLocale::collatorSort()
+{
+    QFETCH(QString, locale);
+    QFETCH(int, count);
+    QFETCH(bool, useSortKeys);
+
+    // random words, with some accented and upper-case letters
+    static const char16_t letters[] = u"abcdefghijklmnopqrstuvwxyzABCZ\u00e4\u00f6\u00fc\u00df\u00e9";
+    QRandomGenerator rng(count);
+    QStringList list;
+    list.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        QString word;
+        for (int n = 3 + rng.bounded(10); n > 0; --n)
+            word += QChar(letters[rng.bounded(int(std::size(letters)) - 1)]);
+        list.append(word);
+    }
+
+    const QCollator collator((QLocale(locale)));
+    QStringList sorted;
+    QBENCHMARK {
+        sorted = list;
+        if (useSortKeys)
+            collator.sort(sorted);
+        else
+            std::sort(sorted.begin(), sorted.end(), collator);
+    }
+    QCOMPARE(sorted.size(), list.size());
+}
+
 QTEST_MAIN(tst_QLocale)
 
 #include "tst_bench_qlocale.moc"
@@ -0,0 +1,165 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QByteArrayMatcher>
+#include <QMultiStringMatcher>
+#include <QRandomGenerator>
+#include <QRegularExpression>
+#include <QTest>
+
+// Classifies log lines by whether they contain one of a set of keywords.
+class tst_QMultiStringMatcher : public QObject
+{
+    Q_OBJECT
+
+    void data();
+
+private slots:
+    void initTestCase();
+
+    void byteArrayMatchers_data() { data(); }
+    void byteArrayMatchers();
+    void regularExpression_data() { data(); }
+    void regularExpression();
+    void multiByteArrayMatcher_data() { data(); }
+    void multiByteArrayMatcher();
+    void multiStringMatcher_data() { data(); }
+    void multiStringMatcher();
+    void construction_data() { data(); }
+    void construction();
+
+private:
+    QByteArrayList lines;
+    QStringList stringLines;
+    QByteArrayList words;
+};
+
+void tst_QMultiStringMatcher::initTestCase()
+{
+    QRandomGenerator rng(42);
+    const auto randomWord = [&] {
+        QByteArray word(3 + rng.bounded(8), Qt::Uninitialized);
+        for (char &c : word)
+            c = char('a' + rng.bounded(26));
+        return word;
+    };
+
+    for (int i = 0; i < 2000; ++i)
+        words.append(randomWord());
+
+    for (int i = 0; i < 10000; ++i) {
+        QByteArray line = "2024-05-01T12:00:00.000 [worker-" + QByteArray::number(i % 16) + "] ";
+        for (int j = 0; j < 12; ++j)
+            line += words.at(rng.bounded(words.size())) + ' ';
+        lines.append(line);
+        stringLines.append(QString::fromLatin1(line));
+    }
+}
+
+void tst_QMultiStringMatcher::data()
+{
+    QTest::addColumn<QByteArrayList>("keywords");
+    QTest::addColumn<Qt::CaseSensitivity>("cs");
+
+    for (qsizetype count : { 4, 50, 500 }) {
+        const QByteArrayList keywords = words.first(count);
+        QTest::addRow("%lld", qlonglong(count)) << keywords << Qt::CaseSensitive;
+        QTest::addRow("%lld-ci", qlonglong(count)) << keywords << Qt::CaseInsensitive;
+    }
+}
+
+void tst_QMultiStringMatcher::byteArrayMatchers()
+{
+    QFETCH(QByteArrayList, keywords);
+    QFETCH(Qt::CaseSensitivity, cs);
+    if (cs == Qt::CaseInsensitive)
+        QSKIP("QByteArrayMatcher is case sensitive");
+
+    QList<QByteArrayMatcher> matchers;
+    for (const QByteArray &keyword : std::as_const(keywords))
+        matchers.append(QByteArrayMatcher(keyword));
+
+    qsizetype hits = 0;
+    QBENCHMARK {
+        hits = 0;
+        for (const QByteArray &line : std::as_const(lines)) {
+            for (const QByteArrayMatcher &matcher : std::as_const(matchers)) {
+                if (matcher.indexIn(line) >= 0) {
+                    ++hits;
+                    break;
+                }
+            }
+        }
+    }
+    QVERIFY(hits > 0);
+}
+
+void tst_QMultiStringMatcher::regularExpression()
+{
+    QFETCH(QByteArrayList, keywords);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    QStringList alternatives;
+    for (const QByteArray &keyword : std::as_const(keywords))
+        alternatives.append(QRegularExpression::escape(QString::fromLatin1(keyword)));
+    QRegularExpression re(alternatives.join(u'|'),
+                          cs == Qt::CaseInsensitive ? QRegularExpression::CaseInsensitiveOption
+                                                    : QRegularExpression::NoPatternOption);
+    re.optimize();
+
+    qsizetype hits = 0;
+    QBENCHMARK {
+        hits = 0;
+        for (const QString &line : std::as_const(stringLines))
+            hits += re.matchView(line).hasMatch();
+    }
+    QVERIFY(hits > 0);
+}
+
+void tst_QMultiStringMatcher::multiByteArrayMatcher()
+{
+    QFETCH(QByteArrayList, keywords);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    const QMultiByteArrayMatcher matcher(keywords, cs);
+    qsizetype hits = 0;
+    QBENCHMARK {
+        hits = 0;
+        for (const QByteArray &line : std::as_const(lines))
+            hits += matcher.match(line).isValid();
+    }
+    QVERIFY(hits > 0);
+}
+
+void tst_QMultiStringMatcher::multiStringMatcher()
+{
+    QFETCH(QByteArrayList, keywords);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    QStringList patterns;
+    for (const QByteArray &keyword : std::as_const(keywords))
+        patterns.append(QString::fromLatin1(keyword));
+    const QMultiStringMatcher matcher(patterns, cs);
+    qsizetype hits = 0;
+    QBENCHMARK {
+        hits = 0;
+        for (const QString &line : std::as_const(stringLines))
+            hits += matcher.match(line).isValid();
+    }
+    QVERIFY(hits > 0);
+}
+
+void tst_QMultiStringMatcher::construction()
+{
+    QFETCH(QByteArrayList, keywords);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    QBENCHMARK {
+        const QMultiByteArrayMatcher matcher(keywords, cs);
+        Q_UNUSED(matcher);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QMultiStringMatcher)
+
+#include "tst_bench_qmultistringmatcher.moc"
@@ -28,6 +28,11 @@ private slots:
     void toCaseFolded_data();
     void toCaseFolded();
 
+    void compareCaseInsensitive_data();
+    void compareCaseInsensitive();
+    void qHashCaseFolded_data();
+    void qHashCaseFolded();
+
     // Serializing:
     void number_qlonglong_data();
     void number_qlonglong() { number_impl<qlonglong>(); }
@@ -197,6 +202,56 @@ void tst_QString::toCaseFolded()
     }
 }
 
+void tst_QString::compareCaseInsensitive_data()
+{
+    QTest::addColumn<QString>("lhs");
+    QTest::addColumn<QString>("rhs");
+
+    const QString identifier = u"applicationDisplayName"_s;
+    const QString longIdentifier = u"QNetworkAccessManager_autoDeleteReplies_transferTimeout"_s;
+
+    QTest::newRow("identifier-same") << identifier << identifier;
+    QTest::newRow("identifier-upper") << identifier << identifier.toUpper();
+    QTest::newRow("identifier-differs-at-end") << identifier << identifier.chopped(1) + u'X';
+    QTest::newRow("long-identifier-upper") << longIdentifier << longIdentifier.toUpper();
+    QTest::newRow("600<a>-600<A>") << QString(600, u'a') << QString(600, u'A');
+    QTest::newRow("600<a>-with-non-ascii") << QString(300, u'a') + u'\u00e9' + QString(299, u'a')
+                                           << QString(300, u'A') + u'\u00c9' + QString(299, u'A');
+    QTest::newRow("300<10428>-300<10400>")
+            << QString::fromUcs4(U"\U00010428").repeated(150)
+            << QString::fromUcs4(U"\U00010400").repeated(150);
+}
+
+void tst_QString::compareCaseInsensitive()
+{
+    QFETCH(QString, lhs);
+    QFETCH(QString, rhs);
+
+    QBENCHMARK {
+        [[maybe_unused]] auto r = lhs.compare(rhs, Qt::CaseInsensitive);
+    }
+}
+
+void tst_QString::qHashCaseFolded_data()
+{
+    QTest::addColumn<QString>("s");
+
+    QTest::newRow("identifier-folded") << u"applicationdisplayname"_s;
+    QTest::newRow("identifier") << u"applicationDisplayName"_s;
+    QTest::newRow("long-identifier") << u"QNetworkAccessManager_autoDeleteReplies_transferTimeout"_s;
+    QTest::newRow("600<A>") << QString(600, u'A');
+    QTest::newRow("300<10400>") << QString::fromUcs4(U"\U00010400").repeated(150);
+}
+
+void tst_QString::qHashCaseFolded()
+{
+    QFETCH(QString, s);
+
+    QBENCHMARK {
+        [[maybe_unused]] auto r = ::qHashCaseFolded(s, 42);
+    }
+}
+
 template <typename Integer>
 void tst_QString::number_impl()
 {
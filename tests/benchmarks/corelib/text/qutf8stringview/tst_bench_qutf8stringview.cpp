@@ -36,6 +36,13 @@ private slots:
     void compareStringsWithErrors_data();
     void compareStringsWithErrors();
 
+    void fromUtf8_data() { convertStrings_data(); }
+    void fromUtf8();
+    void toUtf8_data() { convertStrings_data(); }
+    void toUtf8();
+    void isValidUtf8_data() { convertStrings_data(); }
+    void isValidUtf8();
+
 private:
     void equalStrings_data();
     void compareStringsCaseSensitive_data();
@@ -43,6 +50,7 @@ private:
     void compareStringsLatin1(bool caseSensitive);
     void compareStringsUtf16(bool caseSensitive);
     void compareStringsUtf8(bool caseSensitive);
+    void convertStrings_data();
 };
 
 void tst_QUtf8StringView::equalStrings_data()
@@ -258,6 +266,60 @@ void tst_QUtf8StringView::compareStringsWithErrors()
     QCOMPARE(-result, rhv.compare(lhv, cs));
 }
 
+void tst_QUtf8StringView::convertStrings_data()
+{
+    QTest::addColumn<QString>("text");
+
+    auto addRow = [](const char *name, QStringView sample) {
+        QString text;
+        while (text.size() < 4096)
+            text += sample;
+        QTest::newRow(name) << text;
+    };
+    addRow("ascii", u"The quick brown fox jumps over the lazy dog. ");
+    addRow("latin1", u"Hyv\u00e4\u00e4 p\u00e4iv\u00e4\u00e4, k\u00e4yh\u00e4n ett\u00e4 tuon "
+                     u"kannettavani saunaan? ");
+    addRow("greek", u"\u039a\u03b1\u03bb\u03b7\u03bc\u03ad\u03c1\u03b1 \u03ba\u03cc\u03c3\u03bc\u03b5 ");
+    addRow("cjk", u"\u4f60\u597d\uff0c\u4e16\u754c\u3002\u3053\u3093\u306b\u3061\u306f");
+    addRow("mixed", u"Price: 100\u20ac, \u4e16\u754c, \u00e9t\u00e9 ");
+    addRow("emoji", u"Hello \U0001f600 world \U0001f30d ");
+}
+
+void tst_QUtf8StringView::fromUtf8()
+{
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+    QString result;
+
+    QBENCHMARK {
+        result = QString::fromUtf8(utf8);
+    }
+    QCOMPARE(result, text);
+}
+
+void tst_QUtf8StringView::toUtf8()
+{
+    QFETCH(QString, text);
+    QByteArray result;
+
+    QBENCHMARK {
+        result = text.toUtf8();
+    }
+    QCOMPARE(QString::fromUtf8(result), text);
+}
+
+void tst_QUtf8StringView::isValidUtf8()
+{
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+    bool result;
+
+    QBENCHMARK {
+        result = QByteArrayView(utf8).isValidUtf8();
+    }
+    QVERIFY(result);
+}
+
 QTEST_MAIN(tst_QUtf8StringView)
 
 #include "tst_bench_qutf8stringview.moc"
@@ -15,6 +15,8 @@ public:
 private slots:
     void startRunnables();
     void activeThreadCount();
+    void manyTinyTasks_data();
+    void manyTinyTasks();
 };
 
 tst_QThreadPool::tst_QThreadPool()
@@ -50,6 +52,37 @@ void tst_QThreadPool::activeThreadCount()
     }
 }
 
+void tst_QThreadPool::manyTinyTasks_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<bool>("workStealing");
+
+    for (int threadCount = 1; threadCount <= 128; threadCount *= 2) {
+        QTest::addRow("%d threads, shared queue", threadCount) << threadCount << false;
+        QTest::addRow("%d threads, work stealing", threadCount) << threadCount << true;
+    }
+}
+
+void tst_QThreadPool::manyTinyTasks()
+{
+    QFETCH(int, threadCount);
+    QFETCH(bool, workStealing);
+    constexpr int TaskCount = 100000;
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+    threadPool.setWorkStealingEnabled(workStealing);
+
+    QAtomicInt counter;
+    QBENCHMARK {
+        counter.storeRelaxed(0);
+        for (int i = 0; i < TaskCount; ++i)
+            threadPool.start([&counter] { counter.ref(); });
+        threadPool.waitForDone();
+    }
+    QCOMPARE(counter.loadRelaxed(), TaskCount);
+}
+
 QTEST_MAIN(tst_QThreadPool)
 
 #include "tst_bench_qthreadpool.moc"
@@ -3,6 +3,7 @@
 #include <QString>
 #include <QMap>
 #include <QHash>
+#include <QtCore/private/qarena_p.h>
 
 #include <qtest.h>
 
@@ -14,6 +15,8 @@ private slots:
     void insert();
     void lookup_data();
     void lookup();
+    void insertStrings_data();
+    void insertStrings();
 };
 
 template <typename T>
@@ -103,6 +106,35 @@ void tst_associative_containers::lookup()
     }
 }
 
+void tst_associative_containers::insertStrings_data()
+{
+    QTest::addColumn<bool>("useArena");
+    QTest::addColumn<int>("size");
+
+    for (int size : { 10, 1000, 100000 }) {
+        const QByteArray sizeString = QByteArray::number(size);
+        QTest::newRow(QByteArray("heap--" + sizeString).constData()) << false << size;
+        QTest::newRow(QByteArray("arena--" + sizeString).constData()) << true << size;
+    }
+}
+
+void tst_associative_containers::insertStrings()
+{
+    QFETCH(bool, useArena);
+    QFETCH(int, size);
+
+    QBENCHMARK {
+        std::optional<QScopedArena> arena;
+        if (useArena)
+            arena.emplace();
+
+        QHash<QString, int> hash;
+        for (int i = 0; i < size; ++i)
+            hash.insert(QString::number(i), i);
+        QCOMPARE(hash.size(), size);
+    }
+}
+
 QTEST_MAIN(tst_associative_containers)
 
 #include "tst_bench_containers_associative.moc"
@@ -4,6 +4,7 @@
 
 #include <QtCore>
 #include <QList>
+#include <QtCore/private/qarena_p.h>
 #include <vector>
 
 #include <qtest.h>
@@ -124,6 +125,8 @@ private slots:
     void lookup_int();
     void lookup_Large_data();
     void lookup_Large();
+    void buildStrings_data();
+    void buildStrings();
 };
 
 void tst_vector_vs_std::insert_int_data()
@@ -218,6 +221,37 @@ void tst_vector_vs_std::lookup_Large()
         useCases_QList_Large->lookup(size);
 }
 
+void tst_vector_vs_std::buildStrings_data()
+{
+    QTest::addColumn<bool>("useArena");
+    QTest::addColumn<int>("size");
+
+    for (int size : { 10, 1000, 100000 }) {
+        const QByteArray sizeString = QByteArray::number(size);
+        QTest::newRow(QByteArray("heap--" + sizeString).constData()) << false << size;
+        QTest::newRow(QByteArray("arena--" + sizeString).constData()) << true << size;
+    }
+}
+
+// Use case: build a response from many short strings and throw it all away
+void tst_vector_vs_std::buildStrings()
+{
+    QFETCH(bool, useArena);
+    QFETCH(int, size);
+
+    QBENCHMARK {
+        std::optional<QScopedArena> arena;
+        if (useArena)
+            arena.emplace();
+
+        QList<QString> parts;
+        for (int i = 0; i < size; ++i)
+            parts.append(u"item-" + QString::number(i));
+        QString joined = parts.join(u',');
+        f(&joined);
+    }
+}
+
 QTEST_MAIN(tst_vector_vs_std)
 
 #include "tst_bench_containers_sequential.moc"
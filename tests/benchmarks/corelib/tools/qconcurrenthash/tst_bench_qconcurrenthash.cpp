@@ -0,0 +1,111 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/private/qconcurrenthash_p.h>
+#include <QTest>
+
+// A shared cache of strings, read from many threads and updated once in a
+// while: every thread does WritePeriod - 1 lookups for each insertion.
+static constexpr int KeyCount = 10000;
+static constexpr int OperationsPerThread = 100000;
+static constexpr int WritePeriod = 100;
+
+// keeps the compiler from optimizing the lookups away
+static QAtomicInteger<qsizetype> sink;
+
+class LockedHash
+{
+public:
+    QString value(int key) const
+    {
+        QReadLocker locker(&lock);
+        return hash.value(key);
+    }
+    void insert(int key, const QString &value)
+    {
+        QWriteLocker locker(&lock);
+        hash.insert(key, value);
+    }
+
+private:
+    mutable QReadWriteLock lock;
+    QHash<int, QString> hash;
+};
+
+class tst_QConcurrentHash : public QObject
+{
+    Q_OBJECT
+
+private:
+    template <typename Hash> void run(Hash &hash, int threadCount);
+
+private slots:
+    void readMostly_data();
+    void readMostly();
+};
+
+template <typename Hash>
+void tst_QConcurrentHash::run(Hash &hash, int threadCount)
+{
+    for (int i = 0; i < KeyCount; ++i)
+        hash.insert(i, QString::number(i));
+
+    QBENCHMARK {
+        QList<QThread *> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.append(QThread::create([&hash, t] {
+                uint key = uint(t) * 7919;
+                qsizetype total = 0;
+                for (int i = 0; i < OperationsPerThread; ++i) {
+                    key = (key * 1103515245 + 12345) % KeyCount;
+                    if (i % WritePeriod == 0)
+                        hash.insert(int(key), QString::number(i));
+                    else
+                        total += hash.value(int(key)).size();
+                }
+                sink.fetchAndAddRelaxed(total);
+            }));
+        }
+        for (QThread *t : std::as_const(threads))
+            t->start();
+        for (QThread *t : std::as_const(threads)) {
+            t->wait();
+            delete t;
+        }
+    }
+}
+
+void tst_QConcurrentHash::readMostly_data()
+{
+    QTest::addColumn<bool>("concurrent");
+    QTest::addColumn<int>("threadCount");
+
+    for (int threadCount : { 1, 2, 4, 8, 16, 32, 64 }) {
+        const QByteArray count = QByteArray::number(threadCount);
+        QTest::newRow(QByteArray("QHash+QReadWriteLock--" + count).constData()) << false << threadCount;
+        QTest::newRow(QByteArray("QConcurrentHash--" + count).constData()) << true << threadCount;
+    }
+}
+
+void tst_QConcurrentHash::readMostly()
+{
+    QFETCH(bool, concurrent);
+    QFETCH(int, threadCount);
+
+    if (concurrent) {
+        QConcurrentHash<int, QString> hash;
+        run(hash, threadCount);
+    } else {
+        LockedHash hash;
+        run(hash, threadCount);
+    }
+}
+
+QTEST_MAIN(tst_QConcurrentHash)
+
+#include "tst_bench_qconcurrenthash.moc"
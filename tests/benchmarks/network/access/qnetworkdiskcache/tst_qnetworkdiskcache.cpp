@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QNetworkDiskCache>
+#include <QNetworkIndexedDiskCache>
 #include <QNetworkCacheMetaData>
 #include <QDir>
 #include <QBuffer>
@@ -15,12 +16,16 @@
 
 
 enum Numbers { NumFakeCacheObjects   = 200,    //entries in pre-populated cache
+               NumStartupCacheObjects = 200000, //entries in a cache that has been used for long
                NumInsertions  = 100,           //insertions to be timed
                NumRemovals    = 100,           //removals to be timed
                NumReadContent = 100,           //meta requests to be timed
                HugeCacheLimit = 50*1024*1024,  // max size for a big cache
                TinyCacheLimit = 1*512*1024}; //  max size for a tiny cache
 
+enum class Backend { Files, Indexed };
+Q_DECLARE_METATYPE(Backend)
+
 const QString fakeURLbase = "http://127.0.0.1/fake/";
 //fake HTTP body aka payload
 const QByteArray payload("Qt rocks!");
@@ -29,14 +34,17 @@ class tst_qnetworkdiskcache : public QObject
 {
     Q_OBJECT
 private:
-    void injectFakeData();
+    void injectFakeData(quint32 count = NumFakeCacheObjects);
     void insertOneItem();
     bool isUrlCached(quint32 id);
     void cleanRecursive(QString &path);
     void cleanupCacheObject();
-    void initCacheObject();
+    void initCacheObject(Backend backend);
+    void setCacheDirectory(const QString &path);
+    void setMaximumCacheSize(qint64 size);
+    void addRows();
     QString cacheDir;
-    QNetworkDiskCache *cache;
+    QAbstractNetworkCache *cache;
 
 public slots:
     void initTestCase();
@@ -53,6 +61,9 @@ private slots:
 
     void timeExpiration_data();
     void timeExpiration();
+
+    void timeStartup_data();
+    void timeStartup();
 };
 
 
@@ -70,10 +81,7 @@ void tst_qnetworkdiskcache::cleanupTestCase()
 
 void tst_qnetworkdiskcache::timeInsertion_data()
 {
-    QTest::addColumn<QString>("cacheRootDirectory");
-
-    QString cacheLoc = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
-    QTest::newRow("QStandardPaths Cache Location") << cacheLoc;
+    addRows();
 }
 
 //This functions times an insert() operation.
@@ -84,6 +92,7 @@ void tst_qnetworkdiskcache::timeInsertion()
 {
 
     QFETCH(QString, cacheRootDirectory);
+    QFETCH(Backend, backend);
 
     cacheDir = QString( cacheRootDirectory + QDir::separator() + "man_qndc");
     QDir d;
@@ -91,10 +100,10 @@ void tst_qnetworkdiskcache::timeInsertion()
 
     //Housekeeping
     cleanRecursive(cacheDir); // slow op.
-    initCacheObject();
+    initCacheObject(backend);
 
-    cache->setCacheDirectory(cacheDir);
-    cache->setMaximumCacheSize(qint64(HugeCacheLimit));
+    setCacheDirectory(cacheDir);
+    setMaximumCacheSize(qint64(HugeCacheLimit));
     cache->clear();
 
     //populate some fake data to simulate partially full cache
@@ -131,10 +140,7 @@ void tst_qnetworkdiskcache::timeInsertion()
 
 void tst_qnetworkdiskcache::timeRead_data()
 {
-    QTest::addColumn<QString>("cacheRootDirectory");
-
-    QString cacheLoc = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
-    QTest::newRow("QStandardPaths Cache Location") << cacheLoc;
+    addRows();
 }
 
 //Times metadata as well payload lookup
@@ -143,6 +149,7 @@ void tst_qnetworkdiskcache::timeRead()
 {
 
     QFETCH(QString, cacheRootDirectory);
+    QFETCH(Backend, backend);
 
     cacheDir = QString( cacheRootDirectory + QDir::separator() + "man_qndc");
     QDir d;
@@ -150,9 +157,9 @@ void tst_qnetworkdiskcache::timeRead()
 
     //Housekeeping
     cleanRecursive(cacheDir); // slow op.
-    initCacheObject();
-    cache->setCacheDirectory(cacheDir);
-    cache->setMaximumCacheSize(qint64(HugeCacheLimit));
+    initCacheObject(backend);
+    setCacheDirectory(cacheDir);
+    setMaximumCacheSize(qint64(HugeCacheLimit));
     cache->clear();
 
     //populate some fake data to simulate partially full cache
@@ -190,27 +197,25 @@ void tst_qnetworkdiskcache::timeRead()
 
 void tst_qnetworkdiskcache::timeRemoval_data()
 {
-    QTest::addColumn<QString>("cacheRootDirectory");
-
-    QString cacheLoc = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
-    QTest::newRow("QStandardPaths Cache Location") << cacheLoc;
+    addRows();
 }
 
 void tst_qnetworkdiskcache::timeRemoval()
 {
 
     QFETCH(QString, cacheRootDirectory);
+    QFETCH(Backend, backend);
 
     cacheDir = QString( cacheRootDirectory + QDir::separator() + "man_qndc");
     QDir d;
     qDebug() << "Setting cache directory to = " << d.absoluteFilePath(cacheDir);
 
     //Housekeeping
-    initCacheObject();
+    initCacheObject(backend);
     cleanRecursive(cacheDir); // slow op.
-    cache->setCacheDirectory(cacheDir);
+    setCacheDirectory(cacheDir);
     // Make max cache size HUGE, so that evictions don't happen below
-    cache->setMaximumCacheSize(qint64(HugeCacheLimit));
+    setMaximumCacheSize(qint64(HugeCacheLimit));
     cache->clear();
 
     //populate some fake data to simulate partially full cache
@@ -240,27 +245,25 @@ void tst_qnetworkdiskcache::timeRemoval()
 
 void tst_qnetworkdiskcache::timeExpiration_data()
 {
-    QTest::addColumn<QString>("cacheRootDirectory");
-
-    QString cacheLoc = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
-    QTest::newRow("QStandardPaths Cache Location") << cacheLoc;
+    addRows();
 }
 
 void tst_qnetworkdiskcache::timeExpiration()
 {
 
     QFETCH(QString, cacheRootDirectory);
+    QFETCH(Backend, backend);
 
     cacheDir = QString( cacheRootDirectory + QDir::separator() + "man_qndc");
     QDir d;
     qDebug() << "Setting cache directory to = " << d.absoluteFilePath(cacheDir);
 
     //Housekeeping
-    initCacheObject();
+    initCacheObject(backend);
     cleanRecursive(cacheDir); // slow op.
-    cache->setCacheDirectory(cacheDir);
+    setCacheDirectory(cacheDir);
     // Make max cache size HUGE, so that evictions don't happen below
-    cache->setMaximumCacheSize(qint64(HugeCacheLimit));
+    setMaximumCacheSize(qint64(HugeCacheLimit));
     cache->clear();
 
     //populate some fake data to simulate partially full cache
@@ -273,7 +276,7 @@ void tst_qnetworkdiskcache::timeExpiration()
 
 
     //Set cache limit lower, so this force 1 round of eviction
-    cache->setMaximumCacheSize(qint64(TinyCacheLimit));
+    setMaximumCacheSize(qint64(TinyCacheLimit));
 
     //time insertions of additional content, which is likely to internally cause evictions
     QBENCHMARK_ONCE {
@@ -299,11 +302,67 @@ void tst_qnetworkdiskcache::timeExpiration()
     cleanRecursive(cacheDir);
 
 }
+
+void tst_qnetworkdiskcache::timeStartup_data()
+{
+    QTest::addColumn<QString>("cacheRootDirectory");
+    QTest::addColumn<Backend>("backend");
+    QTest::addColumn<quint32>("entries");
+
+    const QString cacheLoc = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    for (quint32 entries : { quint32(NumFakeCacheObjects), quint32(NumStartupCacheObjects) }) {
+        QTest::addRow("QStandardPaths Cache Location, %u entries", entries)
+                << cacheLoc << Backend::Files << entries;
+        QTest::addRow("QStandardPaths Cache Location, indexed, %u entries", entries)
+                << cacheLoc << Backend::Indexed << entries;
+    }
+}
+
+// Times opening a populated cache and inserting into it, which makes
+// QNetworkDiskCache find out how big the cache is.
+void tst_qnetworkdiskcache::timeStartup()
+{
+    QFETCH(QString, cacheRootDirectory);
+    QFETCH(Backend, backend);
+    QFETCH(quint32, entries);
+
+    cacheDir = QString( cacheRootDirectory + QDir::separator() + "man_qndc");
+
+    //Housekeeping
+    cleanRecursive(cacheDir); // slow op.
+    initCacheObject(backend);
+    setCacheDirectory(cacheDir);
+    setMaximumCacheSize(qint64(HugeCacheLimit));
+    cache->clear();
+
+    //populate some fake data to simulate partially full cache
+    injectFakeData(entries);
+    cleanupCacheObject();
+
+    QBENCHMARK_ONCE {
+        initCacheObject(backend);
+        setCacheDirectory(cacheDir);
+        setMaximumCacheSize(qint64(HugeCacheLimit));
+        QVERIFY(isUrlCached(0));
+
+        QNetworkCacheMetaData meta;
+        meta.setUrl(QUrl(fakeURLbase + QString::number(entries)));
+        meta.setSaveToDisk(true);
+        QIODevice *device = cache->prepare(meta);
+        device->write(payload);
+        cache->insert(device);
+    }
+
+    //Cleanup (slow)
+    cleanupCacheObject();
+    cleanRecursive(cacheDir);
+}
+
 // This function simulates a partially or fully occupied disk cache
 // like a normal user of a cache might encounter is real-life browsing.
 // The point of this is to trigger degradation in file-system and media performance
 // that occur due to the quantity and layout of data.
-void tst_qnetworkdiskcache::injectFakeData()
+void tst_qnetworkdiskcache::injectFakeData(quint32 count)
 {
 
     QNetworkCacheMetaData::RawHeaderList headers;
@@ -311,7 +370,7 @@ void tst_qnetworkdiskcache::injectFakeData()
 
 
     //Prep cache dir with fake data using QNetworkDiskCache APIs
-    for (quint32 i = 0; i < NumFakeCacheObjects; i++) {
+    for (quint32 i = 0; i < count; i++) {
 
         //prepare metata for url
         QNetworkCacheMetaData meta;
@@ -369,11 +428,38 @@ void tst_qnetworkdiskcache::cleanupCacheObject()
     cache = 0;
 }
 
-void tst_qnetworkdiskcache::initCacheObject()
+void tst_qnetworkdiskcache::initCacheObject(Backend backend)
+{
+    if (backend == Backend::Indexed)
+        cache = new QNetworkIndexedDiskCache();
+    else
+        cache = new QNetworkDiskCache();
+}
+
+void tst_qnetworkdiskcache::setCacheDirectory(const QString &path)
 {
+    if (auto indexed = qobject_cast<QNetworkIndexedDiskCache *>(cache))
+        indexed->setCacheDirectory(path);
+    else
+        static_cast<QNetworkDiskCache *>(cache)->setCacheDirectory(path);
+}
 
-   cache = new QNetworkDiskCache();
+void tst_qnetworkdiskcache::setMaximumCacheSize(qint64 size)
+{
+    if (auto indexed = qobject_cast<QNetworkIndexedDiskCache *>(cache))
+        indexed->setMaximumCacheSize(size);
+    else
+        static_cast<QNetworkDiskCache *>(cache)->setMaximumCacheSize(size);
+}
 
+void tst_qnetworkdiskcache::addRows()
+{
+    QTest::addColumn<QString>("cacheRootDirectory");
+    QTest::addColumn<Backend>("backend");
+
+    QString cacheLoc = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    QTest::newRow("QStandardPaths Cache Location") << cacheLoc << Backend::Files;
+    QTest::newRow("QStandardPaths Cache Location, indexed") << cacheLoc << Backend::Indexed;
 }
 QTEST_MAIN(tst_qnetworkdiskcache)
 #include "tst_qnetworkdiskcache.moc"
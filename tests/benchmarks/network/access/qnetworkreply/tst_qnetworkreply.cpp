@@ -13,6 +13,7 @@
 #include <QtNetwork/qnetworkreply.h>
 #include <QtNetwork/qnetworkrequest.h>
 #include <QtNetwork/qnetworkaccessmanager.h>
+#include <QtNetwork/qhttp1configuration.h>
 #include <QtNetwork/qtcpsocket.h>
 #include <QtNetwork/qtcpserver.h>
 #include "../../../../auto/network-settings.h"
@@ -405,6 +406,48 @@ class HttpDownloadPerformanceClient : QObject {
 
 
 
+// Answers every request with a tiny HTTP/1.1 keep-alive response after a
+// fixed delay, emulating the round trip to a remote server. Requests pipelined
+// on a connection are answered in order.
+class PipeliningServer : public QTcpServer
+{
+    Q_OBJECT
+    std::chrono::milliseconds latency;
+    QHash<QTcpSocket *, QByteArray> buffers;
+
+public:
+    PipeliningServer(std::chrono::milliseconds latency) : latency(latency)
+    {
+        listen(QHostAddress::LocalHost);
+    }
+
+protected:
+    void incomingConnection(qintptr socketDescriptor) override
+    {
+        auto socket = new QTcpSocket(this);
+        socket->setSocketDescriptor(socketDescriptor);
+        connect(socket, &QTcpSocket::readyRead, this, [this, socket] {
+            QByteArray &buffer = buffers[socket];
+            buffer += socket->readAll();
+            qsizetype end;
+            while ((end = buffer.indexOf("\r\n\r\n")) >= 0) {
+                buffer.remove(0, end + 4);
+                QTimer::singleShot(latency, Qt::PreciseTimer, socket, [socket] {
+                    socket->write("HTTP/1.1 200 OK\r\n"
+                                  "Content-Type: text/plain\r\n"
+                                  "Content-Length: 2\r\n"
+                                  "\r\n"
+                                  "ok");
+                });
+            }
+        });
+        connect(socket, &QTcpSocket::disconnected, this, [this, socket] {
+            buffers.remove(socket);
+            socket->deleteLater();
+        });
+    }
+};
+
 class tst_qnetworkreply : public QObject
 {
     Q_OBJECT
@@ -417,6 +460,7 @@ public:
     { return connect(sender.data(), signal, receiver, slot, ct); }
 private slots:
     void initTestCase();
+    void init();
     void httpLatency();
 
 #ifndef QT_NO_SSL
@@ -432,6 +476,8 @@ private slots:
     void httpUploadPerformance();
     void httpDownloadPerformance_data();
     void httpDownloadPerformance();
+    void pipelinedRequests_data();
+    void pipelinedRequests();
     void httpDownloadPerformanceDownloadBuffer_data();
     void httpDownloadPerformanceDownloadBuffer();
     void httpsRequestChain();
@@ -440,6 +486,8 @@ private slots:
     void preConnect();
 
 private:
+    bool networkServerAvailable = false;
+
     void runHttpsUploadRequest(const QByteArray &data, const QNetworkRequest &request);
     QPair<QNetworkReply *, qint64> runGetRequest(QNetworkAccessManager *manager,
                                                  const QNetworkRequest &request);
@@ -447,7 +495,13 @@ private:
 
 void tst_qnetworkreply::initTestCase()
 {
-    if (!QtNetworkSettings::verifyTestNetworkSettings())
+    networkServerAvailable = QtNetworkSettings::verifyTestNetworkSettings();
+}
+
+void tst_qnetworkreply::init()
+{
+    // only some benchmarks bring their own server
+    if (!networkServerAvailable && qstrcmp(QTest::currentTestFunction(), "pipelinedRequests") != 0)
         QSKIP("No network test server available");
 }
 
@@ -701,6 +755,52 @@ void tst_qnetworkreply::httpDownloadPerformance()
             << ((UploadSize/1024.0)/(elapsed/1000.0)) << " kB/sec";
 };
 
+void tst_qnetworkreply::pipelinedRequests_data()
+{
+    QTest::addColumn<int>("connections");
+    QTest::addColumn<int>("pipelineDepth");
+
+    QTest::newRow("6 connections, no pipelining") << 6 << 0;
+    QTest::newRow("6 connections, pipeline depth 3") << 6 << 3;
+    QTest::newRow("6 connections, pipeline depth 8") << 6 << 8;
+    QTest::newRow("16 connections, no pipelining") << 16 << 0;
+    QTest::newRow("16 connections, pipeline depth 8") << 16 << 8;
+}
+
+void tst_qnetworkreply::pipelinedRequests()
+{
+    QFETCH(int, connections);
+    QFETCH(int, pipelineDepth);
+    constexpr int RequestCount = 300;
+
+    PipeliningServer server(5ms);
+    QVERIFY(server.isListening());
+
+    QHttp1Configuration configuration;
+    configuration.setNumberOfConnectionsPerHost(connections);
+    configuration.setMaximumPipelineDepth(pipelineDepth);
+    QNetworkRequest request(QUrl("http://127.0.0.1:" + QString::number(server.serverPort()) + '/'));
+    request.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, true);
+    request.setHttp1Configuration(configuration);
+
+    QBENCHMARK {
+        // a new manager each time, so that no connections are reused
+        QNetworkAccessManager manager;
+        int finished = 0;
+        for (int i = 0; i < RequestCount; ++i) {
+            QNetworkReply *reply = manager.get(request);
+            connect(reply, &QNetworkReply::finished, this, [reply, &finished] {
+                QCOMPARE(reply->error(), QNetworkReply::NoError);
+                reply->deleteLater();
+                if (++finished == RequestCount)
+                    QTestEventLoop::instance().exitLoop();
+            });
+        }
+        QTestEventLoop::instance().enterLoop(30s);
+        QVERIFY(!QTestEventLoop::instance().timeout());
+    }
+}
+
 enum HttpDownloadPerformanceDownloadBufferTestType {
     JustDownloadBuffer,
     DownloadBufferButUseRead,